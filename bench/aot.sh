@@ -0,0 +1,14 @@
+#!/bin/bash
+# Time each bench program run by the interpreter and compiled ahead of time
+# by blisp --emit-c. Run from the top directory as bench/aot.sh; pass make
+# variables such as CFLAGS="-std=c11 -O2" to build both with them.
+set -e
+make -s blisp "$@"
+for f in bench/*.blisp; do
+    make -s "${f%.blisp}.aot" "$@"
+    echo "$f"
+    TIMEFORMAT="    %Rs interpreted"
+    time ./blisp "$f" > /dev/null
+    TIMEFORMAT="    %Rs compiled"
+    time "./${f%.blisp}.aot" > /dev/null
+done
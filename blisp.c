@@ -1,34 +1,42 @@
 #include "blisp.h"
+#include "laot.h"
+#include "ljit.h"
 
 int main(int argc, char** argv) {
 
-    // Create some parsers
-    Number = mpc_new("number");
-    Boolean = mpc_new("boolean");
-    Symbol = mpc_new("symbol");
-    String = mpc_new("string");
-    Comment = mpc_new("comment");
-    Sexpr = mpc_new("sexpr");
-    Qexpr = mpc_new("qexpr");
-    Expr = mpc_new("expr");
-    Blisp = mpc_new("blisp");
-
-    // Define the parsers with the following language
-    mpca_lang(MPCA_LANG_DEFAULT,
-            " number : /-?[0-9]+([.][0-9]+)?/ ; \
-              boolean : /(true|false)/ ; \
-              symbol : /[a-zA-Z0-9_+\\-*\\/\\\\=<>!&^\\|%]+/ ; \
-              string : /\"(\\\\.|[^\"])*\"/ ; \
-              comment: /;[^\\r\\n]*/ ; \
-              sexpr  : '(' <expr>* ')' ; \
-              qexpr  : '{' <expr>* '}' ; \
-              expr   : <number> | <boolean> | <symbol> | <string> | <comment> | <sexpr> | <qexpr> ; \
-              blisp  : /^/ <expr>* /$/ ; \
-            ", Number, Boolean, Symbol, String, Comment, Sexpr, Qexpr, Expr, Blisp);
+    // Create the parsers
+    lval_read_init();
 
     // Create global environment.
     lenv* e = lenv_new();
     lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    // Optionally collect garbage at every opportunity to shake out bugs.
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+
+    // Optionally change how much memory recursion may use, in megabytes.
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+
+    // Optionally compile functions called often on to machine code.
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+
+    // Optionally list that machine code in /tmp/perf-<pid>.map for perf.
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    // Translate a program to C instead of running it.
+    if(argc == 3 && strcmp(argv[1], "--emit-c") == 0) {
+        return laot_emit(stdout, argv[2]) ? 0 : 1;
+    }
 
     // If we're supplied with a list of files
     if(argc >= 2) {
@@ -43,7 +51,7 @@ int main(int argc, char** argv) {
             lval* x = builtin_load(e, args);
 
             // If the result is an error be sure to print it
-            if(x->type == LVAL_ERR) {
+            if(lval_type(x) == LVAL_ERR) {
                 lval_println(e, x);
             }
 
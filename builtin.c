@@ -14,22 +14,12 @@ lval* builtin_load(lenv* e, lval* a) {
         lval* expr = lval_read(r.output);
         mpc_ast_delete(r.output);
 
-        // Evaluate each expression
-        while(expr->count) {
+        // Keep the arguments alive while evaluating each expression.
+        lgc_push(&a);
+        lval_eval_all(e, expr);
 
-            lval* x = lval_eval(e, lval_pop(expr, 0));
-
-            // If evaluation leads to error then print it
-            if(x->type == LVAL_ERR) {
-                lval_println(e, x);
-            }
-
-            lval_del(x);
-
-        }
-
-        // Delete expressions and arguments
-        lval_del(expr);
+        // Delete arguments
+        lgc_pop(1);
         lval_del(a);
 
         // Return success.
@@ -117,154 +107,388 @@ lval* builtin_show(lenv* e, lval* a) {
 
 }
 
+// Names of the operators, for error messages.
+static char* lop_names[] = {
+    [LOP_ADD] = "+", [LOP_SUB] = "-", [LOP_MUL] = "*", [LOP_DIV] = "/",
+    [LOP_MOD] = "%", [LOP_POW] = "^", [LOP_MIN] = "min", [LOP_MAX] = "max",
+    [LOP_GT] = ">", [LOP_LT] = "<", [LOP_GE] = ">=", [LOP_LE] = "<=",
+    [LOP_EQ] = "==", [LOP_NE] = "!=", [LOP_OR] = "||", [LOP_AND] = "&&"
+};
+
+// Apply an arithmetic operator to two integers, storing the result in *r.
+// Returns false if the result is not an int64_t (it overflows, divides by
+// zero, or is an inexact quotient or a negative power), so the caller falls
+// back to bignums or floats.
+bool builtin_int_op(enum lop op, int64_t x, int64_t y, int64_t* r) {
+
+    switch(op) {
+
+        case LOP_ADD:
+            return !__builtin_add_overflow(x, y, r);
+
+        case LOP_SUB:
+            return !__builtin_sub_overflow(x, y, r);
+
+        case LOP_MUL:
+            return !__builtin_mul_overflow(x, y, r);
+
+        case LOP_DIV:
+            if(y == 0 || (x == INT64_MIN && y == -1) || x % y != 0) {
+                return false;
+            }
+            *r = x / y;
+            return true;
+
+        case LOP_MOD:
+            if(y == 0) {
+                return false;
+            }
+            *r = (y == -1) ? 0 : x % y;
+            return true;
+
+        case LOP_POW: {
+            if(y < 0) {
+                return false;
+            }
+            // Exponentiation by squaring.
+            int64_t result = 1;
+            while(y > 0) {
+                if((y & 1) && __builtin_mul_overflow(result, x, &result)) {
+                    return false;
+                }
+                y >>= 1;
+                if(y > 0 && __builtin_mul_overflow(x, x, &x)) {
+                    return false;
+                }
+            }
+            *r = result;
+            return true;
+        }
+
+        case LOP_MIN:
+            *r = (x < y) ? x : y;
+            return true;
+
+        case LOP_MAX:
+            *r = (x > y) ? x : y;
+            return true;
+
+        default:
+            return false;
+    }
+
+}
+
+// Apply an arithmetic operator to two Integers of any size. Returns NULL
+// if the result is not an Integer (a negative power, or one too large to
+// compute), so the caller falls back to floats.
+static lval* builtin_big_op(enum lop op, lval* x, lval* y) {
+
+    lbig_int x_space, y_space;
+    lbig* a = lval_to_big(x, &x_space);
+    lbig* b = lval_to_big(y, &y_space);
+    lbig* r = NULL;
+
+    switch(op) {
+
+        case LOP_ADD:
+            r = lbig_add(a, b);
+            break;
+
+        case LOP_SUB:
+            r = lbig_sub(a, b);
+            break;
+
+        case LOP_MUL:
+            r = lbig_mul(a, b);
+            break;
+
+        case LOP_DIV: {
+            lbig* rem;
+            r = lbig_divmod(a, b, &rem);
+            bool exact = rem->count == 0;
+            lbig_free(rem);
+
+            // As with small Integers, an inexact quotient is a Number.
+            if(!exact) {
+                lbig_free(r);
+                return lval_num(lbig_ratio(a, b));
+            }
+            break;
+        }
+
+        case LOP_MOD:
+            lbig_free(lbig_divmod(a, b, &r));
+            break;
+
+        case LOP_POW: {
+            int64_t exponent;
+            if(b->sign > 0 && lbig_to_int(b, &exponent)) {
+                r = lbig_pow(a, exponent);
+            }
+            break;
+        }
+
+        case LOP_MIN:
+            r = lbig_copy(lbig_cmp(a, b) <= 0 ? a : b);
+            break;
+
+        case LOP_MAX:
+            r = lbig_copy(lbig_cmp(a, b) >= 0 ? a : b);
+            break;
+
+        default:
+            break;
+    }
+
+    return r ? lval_big(r) : NULL;
+
+}
+
+// Apply an arithmetic operator to two floats.
+static double builtin_float_op(enum lop op, double x, double y) {
+
+    switch(op) {
+        case LOP_ADD:
+            return x + y;
+        case LOP_SUB:
+            return x - y;
+        case LOP_MUL:
+            return x * y;
+        case LOP_DIV:
+            return x / y;
+        case LOP_MOD:
+            return fmod(x, y);
+        case LOP_POW:
+            return pow(x, y);
+        case LOP_MIN:
+            return (x < y) ? x : y;
+        case LOP_MAX:
+            return (x > y) ? x : y;
+        default:
+            return NAN;
+    }
+
+}
+
 // Perform a numerical operation on all lvals in the given list.
-lval* builtin_op(lenv* e, lval* a, char* op) {
+lval* builtin_op(lenv* e, lval* a, enum lop op) {
 
     // Ensure all arguments are numbers.
     for(int i = 0; i < a->count; ++i) {
-        if(a->cell[i]->type != LVAL_NUM) {
+        if(!lval_is_number(a->cell[i])) {
             lval_del(a);
             return lval_err("Cannot operate on non-number!");
         }
     }
 
-    // Pop the first element.
-    lval* x = lval_pop(a, 0);
+    // If one argument and subtraction, then perform unary negation.
+    if(op == LOP_SUB && a->count == 1) {
+        lval* x = lval_take(a, 0);
+        lval* r;
+        if(lval_type(x) == LVAL_INT && lval_int_value(x) != INT64_MIN) {
+            r = lval_int(-lval_int_value(x));
+        } else if(lval_is_integer(x)) {
+            lbig_int space;
+            r = lval_big(lbig_neg(lval_to_big(x, &space)));
+        } else {
+            r = lval_num(-lval_num_value(x));
+        }
+        lval_del(x);
+        return r;
+    }
+
+    // Arguments are read in place, so a long argument list is a single pass
+    // over the cell array. Integers accumulate in a machine integer until
+    // one does not fit, and only the result is allocated.
+    lval* x;
+    int k = 1;
+
+    if(lval_type(a->cell[0]) == LVAL_INT) {
+
+        int64_t acc = lval_int_value(a->cell[0]);
+        for(; k < a->count && lval_type(a->cell[k]) == LVAL_INT; ++k) {
+            int64_t r;
+            if(!builtin_int_op(op, acc, lval_int_value(a->cell[k]), &r)) {
+                break;
+            }
+            acc = r;
+        }
+
+        if(k == a->count) {
+            lval_del(a);
+            return lval_int(acc);
+        }
+
+        x = lval_int(acc);
 
-    // If no arguments and subtraction, then perform unary negation.
-    if((strcmp(op, "-") == 0) && a->count == 0) {
-        x->num = -x->num;
+    } else {
+        x = lval_copy(a->cell[0]);
     }
 
-    // While there are still elements remaining
-    while(a->count > 0) {
+    // Carry on with whatever the rest needs: machine integers while the
+    // result fits, then bignums while it is an exact integer, otherwise
+    // floating point.
+    for(; k < a->count; ++k) {
 
-        // Pop the next element
-        lval* y = lval_pop(a, 0);
-    
-        if(strcmp(op, "+") == 0 || strcmp(op, "add") == 0) {
-            x->num = x->num + y->num;
+        lval* y = a->cell[k];
 
-        } else if(strcmp(op, "-") == 0 || strcmp(op, "sub") == 0) {
-            x->num = x->num - y->num;
+        if((op == LOP_DIV || op == LOP_MOD) && lval_as_double(y) == 0) {
+            lval_del(x);
+            x = lval_err("Division by zero!");
+            break;
+        }
 
-        } else if(strcmp(op, "*") == 0 || strcmp(op, "mul") == 0) {
-            x->num = x->num * y->num;
+        int64_t i;
+        lval* r;
 
-        } else if(strcmp(op, "/") == 0 || strcmp(op, "div") == 0) {
-            if(y->num == 0) {
-                lval_del(x);
-                lval_del(y);
-                x = lval_err("Division by zero!");
-                break;
-            }
-            x->num = x->num / y->num;
+        if(lval_type(x) == LVAL_INT && lval_type(y) == LVAL_INT && builtin_int_op(op, lval_int_value(x), lval_int_value(y), &i)) {
+            lval_del(x);
+            x = lval_int(i);
 
-        } else if(strcmp(op, "%") == 0) {
-            x->num = (int)(x->num) % (int)(y->num);
+        } else if(lval_is_integer(x) && lval_is_integer(y) && (r = builtin_big_op(op, x, y))) {
+            lval_del(x);
+            x = r;
 
-        } else if(strcmp(op, "^") == 0) {
-            x->num = pow(x->num, y->num);
-    
-        } else if(strcmp(op, "min") == 0) {
-            x->num = (x->num < y->num) ? x->num : y->num;
-    
-        } else if(strcmp(op, "max") == 0) {
-            x->num = (x->num > y->num) ? x->num : y->num;
-    
         } else {
+            double d = builtin_float_op(op, lval_as_double(x), lval_as_double(y));
             lval_del(x);
-            lval_del(y);
-            x = lval_err("Bad operator!");
-            break;
+            x = lval_num(d);
         }
 
-        lval_del(y);
     }
 
     lval_del(a);
     return x;
-    
+
 }
 
 // Add numbers.
 lval* builtin_add(lenv* e, lval* a) {
-    return builtin_op(e, a, "+");
+    return builtin_op(e, a, LOP_ADD);
 }
 
 // Subtract numbers.
 lval* builtin_sub(lenv* e, lval* a) {
-    return builtin_op(e, a, "-");
+    return builtin_op(e, a, LOP_SUB);
 }
 
 // Multiply numbers.
 lval* builtin_mul(lenv* e, lval* a) {
-    return builtin_op(e, a, "*");
+    return builtin_op(e, a, LOP_MUL);
 }
 
 // Divide numbers.
 lval* builtin_div(lenv* e, lval* a) {
-    return builtin_op(e, a, "/");
+    return builtin_op(e, a, LOP_DIV);
 }
 
 // Modulus numbers.
 lval* builtin_mod(lenv* e, lval* a) {
-    return builtin_op(e, a, "%");
+    return builtin_op(e, a, LOP_MOD);
 }
 
 // Exponentiate numbers.
 lval* builtin_pow(lenv* e, lval* a) {
-    return builtin_op(e, a, "^");
+    return builtin_op(e, a, LOP_POW);
 }
 
 // Return the minimum of numbers.
 lval* builtin_min(lenv* e, lval* a) {
-    return builtin_op(e, a, "min");
+    return builtin_op(e, a, LOP_MIN);
 }
 
 // Return the maximum of numbers.
 lval* builtin_max(lenv* e, lval* a) {
-    return builtin_op(e, a, "max");
+    return builtin_op(e, a, LOP_MAX);
+}
+
+// Raise an Integer to an Integer power modulo a third, by repeated squaring.
+// The result lies between 0 and one less than the modulus' magnitude.
+lval* builtin_pow_mod(lenv* e, lval* a) {
+
+    // Error checking
+    lval_check_argcount("pow-mod", a, 3);
+    lval_check_integer("pow-mod", a, 0);
+    lval_check_integer("pow-mod", a, 1);
+    lval_check_integer("pow-mod", a, 2);
+
+    lbig_int x_space, e_space, m_space;
+    lbig* x = lval_to_big(a->cell[0], &x_space);
+    lbig* exponent = lval_to_big(a->cell[1], &e_space);
+    lbig* m = lval_to_big(a->cell[2], &m_space);
+
+    lval_assert(a, exponent->sign > 0, "Function 'pow-mod' passed negative exponent.");
+    lval_assert(a, m->count > 0, "Division by zero!");
+
+    // Positive moduli that fit in an int64_t keep every product within 128
+    // bits, so stay in machine integers.
+    if(lval_type(a->cell[0]) == LVAL_INT && lval_type(a->cell[1]) == LVAL_INT
+            && lval_type(a->cell[2]) == LVAL_INT && lval_int_value(a->cell[2]) > 0) {
+
+        int64_t modulus = lval_int_value(a->cell[2]);
+        int64_t base = lval_int_value(a->cell[0]) % modulus;
+        uint64_t n = lval_int_value(a->cell[1]);
+        unsigned __int128 b = base < 0 ? base + modulus : base;
+        unsigned __int128 r = 1 % modulus;
+
+        while(n > 0) {
+            if(n & 1) {
+                r = r * b % modulus;
+            }
+            b = b * b % modulus;
+            n >>= 1;
+        }
+
+        lval_del(a);
+        return lval_int((int64_t)r);
+
+    }
+
+    lval* r = lval_big(lbig_powmod(x, exponent, m));
+    lval_del(a);
+    return r;
+
 }
 
 // ">" boolean comparison
 lval* builtin_greater(lenv* e, lval* a) {
-    return builtin_compare(e, a, ">");
+    return builtin_compare(e, a, LOP_GT);
 }
 
 // "<" boolean comparison
 lval* builtin_less(lenv* e, lval* a) {
-    return builtin_compare(e, a, "<");
+    return builtin_compare(e, a, LOP_LT);
 }
 
 // ">=" boolean comparision.
 lval* builtin_greater_or_equal(lenv* e, lval* a) {
-    return builtin_compare(e, a, ">=");
+    return builtin_compare(e, a, LOP_GE);
 }
 
 // "<=" boolean comparision.
 lval* builtin_less_or_equal(lenv* e, lval* a) {
-    return builtin_compare(e, a, "<=");
+    return builtin_compare(e, a, LOP_LE);
 }
 
 // "==" boolean comparison
 lval* builtin_equal(lenv* e, lval* a) {
-    return builtin_compare(e, a, "==");
+    return builtin_compare(e, a, LOP_EQ);
 }
 
 // "!=" boolean comparison
 lval* builtin_not_equal(lenv* e, lval* a) {
-    return builtin_compare(e, a, "!=");
+    return builtin_compare(e, a, LOP_NE);
 }
 
 // "||" logical comparision.
 lval* builtin_or(lenv* e, lval* a) {
-    return builtin_logical(e, a, "||");
+    return builtin_logical(e, a, LOP_OR);
 }
 
 // "&&" logical comparision.
 lval* builtin_and(lenv* e, lval* a) {
-    return builtin_logical(e, a, "&&");
+    return builtin_logical(e, a, LOP_AND);
 }
 
 // "!" logical comparision.
@@ -282,23 +506,16 @@ lval* builtin_not(lenv* e, lval* a) {
 }
 
 // Handles boolean logic.
-lval* builtin_logical(lenv* e, lval* a, char* op) {
+lval* builtin_logical(lenv* e, lval* a, enum lop op) {
 
     // Check for two boolean arguments.
-    lval_check_argcount(op, a, 2);
-    lval_check_type(op, a, 0, LVAL_BOOL);
-    lval_check_type(op, a, 1, LVAL_BOOL);
+    lval_check_argcount(lop_names[op], a, 2);
+    lval_check_type(lop_names[op], a, 0, LVAL_BOOL);
+    lval_check_type(lop_names[op], a, 1, LVAL_BOOL);
 
-    bool result = false;
     bool first_bool = a->cell[0]->val;
     bool second_bool = a->cell[1]->val;
-
-    if(strcmp(op, "||") == 0) {
-        result = (first_bool || second_bool);
-
-    } else if(strcmp(op, "&&") == 0) {
-        result = (first_bool && second_bool);
-    }
+    bool result = (op == LOP_OR) ? (first_bool || second_bool) : (first_bool && second_bool);
 
     lval_del(a);
     return lval_bool(result);
@@ -306,40 +523,66 @@ lval* builtin_logical(lenv* e, lval* a, char* op) {
 }
 
 // Handles all numerical and type comparisons.
-lval* builtin_compare(lenv* e, lval* a, char* op) {
+lval* builtin_compare(lenv* e, lval* a, enum lop op) {
 
     // Check for two arguments.
-    lval_check_argcount(op, a, 2);
+    lval_check_argcount(lop_names[op], a, 2);
 
     // Represents true (1) or false (0).
     bool condition = false;
 
-    if(strcmp(op, "==") == 0) {
+    if(op == LOP_EQ) {
         condition = lval_eq(a->cell[0], a->cell[1]);
 
-    } else if(strcmp(op, "!=") == 0) {
+    } else if(op == LOP_NE) {
         condition = !lval_eq(a->cell[0], a->cell[1]);
 
     } else {
 
         // Check both arguments are Number types.
-        lval_check_type(op, a, 0, LVAL_NUM);
-        lval_check_type(op, a, 1, LVAL_NUM);
-
-        double first_num = a->cell[0]->num;
-        double second_num = a->cell[1]->num;
-
-        if(strcmp(op, ">") == 0) {
-            condition = (first_num > second_num);
-
-        } else if(strcmp(op, "<") == 0) {
-            condition = (first_num < second_num);
+        lval_check_number(lop_names[op], a, 0);
+        lval_check_number(lop_names[op], a, 1);
+
+        // Compare Integers with each other and with Numbers exactly, so
+        // that ordering agrees with ==, and two Numbers as doubles.
+        lval* first = a->cell[0];
+        lval* second = a->cell[1];
+        int order;
+        if(lval_type(first) == LVAL_INT && lval_type(second) == LVAL_INT) {
+            order = (lval_int_value(first) > lval_int_value(second)) - (lval_int_value(first) < lval_int_value(second));
+        } else if(lval_is_integer(first) && lval_is_integer(second)) {
+            lbig_int x, y;
+            order = lbig_cmp(lval_to_big(first, &x), lval_to_big(second, &y));
+        } else if((lval_type(first) == LVAL_NUM && isnan(lval_num_value(first)))
+                || (lval_type(second) == LVAL_NUM && isnan(lval_num_value(second)))) {
+
+            // Nothing is ordered against NaN.
+            lval_del(a);
+            return lval_bool(false);
 
-        } else if(strcmp(op, ">=") == 0) {
-            condition = (first_num >= second_num);
+        } else if(lval_type(first) != LVAL_NUM) {
+            order = lval_cmp_num(first, lval_num_value(second));
+        } else if(lval_type(second) != LVAL_NUM) {
+            order = -lval_cmp_num(second, lval_num_value(first));
+        } else {
+            order = (lval_num_value(first) > lval_num_value(second)) - (lval_num_value(first) < lval_num_value(second));
+        }
 
-        } else if(strcmp(op, "<=") == 0) {
-            condition = (first_num <= second_num);
+        switch(op) {
+            case LOP_GT:
+                condition = (order > 0);
+                break;
+            case LOP_LT:
+                condition = (order < 0);
+                break;
+            case LOP_GE:
+                condition = (order >= 0);
+                break;
+            case LOP_LE:
+                condition = (order <= 0);
+                break;
+            default:
+                break;
         }
     }
 
@@ -356,14 +599,11 @@ lval* builtin_head(lenv* e, lval* a) {
     lval_check_type("head", a, 0, LVAL_QEXPR);
     lval_check_emptylist("head", a, 0);
 
-    // Otherwise take first argument
-    lval* v = lval_take(a, 0);
-
-    // Delete all elements that are not head and return
-    while(v->count > 1) {
-        lval_del(lval_pop(v, 1));
-    }
+    // Build a new list sharing only the first element.
+    lval* v = lval_qexpr();
+    lval_add(v, lval_copy(lval_index(a->cell[0], 0)));
 
+    lval_del(a);
     return v;
 
 }
@@ -376,19 +616,16 @@ lval* builtin_tail(lenv* e, lval* a) {
     lval_check_type("tail", a, 0, LVAL_QEXPR);
     lval_check_emptylist("tail", a, 0); 
     
-    // Otherwise take first argument.
+    // Otherwise take first argument and share all but its first element.
     lval* v = lval_take(a, 0);
-
-    // Delete first element and return.
-    lval_del(lval_pop(v, 0));
-
-    return v;
+    return lval_slice(v, 1, v->count - 1);
 
 }
 
 // Convert an S-Expression into a Q-Expression.
 lval* builtin_list(lenv* e, lval* a) {
 
+    a = lval_unshare(a);
     a->type = LVAL_QEXPR;
     return a;
 
@@ -401,10 +638,14 @@ lval* builtin_eval(lenv* e, lval* a) {
     lval_check_argcount("eval", a, 1);
     lval_check_type("eval", a, 0, LVAL_QEXPR);
 
+    // The body is evaluated where it is, without a copy.
     lval* v = lval_take(a, 0);
-    v->type = LVAL_SEXPR;
-    
-    return lval_eval(e, v);
+    lgc_push(&v);
+    lval* x = lval_eval_list(e, v);
+    lgc_pop(1);
+
+    lval_del(v);
+    return x;
 
 }
 
@@ -432,7 +673,7 @@ lval* builtin_cons(lenv* e, lval* a) {
     
     // Error checking
     lval_check_argcount("cons", a, 2);
-    lval_check_type("cons", a, 0, LVAL_NUM);
+    lval_check_number("cons", a, 0);
     lval_check_type("cons", a, 1, LVAL_QEXPR);
 
     lval* x = lval_qexpr();
@@ -453,7 +694,8 @@ lval* builtin_len(lenv* e, lval* a) {
 
     int num_elements = a->cell[0]->count;
 
-    return lval_num(num_elements);
+    lval_del(a);
+    return lval_int(num_elements);
 
 }
 
@@ -465,13 +707,184 @@ lval* builtin_init(lenv* e, lval* a) {
     lval_check_type("init", a, 0, LVAL_QEXPR);
     lval_check_emptylist("init", a, 0);
 
-    // Take the first argument.
+    // Take the first argument and share all but its final element.
     lval* v = lval_take(a, 0);
+    return lval_slice(v, 0, v->count - 1);
 
-    // Delete final element.
-    lval_del(lval_pop(v, v->count - 1));
+}
 
-    return v;
+// Value of Integer v as a position in a list, Integers too large for an
+// int64_t taken as the nearest that is, which no list reaches either.
+static int64_t builtin_position(lval* v) {
+
+    if(lval_type(v) == LVAL_BIG) {
+        return v->big->sign > 0 ? INT64_MAX : INT64_MIN;
+    }
+    return lval_int_value(v);
+
+}
+
+// Return count elements of a Q-Expression starting at offset.
+lval* builtin_slice(lenv* e, lval* a) {
+
+    // Error checking
+    lval_check_argcount("slice", a, 3);
+    lval_check_type("slice", a, 0, LVAL_QEXPR);
+    lval_check_integer("slice", a, 1);
+    lval_check_integer("slice", a, 2);
+
+    int64_t length = a->cell[0]->count;
+    int64_t offset = builtin_position(a->cell[1]);
+    int64_t count = builtin_position(a->cell[2]);
+    lval_assert(a, offset >= 0 && count >= 0 && offset <= length && count <= length - offset,
+            "Function 'slice' passed out of range slice. Got offset %" PRId64 " and count %" PRId64
+            " for length %" PRId64 ".", offset, count, length);
+
+    lval* v = lval_take(a, 0);
+    return lval_slice(v, (int)offset, (int)count);
+
+}
+
+// Return the element of a Q-Expression at an index.
+lval* builtin_nth(lenv* e, lval* a) {
+
+    // Error checking
+    lval_check_argcount("nth", a, 2);
+    lval_check_type("nth", a, 0, LVAL_QEXPR);
+    lval_check_integer("nth", a, 1);
+
+    int64_t length = a->cell[0]->count;
+    int64_t index = builtin_position(a->cell[1]);
+    lval_assert(a, index >= 0 && index < length,
+            "Function 'nth' passed out of range index. Got %" PRId64 " for length %" PRId64 ".",
+            index, length);
+
+    lval* x = lval_copy(lval_index(a->cell[0], (int)index));
+    lval_del(a);
+    return x;
+
+}
+
+// Return a Q-Expression with the element at an index replaced.
+lval* builtin_update(lenv* e, lval* a) {
+
+    // Error checking
+    lval_check_argcount("update", a, 3);
+    lval_check_type("update", a, 0, LVAL_QEXPR);
+    lval_check_integer("update", a, 1);
+
+    int64_t length = a->cell[0]->count;
+    int64_t index = builtin_position(a->cell[1]);
+    lval_assert(a, index >= 0 && index < length,
+            "Function 'update' passed out of range index. Got %" PRId64 " for length %" PRId64 ".",
+            index, length);
+
+    lval* x = lval_pop(a, 2);
+    lval* v = lval_pop(a, 0);
+    lval_del(a);
+
+    return lval_update(v, (int)index, x);
+
+}
+
+// Create a Map from a Q-Expression of alternating keys and values.
+lval* builtin_map_new(lenv* e, lval* a) {
+
+    // Error checking
+    lval_check_argcount("map-new", a, 1);
+    lval_check_type("map-new", a, 0, LVAL_QEXPR);
+    lval_assert(a, a->cell[0]->count % 2 == 0,
+            "Function 'map-new' passed a key without a value.");
+
+    lval* pairs = a->cell[0];
+    lval* m = lval_map();
+
+    for(int i = 0; i < pairs->count; i += 2) {
+        m = lval_map_put(m, lval_copy(lval_index(pairs, i)), lval_copy(lval_index(pairs, i + 1)));
+    }
+
+    lval_del(a);
+    return m;
+
+}
+
+// Look up a key in a Map, with an optional default for missing keys.
+lval* builtin_map_get(lenv* e, lval* a) {
+
+    // Error checking
+    lval_assert(a, a->count == 2 || a->count == 3,
+            "Function 'map-get' passed incorrect number of arguments. Got %i, Expected 2 or 3.",
+            a->count);
+    lval_check_type("map-get", a, 0, LVAL_MAP);
+
+    lval* x = lval_map_get(a->cell[0], a->cell[1]);
+
+    if(x) {
+        x = lval_copy(x);
+    } else if(a->count == 3) {
+        x = lval_copy(a->cell[2]);
+    } else {
+        x = lval_err("Function 'map-get' passed a key not in the map.");
+    }
+
+    lval_del(a);
+    return x;
+
+}
+
+// Return a Map with a key bound to a value.
+lval* builtin_map_put(lenv* e, lval* a) {
+
+    // Error checking
+    lval_check_argcount("map-put", a, 3);
+    lval_check_type("map-put", a, 0, LVAL_MAP);
+
+    lval* m = lval_pop(a, 0);
+    lval* key = lval_pop(a, 0);
+    lval* val = lval_pop(a, 0);
+    lval_del(a);
+
+    return lval_map_put(m, key, val);
+
+}
+
+// Return a Map without a key.
+lval* builtin_map_del(lenv* e, lval* a) {
+
+    // Error checking
+    lval_check_argcount("map-del", a, 2);
+    lval_check_type("map-del", a, 0, LVAL_MAP);
+
+    lval* m = lval_pop(a, 0);
+    lval* key = lval_pop(a, 0);
+    lval_del(a);
+
+    return lval_map_del(m, key);
+
+}
+
+// Return a Q-Expression of the keys of a Map.
+lval* builtin_map_keys(lenv* e, lval* a) {
+
+    // Error checking
+    lval_check_argcount("map-keys", a, 1);
+    lval_check_type("map-keys", a, 0, LVAL_MAP);
+
+    return lval_map_keys(lval_take(a, 0));
+
+}
+
+// Return the number of keys in a Map.
+lval* builtin_map_len(lenv* e, lval* a) {
+
+    // Error checking
+    lval_check_argcount("map-len", a, 1);
+    lval_check_type("map-len", a, 0, LVAL_MAP);
+
+    int size = a->cell[0]->size;
+
+    lval_del(a);
+    return lval_int(size);
 
 }
 
@@ -480,9 +893,9 @@ lval* builtin_init(lenv* e, lval* a) {
 lval* builtin_values(lenv* e, lval* a) {
 
     lval_check_argcount("values", a, 1);
-    lval_check_type("values", a, 0, LVAL_NUM);
+    lval_check_number("values", a, 0);
 
-    double num = a->cell[0]->num;
+    double num = lval_as_double(a->cell[0]);
     lval* x = lval_qexpr();
 
     // Print all named values.
@@ -508,9 +921,9 @@ lval* builtin_values(lenv* e, lval* a) {
 lval* builtin_exit(lenv* e, lval* a) {
     
     lval_check_argcount("exit", a, 1);
-    lval_check_type("exit", a, 0, LVAL_NUM);
+    lval_check_number("exit", a, 0);
 
-    int status = (int)(a->cell[0]->num);
+    int status = (int)lval_as_double(a->cell[0]);
     
     printf("Please come again...\n");
     printf("Exiting blisp: %i\n", status);
@@ -518,6 +931,176 @@ lval* builtin_exit(lenv* e, lval* a) {
 
 }
 
+// Report memory statistics, running a collection first if passed true.
+lval* builtin_gc(lenv* e, lval* a) {
+
+    lval_check_argcount("gc", a, 1);
+    lval_check_type("gc", a, 0, LVAL_BOOL);
+
+    bool collect = a->cell[0]->val;
+    lval_del(a);
+
+    if(collect) {
+        lgc_collect();
+    }
+
+    // Return counters as a list of name/value pairs.
+    struct lgc_stats stats = lgc_get_stats();
+    lval* x = lval_qexpr();
+    lval_add(x, lval_sym("allocated"));
+    lval_add(x, lval_int(stats.allocated));
+    lval_add(x, lval_sym("freed"));
+    lval_add(x, lval_int(stats.freed));
+    lval_add(x, lval_sym("collected"));
+    lval_add(x, lval_int(stats.collected));
+    lval_add(x, lval_sym("collections"));
+    lval_add(x, lval_int(stats.collections));
+    lval_add(x, lval_sym("minor"));
+    lval_add(x, lval_int(stats.minor_collections));
+    lval_add(x, lval_sym("promoted"));
+    lval_add(x, lval_int(stats.promoted));
+    lval_add(x, lval_sym("live"));
+    lval_add(x, lval_int(stats.live));
+
+    return x;
+
+}
+
+// Report allocator statistics for the size class serving n-byte blocks,
+// or for all memory if n is 0.
+lval* builtin_mem(lenv* e, lval* a) {
+
+    lval_check_argcount("mem", a, 1);
+    lval_check_number("mem", a, 0);
+    lval_assert(a, lval_as_double(a->cell[0]) >= 0,
+            "Function 'mem' passed negative block size %g.", lval_as_double(a->cell[0]));
+
+    struct lmem_stats stats = lmem_get_stats((size_t)lval_as_double(a->cell[0]));
+    lval_del(a);
+
+    // Bytes reserved for slabs but not currently handed out.
+    long slack = stats.arena - stats.used;
+
+    // Return counters as a list of name/value pairs.
+    lval* x = lval_qexpr();
+    lval_add(x, lval_sym("size"));
+    lval_add(x, lval_int(stats.size));
+    lval_add(x, lval_sym("arena"));
+    lval_add(x, lval_int(stats.arena));
+    lval_add(x, lval_sym("used"));
+    lval_add(x, lval_int(stats.used));
+    lval_add(x, lval_sym("slack"));
+    lval_add(x, lval_int(slack));
+    lval_add(x, lval_sym("fragmentation"));
+    lval_add(x, lval_num(stats.arena ? (double)slack / stats.arena : 0));
+    lval_add(x, lval_sym("allocs"));
+    lval_add(x, lval_int(stats.allocs));
+    lval_add(x, lval_sym("frees"));
+    lval_add(x, lval_int(stats.frees));
+    lval_add(x, lval_sym("large"));
+    lval_add(x, lval_int(stats.large));
+
+    return x;
+
+}
+
+// Report how deep compiled functions are nested and the stack memory they
+// use, starting the peaks again afterwards if passed true.
+lval* builtin_stack(lenv* e, lval* a) {
+
+    lval_check_argcount("stack", a, 1);
+    lval_check_type("stack", a, 0, LVAL_BOOL);
+
+    struct lvm_stats stats = lvm_get_stats(a->cell[0]->val);
+    lval_del(a);
+
+    // Return counters as a list of name/value pairs.
+    lval* x = lval_qexpr();
+    lval_add(x, lval_sym("depth"));
+    lval_add(x, lval_int(stats.depth));
+    lval_add(x, lval_sym("peak-depth"));
+    lval_add(x, lval_int(stats.peak_depth));
+    lval_add(x, lval_sym("bytes"));
+    lval_add(x, lval_int(stats.bytes));
+    lval_add(x, lval_sym("peak-bytes"));
+    lval_add(x, lval_int(stats.peak_bytes));
+    lval_add(x, lval_sym("limit"));
+    lval_add(x, lval_int(stats.limit));
+
+    return x;
+
+}
+
+// Time n rounds of a loop run by the VM and report the instructions run
+// and the average time each, and each round, took.
+lval* builtin_dispatch(lenv* e, lval* a) {
+
+    lval_check_argcount("dispatch", a, 1);
+    lval_check_type("dispatch", a, 0, LVAL_INT);
+    lval_assert(a, lval_int_value(a->cell[0]) >= 0,
+            "Function 'dispatch' passed a negative number of rounds.");
+    int64_t n = lval_int_value(a->cell[0]);
+    lval_del(a);
+
+    // A function that counts down in a loop, calling itself in tail
+    // position since it is passed itself.
+    mpc_result_t r;
+    mpc_parse("dispatch", "(\\ {f n} {if (== n 0) {n} {f f (- n 1)}})", Blisp, &r);
+    lval* expr = lval_read(r.output);
+    mpc_ast_delete(r.output);
+    lval* f = lval_eval(e, lval_take(expr, 0));
+    lgc_push(&f);
+
+    lval* args = lval_sexpr();
+    lval_add(args, lval_copy(f));
+    lval_add(args, lval_int(n));
+
+    long steps = lvm_steps();
+    clock_t start = clock();
+    lval* x = lval_call(e, f, args);
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    steps = lvm_steps() - steps;
+
+    lgc_pop(1);
+    lval_del(f);
+
+    if(lval_type(x) == LVAL_ERR) {
+        return x;
+    }
+    lval_del(x);
+
+    if(steps == 0) {
+        return lval_err("Function 'dispatch' found no instructions run: the VM is not in use.");
+    }
+
+    // Return counters as a list of name/value pairs.
+    x = lval_qexpr();
+    lval_add(x, lval_sym("instructions"));
+    lval_add(x, lval_int(steps));
+    lval_add(x, lval_sym("seconds"));
+    lval_add(x, lval_num(seconds));
+    lval_add(x, lval_sym("ns-per-instruction"));
+    lval_add(x, lval_num(seconds * 1e9 / steps));
+    lval_add(x, lval_sym("ns-per-round"));
+    lval_add(x, lval_num(seconds * 1e9 / (n + 1)));
+
+    return x;
+
+}
+
+// Compile a user-defined function to native code with the system C
+// compiler, reusing what an earlier session built for it. Returns it.
+lval* builtin_compile(lenv* e, lval* a) {
+
+    lval_check_argcount("compile", a, 1);
+    lval_check_type("compile", a, 0, LVAL_FUN);
+    lval_assert(a, !a->cell[0]->builtin,
+            "Function 'compile' passed a builtin function.");
+
+    return laot_compile(lval_take(a, 0));
+
+}
+
 // Define a new variable. Return an empty list on success.
 lval* builtin_var(lenv* e, lval* a, char* name) {
 
@@ -525,12 +1108,13 @@ lval* builtin_var(lenv* e, lval* a, char* name) {
 
     // First argument is symbol list
     lval* syms = a->cell[0];
+    lval_flatten(syms);
 
     // Ensure all elements of first list are symbols
     for(int i = 0; i < syms->count; ++i) {
-        lval_assert(a, syms->cell[i]->type == LVAL_SYM,
+        lval_assert(a, lval_type(syms->cell[i]) == LVAL_SYM,
                 "Function '%s' cannot define non-symbol. Got %s, Expected %s.",
-                name, ltype_name(syms->cell[i]->type), ltype_name(LVAL_SYM));
+                name, lval_type_name(syms->cell[i]), ltype_name(LVAL_SYM));
     }
 
     // Check correct number of symbols and values
@@ -555,6 +1139,26 @@ lval* builtin_var(lenv* e, lval* a, char* name) {
 
 }
 
+// Bind x to the single symbol in syms, globally if global is true and
+// locally otherwise, without an argument list. Returns the shared Okay
+// value, as def and = do, or NULL if syms is not a Q-Expression of one
+// symbol, leaving it to builtin_var. x is not consumed.
+lval* builtin_var_form(lenv* e, lval* syms, lval* x, bool global) {
+
+    if(lval_type(syms) != LVAL_QEXPR || syms->count != 1 || lval_type(lval_index(syms, 0)) != LVAL_SYM) {
+        return NULL;
+    }
+
+    if(global) {
+        lenv_def(e, lval_index(syms, 0), x);
+    } else {
+        lenv_put(e, lval_index(syms, 0), x);
+    }
+
+    return lval_okay();
+
+}
+
 // Create global variable.
 lval* builtin_def(lenv* e, lval* a) {
     return builtin_var(e, a, "def");
@@ -573,9 +1177,14 @@ lval* builtin_lambda(lenv* e, lval* a) {
     lval_check_type("λ", a, 0, LVAL_QEXPR);
     lval_check_type("λ", a, 1, LVAL_QEXPR);
 
-    // Check first Q-Expression contains only symbols
+    // Check first Q-Expression contains only symbols, releasing only the
+    // arguments, which hold it, if not.
+    lval_flatten(a->cell[0]);
     for(int i = 0; i < a->cell[0]->count; ++i) {
-        lval_check_type("λ parameters", a->cell[0], i, LVAL_SYM);
+        lval* formal = a->cell[0]->cell[i];
+        lval_assert(a, lval_type(formal) == LVAL_SYM,
+                "Function 'λ parameters' passed incorrect type for argument %i. Got %s, Expected %s.",
+                i, lval_type_name(formal), ltype_name(LVAL_SYM));
     }
 
     // Pop first two arguments and pass them to lval_lambda
@@ -587,32 +1196,42 @@ lval* builtin_lambda(lenv* e, lval* a) {
 
 }
 
-// If conditional
+// Build a lambda sharing Q-Expressions formals and body, without an
+// argument list. Returns NULL if they are anything else, or the formals
+// are not all symbols, leaving it to builtin_lambda.
+lval* builtin_lambda_form(lval* formals, lval* body) {
+
+    if(lval_type(formals) != LVAL_QEXPR || lval_type(body) != LVAL_QEXPR) {
+        return NULL;
+    }
+
+    lval_flatten(formals);
+    for(int i = 0; i < formals->count; ++i) {
+        if(lval_type(formals->cell[i]) != LVAL_SYM) {
+            return NULL;
+        }
+    }
+
+    return lval_lambda(lval_copy(formals), lval_copy(body));
+
+}
+
+// If conditional. Only the branch chosen needs to be a Q-Expression.
 lval* builtin_if(lenv* e, lval* a) {
 
     // Check for correct argument count and types.
     lval_check_argcount("if", a, 3);
     lval_check_type("if", a, 0, LVAL_BOOL);
-    lval_check_type("if", a, 1, LVAL_QEXPR);
-    lval_check_type("if", a, 1, LVAL_QEXPR);
+    int i = a->cell[0]->val ? 1 : 2;
+    lval_check_type("if", a, i, LVAL_QEXPR);
 
-    lval* result;
+    // Run the branch chosen where it is, without a copy.
+    lval* branch = lval_take(a, i);
+    lgc_push(&branch);
+    lval* x = lval_eval_list(e, branch);
+    lgc_pop(1);
 
-    // Mark both Q-Expressions as evaluable.
-    a->cell[1]->type = LVAL_SEXPR;
-    a->cell[2]->type = LVAL_SEXPR;
-
-    // If condition is true, evaluate first expression.
-    if(a->cell[0]->val) {
-        result = lval_eval(e, lval_pop(a, 1));
-
-    // Otherwise evaluate second expression.
-    } else {
-        result = lval_eval(e, lval_pop(a, 2));
-    }
-
-    // Delete argument list and return.
-    lval_del(a);
-    return result;
+    lval_del(branch);
+    return x;
 
 }
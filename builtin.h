@@ -1,9 +1,11 @@
 #ifndef BUILTIN_H
 #define BUILTIN_H
 
+#include <time.h>
 #include "blisp.h"
 #include "lval.h"
 #include "lenv.h"
+#include "laot.h"
 #include "mpc.h"
 
 // Report generic conditional checking errors.
@@ -22,9 +24,21 @@
 
 // Report type errors.
 #define lval_check_type(name, args, argnum, expected_type) \
-    lval_assert(args, args->cell[argnum]->type == expected_type, \
+    lval_assert(args, lval_type(args->cell[argnum]) == expected_type, \
             "Function '%s' passed incorrect type for argument %i. Got %s, Expected %s.", \
-            name, argnum, ltype_name(args->cell[argnum]->type), ltype_name(expected_type));
+            name, argnum, lval_type_name(args->cell[argnum]), ltype_name(expected_type));
+
+// Report non-number errors, accepting both Integers and Numbers.
+#define lval_check_number(name, args, argnum) \
+    lval_assert(args, lval_is_number(args->cell[argnum]), \
+            "Function '%s' passed incorrect type for argument %i. Got %s, Expected %s.", \
+            name, argnum, lval_type_name(args->cell[argnum]), ltype_name(LVAL_NUM));
+
+// Report non-integer errors, accepting Integers of any size.
+#define lval_check_integer(name, args, argnum) \
+    lval_assert(args, lval_is_integer(args->cell[argnum]), \
+            "Function '%s' passed incorrect type for argument %i. Got %s, Expected %s.", \
+            name, argnum, lval_type_name(args->cell[argnum]), ltype_name(LVAL_INT));
 
 // Report empty list errors
 #define lval_check_emptylist(name, args, argnum) \
@@ -32,6 +46,14 @@
             "Function '%s' passed {} for argument %i.", \
             name, argnum);
 
+// Operators shared by the arithmetic, comparison and logical builtins.
+// Each builtin passes its own, so nothing is looked up by name per call.
+enum lop {
+    LOP_ADD, LOP_SUB, LOP_MUL, LOP_DIV, LOP_MOD, LOP_POW, LOP_MIN, LOP_MAX,
+    LOP_GT, LOP_LT, LOP_GE, LOP_LE, LOP_EQ, LOP_NE,
+    LOP_OR, LOP_AND
+};
+
 // Load a file.
 lval* builtin_load(lenv* e, lval* a);
 
@@ -47,8 +69,12 @@ lval* builtin_read(lenv* e, lval* a);
 // Print a string as it is (unescaped)
 lval* builtin_show(lenv* e, lval* a);
 
+// Apply an arithmetic operator to two integers, storing the result in *r.
+// Returns false if the result is not an int64_t.
+bool builtin_int_op(enum lop op, int64_t x, int64_t y, int64_t* r);
+
 // Perform a numerical operation on all lvals in the given list.
-lval* builtin_op(lenv* e, lval* a, char* op);
+lval* builtin_op(lenv* e, lval* a, enum lop op);
 
 // Add numbers.
 lval* builtin_add(lenv* e, lval* a);
@@ -74,6 +100,9 @@ lval* builtin_min(lenv* e, lval* a);
 // Return the maximum of numbers.
 lval* builtin_max(lenv* e, lval* a);
 
+// Raise an Integer to an Integer power modulo a third.
+lval* builtin_pow_mod(lenv* e, lval* a);
+
 // ">" boolean comparison
 lval* builtin_greater(lenv* e, lval* a);
 
@@ -102,10 +131,10 @@ lval* builtin_and(lenv* e, lval* a);
 lval* builtin_not(lenv* e, lval* a);
 
 // Handles boolean logic.
-lval* builtin_logical(lenv* e, lval* a, char* op);
+lval* builtin_logical(lenv* e, lval* a, enum lop op);
 
 // Handles all boolean comparisons
-lval* builtin_compare(lenv* e, lval* a, char* op);
+lval* builtin_compare(lenv* e, lval* a, enum lop op);
 
 // Take a Q-Expression and return a Q-Expression containing only the first element.
 lval* builtin_head(lenv* e, lval* a);
@@ -131,6 +160,33 @@ lval* builtin_len(lenv* e, lval* a);
 // Return a Q-Expression with the final element removed.
 lval* builtin_init(lenv* e, lval* a);
 
+// Return count elements of a Q-Expression starting at offset.
+lval* builtin_slice(lenv* e, lval* a);
+
+// Return the element of a Q-Expression at an index.
+lval* builtin_nth(lenv* e, lval* a);
+
+// Return a Q-Expression with the element at an index replaced.
+lval* builtin_update(lenv* e, lval* a);
+
+// Create a Map from a Q-Expression of alternating keys and values.
+lval* builtin_map_new(lenv* e, lval* a);
+
+// Look up a key in a Map, with an optional default for missing keys.
+lval* builtin_map_get(lenv* e, lval* a);
+
+// Return a Map with a key bound to a value.
+lval* builtin_map_put(lenv* e, lval* a);
+
+// Return a Map without a key.
+lval* builtin_map_del(lenv* e, lval* a);
+
+// Return a Q-Expression of the keys of a Map.
+lval* builtin_map_keys(lenv* e, lval* a);
+
+// Return the number of keys in a Map.
+lval* builtin_map_len(lenv* e, lval* a);
+
 // Print all named values in an environment up to specified number.
 // If -1, print all.
 lval* builtin_values(lenv* e, lval* a);
@@ -139,9 +195,34 @@ lval* builtin_values(lenv* e, lval* a);
 // DO NOT USE. PROBABLY MEMORY LEAKS.
 lval* builtin_exit(lenv* e, lval* a);
 
+// Report memory statistics, running a collection first if passed true.
+lval* builtin_gc(lenv* e, lval* a);
+
+// Report allocator statistics for the size class serving n-byte blocks,
+// or for all memory if n is 0.
+lval* builtin_mem(lenv* e, lval* a);
+
+// Report how deep compiled functions are nested and the stack memory they
+// use, starting the peaks again afterwards if passed true.
+lval* builtin_stack(lenv* e, lval* a);
+
+// Time n rounds of a loop run by the VM and report the instructions run
+// and the average time each, and each round, took.
+lval* builtin_dispatch(lenv* e, lval* a);
+
+// Compile a user-defined function to native code with the system C
+// compiler, reusing what an earlier session built for it. Returns it.
+lval* builtin_compile(lenv* e, lval* a);
+
 // Define a new variable. Return an empty list on success.
 lval* builtin_var(lenv* e, lval* a, char* name);
 
+// Bind x to the single symbol in syms, globally if global is true and
+// locally otherwise, without an argument list. Returns the shared Okay
+// value, as def and = do, or NULL if syms is not a Q-Expression of one
+// symbol, leaving it to builtin_var. x is not consumed.
+lval* builtin_var_form(lenv* e, lval* syms, lval* x, bool global);
+
 // Create global variable.
 lval* builtin_def(lenv* e, lval* a);
 
@@ -151,7 +232,12 @@ lval* builtin_put(lenv* e, lval* a);
 // Create a lambda function given a list of symbols and a list represneting the body.
 lval* builtin_lambda(lenv* e, lval* a);
 
-// If conditional
+// Build a lambda sharing Q-Expressions formals and body, without an
+// argument list. Returns NULL if they are anything else, or the formals
+// are not all symbols, leaving it to builtin_lambda.
+lval* builtin_lambda_form(lval* formals, lval* body);
+
+// If conditional. Only the branch chosen needs to be a Q-Expression.
 lval* builtin_if(lenv* e, lval* a);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,765 @@
+#define _DEFAULT_SOURCE // For open_memstream, mkdir, dlopen and the like
+
+#include "laot.h"
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// How the system C compiler is asked for a library that can be loaded.
+#ifdef __APPLE__
+#define LAOT_SHARED "-shared -undefined dynamic_lookup"
+#else
+#define LAOT_SHARED "-shared -fPIC"
+#endif
+
+// Longest path or command put together for compile.
+#define LAOT_PATH_MAX 4096
+
+// Most values given to one call of blisp_list in the generated C.
+#define LAOT_CHUNK 64
+
+// Lambdas compiled from the program so far, each to different code.
+struct laot_funs {
+    lval** funs;
+    int count;
+    int capacity;
+};
+
+// Parse the file named filename into a list of its expressions, or an
+// error.
+static lval* laot_read(char* filename) {
+
+    mpc_result_t r;
+    if(!mpc_parse_contents(filename, Blisp, &r)) {
+        char* err_msg = mpc_err_string(r.error);
+        mpc_err_delete(r.error);
+        lval* err = lval_err("Could not load Library %s", err_msg);
+        free(err_msg);
+        return err;
+    }
+
+    lval* program = lval_read(r.output);
+    mpc_ast_delete(r.output);
+    return program;
+
+}
+
+// True if x is a top-level load of a file named by a literal.
+static bool laot_is_load(lval* x) {
+
+    return lval_type(x) == LVAL_SEXPR && x->count == 2
+        && lval_type(lval_index(x, 0)) == LVAL_SYM && strcmp(lval_index(x, 0)->sym, "load") == 0
+        && lval_type(lval_index(x, 1)) == LVAL_STR;
+
+}
+
+// Add the expressions of program to forms, with those of files it loads
+// in place of the loads, up to depth more files deep. Consumes program.
+static void laot_splice(lval* forms, lval* program, int depth) {
+
+    while(program->count) {
+
+        lval* x = lval_pop(program, 0);
+
+        if(depth > 0 && laot_is_load(x)) {
+            lval* loaded = laot_read(lval_index(x, 1)->str);
+            if(lval_type(loaded) != LVAL_ERR) {
+                lval_del(x);
+                laot_splice(forms, loaded, depth - 1);
+                continue;
+            }
+            lval_del(loaded);
+        }
+
+        lval_add(forms, x);
+
+    }
+
+    lval_del(program);
+
+}
+
+// True if code and other are the same instructions on the same symbols.
+static bool laot_same(lcode* code, lcode* other) {
+
+    if(code->op_count != other->op_count || code->name_count != other->name_count
+            || memcmp(code->ops, other->ops, sizeof(int) * code->op_count) != 0) {
+        return false;
+    }
+
+    for(int i = 0; i < code->name_count; ++i) {
+        if(strcmp(code->names[i], other->names[i]) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+
+}
+
+// Compile the lambda of the symbols of formals from the first'th on and
+// body, keeping it if it compiles to code not seen yet.
+static void laot_try(struct laot_funs* s, lval* formals, int first, lval* body) {
+
+    lval* syms = lval_qexpr();
+    for(int i = first; i < formals->count; ++i) {
+        syms = lval_add(syms, lval_copy(lval_index(formals, i)));
+    }
+    int arity = syms->count;
+    lval* f = lval_lambda(syms, lval_copy(body));
+
+    if(!lvm_can_call(f, arity)) {
+        lval_del(f);
+        return;
+    }
+
+    for(int i = 0; i < s->count; ++i) {
+        if(laot_same(f->code, s->funs[i]->code)) {
+            lval_del(f);
+            return;
+        }
+    }
+
+    if(s->count == s->capacity) {
+        s->capacity = s->capacity ? 2 * s->capacity : 16;
+        s->funs = realloc(s->funs, sizeof(lval*) * s->capacity);
+    }
+    s->funs[s->count++] = f;
+
+}
+
+// True if x is a Q-Expression of symbols only.
+static bool laot_is_formals(lval* x) {
+
+    if(lval_type(x) != LVAL_QEXPR) {
+        return false;
+    }
+
+    for(int i = 0; i < x->count; ++i) {
+        if(lval_type(lval_index(x, i)) != LVAL_SYM) {
+            return false;
+        }
+    }
+
+    return true;
+
+}
+
+// Compile every lambda that x could make, wherever it is nested.
+static void laot_find(struct laot_funs* s, lval* x) {
+
+    if(lval_type(x) != LVAL_SEXPR && lval_type(x) != LVAL_QEXPR) {
+        return;
+    }
+
+    for(int i = 0; i < x->count; ++i) {
+
+        lval* y = lval_index(x, i);
+        laot_find(s, y);
+
+        if(i + 1 < x->count && laot_is_formals(y) && lval_type(lval_index(x, i + 1)) == LVAL_QEXPR) {
+            laot_try(s, y, 0, lval_index(x, i + 1));
+            if(y->count) {
+                laot_try(s, y, 1, lval_index(x, i + 1));
+            }
+        }
+
+    }
+
+}
+
+// Write s as a C string literal.
+static void laot_string(FILE* out, char* s) {
+
+    fputc('"', out);
+
+    for(unsigned char* c = (unsigned char*)s; *c; ++c) {
+        if(*c == '"' || *c == '\\' || *c == '?') {
+            fprintf(out, "\\%c", *c);
+        } else if(*c < ' ' || *c > '~') {
+            fprintf(out, "\\%03o", *c);
+        } else {
+            fputc(*c, out);
+        }
+    }
+
+    fputc('"', out);
+
+}
+
+// Write a C expression making a new value equal to v, as read from source.
+static void laot_value(FILE* out, lval* v) {
+
+    switch(lval_type(v)) {
+
+        case LVAL_INT:
+            if(lval_int_value(v) == INT64_MIN) {
+                fputs("lval_int(INT64_MIN)", out);
+            } else {
+                fprintf(out, "lval_int(INT64_C(%" PRId64 "))", lval_int_value(v));
+            }
+            break;
+
+        case LVAL_BIG: {
+            char* digits = lbig_to_str(v->big);
+            fprintf(out, "lval_big(lbig_read(\"%s\"))", digits);
+            free(digits);
+            break;
+        }
+
+        // Written in hexadecimal, which is exact.
+        case LVAL_NUM:
+            fprintf(out, "lval_num(%a)", lval_num_value(v));
+            break;
+
+        case LVAL_BOOL:
+            fputs(v->val ? "lval_bool(true)" : "lval_bool(false)", out);
+            break;
+
+        case LVAL_SYM:
+            fputs("lval_sym(", out);
+            laot_string(out, v->sym);
+            fputc(')', out);
+            break;
+
+        case LVAL_STR:
+            fputs("lval_str(", out);
+            laot_string(out, v->str);
+            fputc(')', out);
+            break;
+
+        case LVAL_SEXPR:
+        case LVAL_QEXPR: {
+            int chunks = (v->count + LAOT_CHUNK - 1) / LAOT_CHUNK;
+            for(int i = 0; i < chunks; ++i) {
+                fputs("blisp_list(", out);
+            }
+            fputs(lval_type(v) == LVAL_SEXPR ? "lval_sexpr()" : "lval_qexpr()", out);
+            for(int i = 0; i < chunks; ++i) {
+                int start = i * LAOT_CHUNK;
+                int n = v->count - start < LAOT_CHUNK ? v->count - start : LAOT_CHUNK;
+                fprintf(out, ", %d", n);
+                for(int j = start; j < start + n; ++j) {
+                    fputs(", ", out);
+                    laot_value(out, lval_index(v, j));
+                }
+                fputc(')', out);
+            }
+            break;
+        }
+
+        // Errors, such as numbers out of range. Nothing else is read.
+        default:
+            fputs("lval_err(\"%s\", ", out);
+            laot_string(out, lval_type(v) == LVAL_ERR ? v->err : "Cannot compile value");
+            fputc(')', out);
+            break;
+
+    }
+
+}
+
+// Write a C function named blisp_code_<index> doing the instructions of
+// code.
+static void laot_code(FILE* out, lcode* code, int index) {
+
+    int* ops = code->ops;
+
+    // Jump targets get labels, and status is only needed with a call.
+    bool* targets = calloc(code->op_count, sizeof(bool));
+    bool calls = false;
+    for(int pc = 0; pc < code->op_count; pc += lvm_op_size[ops[pc]]) {
+        switch(ops[pc]) {
+            case LVM_IF:
+                targets[ops[pc + 2]] = true;
+                break;
+            case LVM_BRANCH:
+                targets[ops[pc + 3]] = true;
+                break;
+            case LVM_JUMP:
+                targets[ops[pc + 1]] = true;
+                break;
+        }
+        switch(ops[pc]) {
+            case LVM_CONST:
+            case LVM_LOCAL:
+            case LVM_JUMP:
+            case LVM_TAILCALL:
+            case LVM_RETURN:
+            case LVM_LOCAL_LOCAL:
+            case LVM_LOCAL_CONST:
+                break;
+            default:
+                calls = true;
+                break;
+        }
+    }
+
+    fprintf(out, "// \\ {");
+    for(int i = 0; i < code->arity; ++i) {
+        bool rest = code->variadic && i == code->arity - 1;
+        fprintf(out, i ? " %s%s" : "%s%s", rest ? "& " : "", code->formals[i]);
+    }
+    fprintf(out, "}\nstatic int blisp_code_%d(lcode* code, int pc, lenv* env) {\n\n", index);
+    if(calls) {
+        fprintf(out, "    int status;\n\n");
+    }
+    fprintf(out, "    switch(pc) {\n");
+
+    for(int pc = 0; pc < code->op_count; pc += lvm_op_size[ops[pc]]) {
+
+        int op = ops[pc];
+        int next = pc + lvm_op_size[op];
+        fprintf(out, "    case %d:\n", pc);
+        if(targets[pc]) {
+            fprintf(out, "    l%d:\n", pc);
+        }
+
+        // The first half of a superinstruction.
+        switch(op) {
+            case LVM_CONST:
+            case LVM_CONST_CALL:
+                fprintf(out, "        blisp_push(lval_copy(code->consts[%d]));\n", ops[pc + 1]);
+                break;
+            case LVM_LOCAL:
+            case LVM_LOCAL_LOCAL:
+            case LVM_LOCAL_CONST:
+            case LVM_LOCAL_CALL:
+                fprintf(out, "        blisp_push(lval_copy(env->vals[%d]));\n", ops[pc + 1]);
+                break;
+            case LVM_GLOBAL:
+            case LVM_GLOBAL_LOCAL:
+            case LVM_GLOBAL_GLOBAL:
+                fprintf(out, "        BLISP_DO(lvm_do_global(env, code->names[%d]), %d);\n",
+                        ops[pc + 1], next);
+                break;
+        }
+
+        switch(op) {
+
+            // Done above.
+            case LVM_CONST:
+            case LVM_LOCAL:
+            case LVM_GLOBAL:
+                break;
+
+            case LVM_GLOBAL_LOCAL:
+            case LVM_LOCAL_LOCAL:
+                fprintf(out, "        blisp_push(lval_copy(env->vals[%d]));\n", ops[pc + 2]);
+                break;
+
+            case LVM_GLOBAL_GLOBAL:
+                fprintf(out, "        BLISP_DO(lvm_do_global(env, code->names[%d]), %d);\n",
+                        ops[pc + 2], next);
+                break;
+
+            case LVM_LOCAL_CONST:
+                fprintf(out, "        blisp_push(lval_copy(code->consts[%d]));\n", ops[pc + 2]);
+                break;
+
+            case LVM_CALL:
+            case LVM_LOCAL_CALL:
+            case LVM_CONST_CALL:
+                fprintf(out, "        BLISP_DO(lvm_do_call(env, %d), %d);\n", ops[next - 1], next);
+                break;
+
+            case LVM_IF:
+                fprintf(out, "        BLISP_TEST(lvm_do_if(env, code->names[%d]), l%d, %d);\n",
+                        ops[pc + 1], ops[pc + 2], next);
+                break;
+
+            case LVM_BRANCH:
+                fprintf(out, "        BLISP_TEST(blisp_branch(env, &code->consts[%d], &code->consts[%d]), "
+                        "l%d, %d);\n", ops[pc + 1], ops[pc + 2], ops[pc + 3], next);
+                break;
+
+            case LVM_JUMP:
+                fprintf(out, "        goto l%d;\n", ops[pc + 1]);
+                break;
+
+            case LVM_TAILCALL:
+                fprintf(out, "        return BLISP_EXIT(LVM_EXIT_TAILCALL, %d);\n", pc);
+                break;
+
+            case LVM_RETURN:
+                fprintf(out, "        return BLISP_EXIT(LVM_EXIT_RETURN, %d);\n", pc);
+                break;
+
+            // Arithmetic and comparison.
+            default:
+                fprintf(out, "        BLISP_DO(lvm_do_typed[%d](env, code->names[%d], %d), %d);\n",
+                        op - LVM_ADD, ops[pc + 1], ops[pc + 2], next);
+                break;
+        }
+
+    }
+
+    fprintf(out, "    }\n\n    abort();\n\n}\n\n");
+
+    free(targets);
+
+}
+
+// Write the arrays of the instructions and symbols of code to register
+// blisp_code_<index> with.
+static void laot_arrays(FILE* out, lcode* code, int index) {
+
+    fprintf(out, "static const int blisp_ops_%d[] = {", index);
+    for(int pc = 0; pc < code->op_count; ++pc) {
+        fprintf(out, pc ? ", %d" : " %d", code->ops[pc]);
+    }
+    fprintf(out, " };\n");
+
+    fprintf(out, "static char* const blisp_names_%d[] = {", index);
+    for(int i = 0; i < code->name_count; ++i) {
+        fputs(i ? ", " : " ", out);
+        laot_string(out, code->names[i]);
+    }
+    fprintf(out, code->name_count ? " };\n\n" : " NULL };\n\n");
+
+}
+
+// What all generated C starts with.
+static const char* laot_prelude =
+    "#include \"ljit.h\"\n"
+    "#include \"lval.h\"\n"
+    "\n"
+    "// Leave to the instruction loop with status at pc.\n"
+    "#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))\n"
+    "\n"
+    "// Do an instruction by calling the VM, leaving to carry on at next if it\n"
+    "// says to.\n"
+    "#define BLISP_DO(call, next) \\\n"
+    "    if((status = (call))) { \\\n"
+    "        return BLISP_EXIT(status, next); \\\n"
+    "    }\n"
+    "\n"
+    "// The same for one that may jump to label instead.\n"
+    "#define BLISP_TEST(call, label, next) \\\n"
+    "    if((status = (call)) < 0) { \\\n"
+    "        goto label; \\\n"
+    "    } else if(status) { \\\n"
+    "        return BLISP_EXIT(status, next); \\\n"
+    "    }\n"
+    "\n"
+    "// Push x onto the stack of the VM.\n"
+    "static inline void blisp_push(lval* x) {\n"
+    "\n"
+    "    (*lvm_stack)[(*lvm_height)++] = x;\n"
+    "\n"
+    "}\n"
+    "\n"
+    "// BRANCH, testing a Boolean here.\n"
+    "static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {\n"
+    "\n"
+    "    lval* cond = (*lvm_stack)[*lvm_height - 1];\n"
+    "\n"
+    "    if(lval_type(cond) != LVAL_BOOL) {\n"
+    "        return lvm_do_branch(env, then, otherwise);\n"
+    "    }\n"
+    "\n"
+    "    bool val = cond->val;\n"
+    "    (*lvm_height)--;\n"
+    "    lval_del(cond);\n"
+    "    return val ? LVM_EXIT_NONE : -1;\n"
+    "\n"
+    "}\n"
+    "\n";
+
+// What generated programs go on with.
+static const char* laot_program_prelude =
+    "// Add the n values after n to list x.\n"
+    "static lval* blisp_list(lval* x, int n, ...) {\n"
+    "\n"
+    "    va_list values;\n"
+    "    va_start(values, n);\n"
+    "    while(n--) {\n"
+    "        x = lval_add(x, va_arg(values, lval*));\n"
+    "    }\n"
+    "    va_end(values);\n"
+    "\n"
+    "    return x;\n"
+    "\n"
+    "}\n"
+    "\n";
+
+// Write C for the program in file filename to out.
+bool laot_emit(FILE* out, char* filename) {
+
+    lval* program = laot_read(filename);
+    if(lval_type(program) == LVAL_ERR) {
+        fprintf(stderr, "Error: %s\n", program->err);
+        lval_del(program);
+        return false;
+    }
+
+    lval* forms = lval_sexpr();
+    laot_splice(forms, program, LAOT_LOAD_DEPTH);
+
+    struct laot_funs s = { NULL, 0, 0 };
+    laot_find(&s, forms);
+
+    fprintf(out, "// Generated by blisp --emit-c from %s.\n", filename);
+    fputs(laot_prelude, out);
+    fputs(laot_program_prelude, out);
+
+    for(int i = 0; i < s.count; ++i) {
+        laot_code(out, s.funs[i]->code, i);
+        laot_arrays(out, s.funs[i]->code, i);
+    }
+
+    fprintf(out, "// The program's expressions.\nstatic lval* blisp_program(void) {\n\n");
+    fprintf(out, "    lval* x = lval_sexpr();\n");
+    for(int i = 0; i < forms->count; ++i) {
+        fputs("    x = lval_add(x, ", out);
+        laot_value(out, lval_index(forms, i));
+        fputs(");\n", out);
+    }
+    fprintf(out, "    return x;\n\n}\n\n");
+
+    fprintf(out,
+            "int main(void) {\n"
+            "\n"
+            "    lval_read_init();\n"
+            "    lenv* e = lenv_new();\n"
+            "    lenv_add_builtins(e);\n"
+            "    lgc_set_global(e);\n"
+            "    lvm_init(e);\n"
+            "\n"
+            "    if(getenv(\"BLISP_GC_STRESS\")) {\n"
+            "        lgc_set_stress(true);\n"
+            "    }\n"
+            "    if(getenv(\"BLISP_STACK_MB\")) {\n"
+            "        lvm_set_limit((size_t)atol(getenv(\"BLISP_STACK_MB\")) << 20);\n"
+            "    }\n"
+            "    if(getenv(\"BLISP_JIT\")) {\n"
+            "        lvm_set_jit(true);\n"
+            "    }\n"
+            "    if(getenv(\"BLISP_PERF_MAP\")) {\n"
+            "        ljit_set_perf_map(true);\n"
+            "    }\n"
+            "\n");
+    for(int i = 0; i < s.count; ++i) {
+        fprintf(out, "    lvm_register(blisp_ops_%d, %d, blisp_names_%d, %d, blisp_code_%d);\n",
+                i, s.funs[i]->code->op_count, i, s.funs[i]->code->name_count, i);
+    }
+    fprintf(out,
+            "\n"
+            "    lval_eval_all(e, blisp_program());\n"
+            "    lenv_del(e);\n"
+            "    return 0;\n"
+            "\n"
+            "}\n");
+
+    for(int i = 0; i < s.count; ++i) {
+        lval_del(s.funs[i]);
+    }
+    free(s.funs);
+    lval_del(forms);
+
+    return true;
+
+}
+
+#ifndef _WIN32
+// FNV-1a hash of string s, going on from hash h.
+static uint64_t laot_hash(char* s, uint64_t h) {
+
+    for(unsigned char* c = (unsigned char*)s; *c; ++c) {
+        h = (h ^ *c) * 0x100000001b3;
+    }
+
+    return h;
+
+}
+
+// Put the name in directory dir of the file for hash, with suffix, into
+// path, which the directory leaves room for.
+static void laot_cache_file(char* path, char* dir, uint64_t hash, char* suffix) {
+
+    if(snprintf(path, LAOT_PATH_MAX, "%s/%016" PRIx64 "%s", dir, hash, suffix) >= LAOT_PATH_MAX) {
+        path[0] = '\0';
+    }
+
+}
+
+// True if path names, without following links, a file of the given type
+// that belongs to this user and that no one else may write to.
+static bool laot_owned(char* path, mode_t type) {
+
+    struct stat st;
+    return lstat(path, &st) == 0 && (st.st_mode & S_IFMT) == type
+           && st.st_uid == geteuid() && !(st.st_mode & (S_IWGRP | S_IWOTH));
+
+}
+
+// Put the directory to cache libraries in into path, creating it and its
+// parents, readable only by this user. Returns false with error set if
+// there is none to use, it cannot be made, or anyone else could put a
+// library in it.
+static bool laot_cache_dir(char* path, lval** error) {
+
+    int length;
+    if(getenv("BLISP_CACHE")) {
+        length = snprintf(path, LAOT_PATH_MAX, "%s", getenv("BLISP_CACHE"));
+    } else if(getenv("XDG_CACHE_HOME")) {
+        length = snprintf(path, LAOT_PATH_MAX, "%s/blisp", getenv("XDG_CACHE_HOME"));
+    } else if(getenv("HOME")) {
+        length = snprintf(path, LAOT_PATH_MAX, "%s/.cache/blisp", getenv("HOME"));
+    } else {
+        *error = lval_err("Function 'compile' needs BLISP_CACHE or HOME set to cache in.");
+        return false;
+    }
+
+    if(length == 0 || length >= LAOT_PATH_MAX - 64 || strchr(path, '\'')) {
+        *error = lval_err("Function 'compile' cannot use cache directory %s", path);
+        return false;
+    }
+
+    // Only directories that are there already may fail.
+    for(char* c = strchr(path + 1, '/'); c; c = strchr(c + 1, '/')) {
+        *c = '\0';
+        bool made = mkdir(path, 0700) == 0 || errno == EEXIST;
+        *c = '/';
+        if(!made) {
+            break;
+        }
+    }
+    if(mkdir(path, 0700) != 0 && errno != EEXIST) {
+        *error = lval_err("Function 'compile' could not make cache directory %s: %s",
+                          path, strerror(errno));
+        return false;
+    }
+
+    if(!laot_owned(path, S_IFDIR)) {
+        *error = lval_err("Function 'compile' will not use cache directory %s: "
+                          "it must be a directory of yours that no one else can write to.", path);
+        return false;
+    }
+
+    return true;
+
+}
+
+// Write C for code's native code, build it in the cache unless it is there
+// already, and load it. Returns the native code, or NULL with error set.
+static lvm_native laot_build(lcode* code, lval** error) {
+
+    char* source;
+    size_t size;
+    FILE* out = open_memstream(&source, &size);
+    fputs("// Compiled by blisp's compile.\n", out);
+    fputs(laot_prelude, out);
+    laot_code(out, code, 0);
+    fputs("lvm_native blisp_native = blisp_code_0;\n", out);
+    fclose(out);
+
+    // Libraries are named by a hash of their C, how it is compiled, and the
+    // build of blisp it is for.
+    char command[3 * LAOT_PATH_MAX];
+    int length = snprintf(command, LAOT_PATH_MAX, "%s -std=c11 -O2 %s %s -I'%s'",
+            getenv("CC") ? getenv("CC") : "cc", LAOT_SHARED,
+            getenv("BLISP_CFLAGS") ? getenv("BLISP_CFLAGS") : "", LAOT_INCLUDE);
+    uint64_t hash = laot_hash(source, 0xcbf29ce484222325);
+    hash = laot_hash(LAOT_ABI, laot_hash(command, hash));
+
+    char dir[LAOT_PATH_MAX];
+    char lib[LAOT_PATH_MAX];
+    if(length >= LAOT_PATH_MAX) {
+        free(source);
+        *error = lval_err("Function 'compile' given too long a command to build with.");
+        return NULL;
+    }
+    if(!laot_cache_dir(dir, error)) {
+        free(source);
+        return NULL;
+    }
+    laot_cache_file(lib, dir, hash, ".so");
+
+    // Built under names of this process's own, then renamed into place only
+    // once the library is built, so that sessions sharing the cache never
+    // load half a library nor find what a failed build left. The C is kept
+    // beside it.
+    if(access(lib, R_OK) != 0) {
+
+        char c_file[LAOT_PATH_MAX];
+        char c_tmp[LAOT_PATH_MAX];
+        char lib_tmp[LAOT_PATH_MAX];
+        char suffix[32];
+        laot_cache_file(c_file, dir, hash, ".c");
+        snprintf(suffix, sizeof(suffix), "-%ld.c", (long)getpid());
+        laot_cache_file(c_tmp, dir, hash, suffix);
+        snprintf(suffix, sizeof(suffix), "-%ld.so", (long)getpid());
+        laot_cache_file(lib_tmp, dir, hash, suffix);
+
+        FILE* file = fopen(c_tmp, "w");
+        bool built = file && fputs(source, file) >= 0;
+        if(file) {
+            built &= fclose(file) == 0;
+        }
+
+        sprintf(command + length, " -o '%s' '%s'", lib_tmp, c_tmp);
+        built = built && system(command) == 0 && chmod(lib_tmp, 0700) == 0
+                && rename(c_tmp, c_file) == 0 && rename(lib_tmp, lib) == 0;
+
+        if(!built) {
+            remove(c_tmp);
+            remove(lib_tmp);
+            free(source);
+            *error = lval_err("Function 'compile' could not build %s", lib);
+            return NULL;
+        }
+
+    }
+    free(source);
+
+    // Loaded for good, since compiled code may run it at any time. Only a
+    // library of this user's own is run at all.
+    if(!laot_owned(lib, S_IFREG)) {
+        *error = lval_err("Function 'compile' will not load %s: "
+                          "it must be a file of yours that no one else can write to.", lib);
+        return NULL;
+    }
+    void* handle = dlopen(lib, RTLD_NOW);
+    lvm_native* native = handle ? dlsym(handle, "blisp_native") : NULL;
+    if(!native) {
+        *error = lval_err("Function 'compile' could not load %s: %s", lib, dlerror());
+        return NULL;
+    }
+
+    return *native;
+
+}
+#endif
+
+// Compile lambda f to native code through the system C compiler.
+lval* laot_compile(lval* f) {
+
+    lval* g = lval_is_partial(f) ? f->target : f;
+
+    if(!lvm_can_call(g, g->formals->count)) {
+        lval_del(f);
+        return lval_err("Function 'compile' passed a function that cannot be compiled.");
+    }
+
+#ifdef _WIN32
+    lval_del(f);
+    return lval_err("Function 'compile' is not supported on Windows.");
+#else
+    lval* error = NULL;
+    lvm_native native = laot_build(g->code, &error);
+
+    if(!native) {
+        lval_del(f);
+        return error;
+    }
+
+    g->code->native = native;
+    return f;
+#endif
+
+}
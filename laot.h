@@ -0,0 +1,59 @@
+#ifndef LAOT_H
+#define LAOT_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "lval.h"
+
+// Directory of the runtime's headers, for C compiled at run time by
+// laot_compile. The Makefile sets it to the source directory.
+#ifndef LAOT_INCLUDE
+#define LAOT_INCLUDE "."
+#endif
+
+// Identifies how this build lays out values, compiled code and the VM's
+// functions, for laot_compile's cache. The Makefile sets it from the
+// headers and CFLAGS; otherwise every build is taken to be different.
+#ifndef LAOT_ABI
+#define LAOT_ABI __DATE__ " " __TIME__
+#endif
+
+// Files named by a literal in a top-level load are read in when compiling,
+// to this depth of loads within loads.
+#ifndef LAOT_LOAD_DEPTH
+#define LAOT_LOAD_DEPTH 16
+#endif
+
+// Ahead-of-time compilation of a Blisp program to C. The C program builds
+// the program's expressions directly, so nothing is parsed when it runs,
+// and evaluates them one by one as loading the file would, then exits.
+//
+// Lambdas are made at run time from Q-Expressions, so every pair of a
+// literal Q-Expression of symbols followed by another is taken for the
+// formals and body of one, with and without its first symbol as fun has
+// it. Each is compiled to bytecode and from that to a C function that does
+// its instructions, reading arguments straight from their slots and
+// calling the VM's functions for the rest (see lvm_do_global). Whatever is
+// compiled at run time to the same instructions runs that function instead,
+// so the C only has to be linked with the usual runtime: every object of
+// blisp but blisp.o.
+
+// Write C for the program in file filename to out. Returns false, having
+// said why on stderr, if the file cannot be read.
+bool laot_emit(FILE* out, char* filename);
+
+// Compile user-defined function f, or the lambda of partial application
+// f, the same way on its own: its C is built by the system C compiler ($CC,
+// or cc, with $BLISP_CFLAGS added) into a library that is loaded and run
+// for it from then on, wherever it is shared. Libraries are kept in
+// $BLISP_CACHE, or blisp under $XDG_CACHE_HOME or ~/.cache, made readable
+// only by the user if missing; it and each library in it are used only if
+// they belong to the user and no one else can write to them. They are
+// named by a hash of their C, the command and LAOT_ABI, so later sessions
+// of the same build load them without building them again, and a rebuilt
+// blisp whose values or VM differ never loads one built for the old. The program must export
+// its symbols to libraries, as with -rdynamic. Returns f, or an error.
+// Consumes f.
+lval* laot_compile(lval* f);
+
+#endif
@@ -0,0 +1,821 @@
+#include <math.h>
+#include <stdio.h>
+#include "lbig.h"
+
+// Magnitudes below are plain limb arrays with explicit lengths. Bignums use
+// base 2^32, but printing converts to base 10^9, so the add, subtract and
+// multiply helpers take the radix to work in, where 0 stands for 2^32.
+#define LBIG_DECIMAL 1000000000u
+
+// Magnitudes at most this many limbs long are converted to decimal by
+// repeated division, longer ones by splitting them in two.
+#define LBIG_DECIMAL_SPLIT 64
+
+// A base 10^9 magnitude, least significant digit first.
+struct lbig_digits {
+    uint32_t* digit;
+    int count;
+};
+
+// Split t into the limb to store and the carry into the next one.
+static inline uint32_t lbig_split(uint64_t t, uint32_t radix, uint64_t* carry) {
+
+    if(!radix) {
+        *carry = t >> 32;
+        return (uint32_t)t;
+    }
+
+    *carry = t / radix;
+    return (uint32_t)(t % radix);
+
+}
+
+// Length of a limb array without its leading zeros.
+static int nat_len(const uint32_t* a, int n) {
+
+    while(n > 0 && a[n - 1] == 0) {
+        n--;
+    }
+
+    return n;
+
+}
+
+// Compare two magnitudes without leading zeros.
+static int nat_cmp(const uint32_t* a, int an, const uint32_t* b, int bn) {
+
+    if(an != bn) {
+        return an < bn ? -1 : 1;
+    }
+
+    for(int i = an - 1; i >= 0; --i) {
+        if(a[i] != b[i]) {
+            return a[i] < b[i] ? -1 : 1;
+        }
+    }
+
+    return 0;
+
+}
+
+// r = a + b, where an >= bn and r has room for an limbs. Returns the carry
+// out of the top limb. r may be a.
+static uint32_t nat_add(uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn, uint32_t radix) {
+
+    uint64_t carry = 0;
+
+    for(int i = 0; i < an; ++i) {
+        r[i] = lbig_split((uint64_t)a[i] + (i < bn ? b[i] : 0) + carry, radix, &carry);
+    }
+
+    return (uint32_t)carry;
+
+}
+
+// r = a - b, where a >= b and r has room for an limbs. r may be a.
+static void nat_sub(uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn, uint32_t radix) {
+
+    int64_t base = radix ? radix : (int64_t)1 << 32;
+    int64_t borrow = 0;
+
+    for(int i = 0; i < an; ++i) {
+        int64_t t = (int64_t)a[i] - (i < bn ? b[i] : 0) - borrow;
+        borrow = t < 0;
+        r[i] = (uint32_t)(borrow ? t + base : t);
+    }
+
+}
+
+// r += x, carrying as far as needed within the rn limbs of r.
+static void nat_add_into(uint32_t* r, int rn, const uint32_t* x, int xn, uint32_t radix) {
+
+    uint64_t carry = 0;
+    int i = 0;
+
+    for(; i < xn; ++i) {
+        r[i] = lbig_split((uint64_t)r[i] + x[i] + carry, radix, &carry);
+    }
+    for(; carry && i < rn; ++i) {
+        r[i] = lbig_split((uint64_t)r[i] + carry, radix, &carry);
+    }
+
+}
+
+// r -= x, borrowing as far as needed within the rn limbs of r.
+static void nat_sub_into(uint32_t* r, int rn, const uint32_t* x, int xn, uint32_t radix) {
+
+    int64_t base = radix ? radix : (int64_t)1 << 32;
+    int64_t borrow = 0;
+    int i = 0;
+
+    for(; i < xn || (borrow && i < rn); ++i) {
+        int64_t t = (int64_t)r[i] - (i < xn ? x[i] : 0) - borrow;
+        borrow = t < 0;
+        r[i] = (uint32_t)(borrow ? t + base : t);
+    }
+
+}
+
+// r = a * b by the schoolbook method. r has room for an + bn limbs and
+// overlaps neither operand.
+static void nat_mul_school(uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn, uint32_t radix) {
+
+    memset(r, 0, sizeof(uint32_t) * (an + bn));
+
+    for(int i = 0; i < an; ++i) {
+
+        if(!a[i]) {
+            continue;
+        }
+
+        uint64_t carry = 0;
+
+        // Keep the common binary case free of divisions.
+        if(!radix) {
+            for(int j = 0; j < bn; ++j) {
+                uint64_t t = (uint64_t)a[i] * b[j] + r[i + j] + carry;
+                r[i + j] = (uint32_t)t;
+                carry = t >> 32;
+            }
+        } else {
+            for(int j = 0; j < bn; ++j) {
+                uint64_t t = (uint64_t)a[i] * b[j] + r[i + j] + carry;
+                r[i + j] = (uint32_t)(t % radix);
+                carry = t / radix;
+            }
+        }
+
+        r[i + bn] = (uint32_t)carry;
+
+    }
+
+}
+
+// r = a * b, by Karatsuba's method once both operands are long enough. r
+// has room for an + bn limbs and overlaps neither operand.
+static void nat_mul(uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn, uint32_t radix) {
+
+    // Let a be the longer operand.
+    if(an < bn) {
+        const uint32_t* t = a;
+        a = b;
+        b = t;
+        int tn = an;
+        an = bn;
+        bn = tn;
+    }
+
+    // Below three limbs the sums of halves, of h + 1 limbs, would be no
+    // shorter than a, so however low LBIG_KARATSUBA is set they go by the
+    // schoolbook method too.
+    int h = (an + 1) / 2;
+    if(bn < LBIG_KARATSUBA || h + 1 >= an) {
+        nat_mul_school(r, a, an, b, bn, radix);
+        return;
+    }
+
+    // b is too short to split at h: multiply it by a piece of a at a time.
+    if(bn <= h) {
+        memset(r, 0, sizeof(uint32_t) * (an + bn));
+        uint32_t* t = malloc(sizeof(uint32_t) * 2 * bn);
+        for(int i = 0; i < an; i += bn) {
+            int n = an - i < bn ? an - i : bn;
+            nat_mul(t, a + i, n, b, bn, radix);
+            nat_add_into(r + i, an + bn - i, t, n + bn, radix);
+        }
+        free(t);
+        return;
+    }
+
+    // With a = a1 B^h + a0 and b = b1 B^h + b0, a b = z2 B^2h + z1 B^h + z0
+    // where z0 = a0 b0, z2 = a1 b1 and z1 = (a0 + a1)(b0 + b1) - z0 - z2.
+    int an1 = an - h;
+    int bn1 = bn - h;
+
+    nat_mul(r, a, h, b, h, radix);
+    nat_mul(r + 2 * h, a + h, an1, b + h, bn1, radix);
+
+    uint32_t* sa = malloc(sizeof(uint32_t) * (4 * h + 4));
+    uint32_t* sb = sa + h + 1;
+    uint32_t* z1 = sb + h + 1;
+
+    sa[h] = nat_add(sa, a, h, a + h, an1, radix);
+    sb[h] = nat_add(sb, b, h, b + h, bn1, radix);
+    nat_mul(z1, sa, h + 1, sb, h + 1, radix);
+    nat_sub_into(z1, 2 * h + 2, r, 2 * h, radix);
+    nat_sub_into(z1, 2 * h + 2, r + 2 * h, an1 + bn1, radix);
+    nat_add_into(r + h, an + bn - h, z1, nat_len(z1, 2 * h + 2), radix);
+
+    free(sa);
+
+}
+
+// q = a / b and r = a % b for binary magnitudes, by Knuth's algorithm D.
+// b has no leading zeros, an >= bn >= 1, q has room for an - bn + 1 limbs
+// and r for bn.
+static void nat_divmod(uint32_t* q, uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn) {
+
+    // Short division.
+    if(bn == 1) {
+        uint64_t rem = 0;
+        for(int i = an - 1; i >= 0; --i) {
+            uint64_t t = (rem << 32) | a[i];
+            q[i] = (uint32_t)(t / b[0]);
+            rem = t % b[0];
+        }
+        r[0] = (uint32_t)rem;
+        return;
+    }
+
+    // Shift both so the divisor's top bit is set, which keeps the estimated
+    // quotient digits within two of the truth.
+    int s = __builtin_clz(b[bn - 1]);
+    uint32_t* vn = malloc(sizeof(uint32_t) * (an + 1 + bn));
+    uint32_t* un = vn + bn;
+
+    for(int i = bn - 1; i > 0; --i) {
+        vn[i] = (b[i] << s) | (uint32_t)((uint64_t)b[i - 1] >> (32 - s));
+    }
+    vn[0] = b[0] << s;
+
+    un[an] = (uint32_t)((uint64_t)a[an - 1] >> (32 - s));
+    for(int i = an - 1; i > 0; --i) {
+        un[i] = (a[i] << s) | (uint32_t)((uint64_t)a[i - 1] >> (32 - s));
+    }
+    un[0] = a[0] << s;
+
+    for(int j = an - bn; j >= 0; --j) {
+
+        // Estimate the next quotient digit from the top limbs.
+        uint64_t top = ((uint64_t)un[j + bn] << 32) | un[j + bn - 1];
+        uint64_t qhat = top / vn[bn - 1];
+        uint64_t rhat = top % vn[bn - 1];
+
+        while(qhat >> 32 || qhat * vn[bn - 2] > ((rhat << 32) | un[j + bn - 2])) {
+            qhat--;
+            rhat += vn[bn - 1];
+            if(rhat >> 32) {
+                break;
+            }
+        }
+
+        // Subtract qhat times the divisor.
+        int64_t k = 0;
+        int64_t t;
+        for(int i = 0; i < bn; ++i) {
+            uint64_t p = qhat * vn[i];
+            t = (int64_t)un[i + j] - k - (int64_t)(p & 0xffffffff);
+            un[i + j] = (uint32_t)t;
+            k = (int64_t)(p >> 32) - (t >> 32);
+        }
+        t = (int64_t)un[j + bn] - k;
+        un[j + bn] = (uint32_t)t;
+
+        // It was one too many: add the divisor back.
+        if(t < 0) {
+            qhat--;
+            uint64_t carry = 0;
+            for(int i = 0; i < bn; ++i) {
+                uint64_t u = (uint64_t)un[i + j] + vn[i] + carry;
+                un[i + j] = (uint32_t)u;
+                carry = u >> 32;
+            }
+            un[j + bn] += (uint32_t)carry;
+        }
+
+        q[j] = (uint32_t)qhat;
+
+    }
+
+    // Shift the remainder back.
+    for(int i = 0; i < bn; ++i) {
+        r[i] = (un[i] >> s) | (uint32_t)((uint64_t)un[i + 1] << (32 - s));
+    }
+
+    free(vn);
+
+}
+
+// Bytes used by a bignum of count limbs.
+static size_t lbig_bytes(int count) {
+    return offsetof(lbig, limb) + sizeof(uint32_t) * count;
+}
+
+// Allocate a positive bignum of count limbs.
+static lbig* lbig_alloc(int count) {
+
+    lbig* x = lmem_alloc(lbig_bytes(count));
+    x->sign = 1;
+    x->count = count;
+
+    return x;
+
+}
+
+// Drop the leading zero limbs of a freshly computed bignum.
+static lbig* lbig_trim(lbig* x) {
+
+    int count = nat_len(x->limb, x->count);
+
+    if(count != x->count) {
+        x = lmem_realloc(x, lbig_bytes(x->count), lbig_bytes(count));
+        x->count = count;
+    }
+
+    // Zero is positive.
+    if(!count) {
+        x->sign = 1;
+    }
+
+    return x;
+
+}
+
+// Store x in space and return it as a bignum.
+lbig* lbig_set_int(lbig_int* space, int64_t x) {
+
+    lbig* b = &space->big;
+    uint64_t m = x < 0 ? -(uint64_t)x : (uint64_t)x;
+
+    b->sign = x < 0 ? -1 : 1;
+    b->limb[0] = (uint32_t)m;
+    b->limb[1] = (uint32_t)(m >> 32);
+    b->count = nat_len(b->limb, 2);
+
+    return b;
+
+}
+
+// Build a bignum from an integral, finite double.
+lbig* lbig_from_double(double x) {
+
+    // |x| = m 2^exp with m in [0.5, 1), so m 2^64 is an exact integer.
+    int exp;
+    double m = frexp(fabs(x), &exp);
+    if(exp <= 0) {
+        return lbig_alloc(0);
+    }
+
+    uint64_t mantissa = (uint64_t)ldexp(m, 64);
+    int shift = exp - 64;
+    if(shift < 0) {
+        mantissa >>= -shift;
+        shift = 0;
+    }
+
+    lbig* b = lbig_alloc(shift / 32 + 3);
+    memset(b->limb, 0, sizeof(uint32_t) * b->count);
+    for(int i = 0; i < 64; ++i) {
+        if(mantissa >> i & 1) {
+            b->limb[(shift + i) / 32] |= 1u << ((shift + i) % 32);
+        }
+    }
+
+    b->sign = x < 0 ? -1 : 1;
+    return lbig_trim(b);
+
+}
+
+// Parse a decimal integer with an optional leading '-'.
+lbig* lbig_read(char* s) {
+
+    int sign = 1;
+    if(*s == '-') {
+        sign = -1;
+        s++;
+    }
+
+    // Each group of nine digits adds at most one limb.
+    int len = strlen(s);
+    lbig* x = lbig_alloc(len / 9 + 1);
+    int n = 0;
+
+    for(int i = 0; i < len; ) {
+
+        // Take the odd-sized group first so the rest come in nines.
+        int take = (i == 0 && len % 9) ? len % 9 : 9;
+        uint64_t scale = 1;
+        uint64_t carry = 0;
+        for(int j = 0; j < take; ++j) {
+            carry = carry * 10 + (s[i + j] - '0');
+            scale *= 10;
+        }
+        i += take;
+
+        // x = x * 10^take + group
+        for(int j = 0; j < n; ++j) {
+            uint64_t t = x->limb[j] * scale + carry;
+            x->limb[j] = (uint32_t)t;
+            carry = t >> 32;
+        }
+        if(carry) {
+            x->limb[n++] = (uint32_t)carry;
+        }
+
+    }
+
+    x->count = n;
+    x = lmem_realloc(x, lbig_bytes(len / 9 + 1), lbig_bytes(n));
+    x->sign = n ? sign : 1;
+
+    return x;
+
+}
+
+// Copy a bignum.
+lbig* lbig_copy(lbig* x) {
+
+    lbig* c = lmem_alloc(lbig_bytes(x->count));
+    memcpy(c, x, lbig_bytes(x->count));
+
+    return c;
+
+}
+
+// Free a bignum.
+void lbig_free(lbig* x) {
+    lmem_free(x, lbig_bytes(x->count));
+}
+
+// Store x in *out and return true if it fits in an int64_t.
+bool lbig_to_int(lbig* x, int64_t* out) {
+
+    if(x->count > 2) {
+        return false;
+    }
+
+    uint64_t m = 0;
+    for(int i = x->count - 1; i >= 0; --i) {
+        m = (m << 32) | x->limb[i];
+    }
+
+    if(m > (uint64_t)INT64_MAX + (x->sign < 0)) {
+        return false;
+    }
+
+    *out = x->sign < 0 ? (int64_t)(0 - m) : (int64_t)m;
+    return true;
+
+}
+
+// x as m 2^exp, with m from the top three limbs.
+static double lbig_frexp(lbig* x, long* exp) {
+
+    int top = x->count < 3 ? x->count : 3;
+    double m = 0;
+
+    for(int i = 1; i <= top; ++i) {
+        m = m * 4294967296.0 + x->limb[x->count - i];
+    }
+
+    *exp = 32L * (x->count - top);
+    return x->sign * m;
+
+}
+
+// Nearest double to x.
+double lbig_to_double(lbig* x) {
+
+    long exp;
+    double m = lbig_frexp(x, &exp);
+
+    return ldexp(m, exp > INT32_MAX ? INT32_MAX : exp);
+
+}
+
+// Nearest double to x / y, even where x and y are out of double range.
+double lbig_ratio(lbig* x, lbig* y) {
+
+    long xe, ye;
+    double xm = lbig_frexp(x, &xe);
+    double ym = lbig_frexp(y, &ye);
+    long exp = xe - ye;
+
+    return ldexp(xm / ym, exp > INT32_MAX ? INT32_MAX : exp < INT32_MIN ? INT32_MIN : exp);
+
+}
+
+// Compare two bignums, returning -1, 0 or 1.
+int lbig_cmp(lbig* x, lbig* y) {
+
+    if(x->sign != y->sign) {
+        return x->sign;
+    }
+
+    return x->sign * nat_cmp(x->limb, x->count, y->limb, y->count);
+
+}
+
+// Return -x.
+lbig* lbig_neg(lbig* x) {
+
+    lbig* n = lbig_copy(x);
+    if(n->count) {
+        n->sign = -n->sign;
+    }
+
+    return n;
+
+}
+
+// Return x plus y's magnitude with the given sign.
+static lbig* lbig_add_signed(lbig* x, lbig* y, int sign) {
+
+    // Same signs: add the magnitudes.
+    if(x->sign == sign || !y->count) {
+        int r_sign = x->sign;
+        if(x->count < y->count) {
+            lbig* t = x;
+            x = y;
+            y = t;
+        }
+        lbig* r = lbig_alloc(x->count + 1);
+        r->limb[x->count] = nat_add(r->limb, x->limb, x->count, y->limb, y->count, 0);
+        r->sign = r_sign;
+        return lbig_trim(r);
+    }
+
+    // Otherwise subtract the smaller magnitude from the larger.
+    int c = nat_cmp(x->limb, x->count, y->limb, y->count);
+    lbig* r;
+
+    if(c >= 0) {
+        r = lbig_alloc(x->count);
+        nat_sub(r->limb, x->limb, x->count, y->limb, y->count, 0);
+        r->sign = x->sign;
+    } else {
+        r = lbig_alloc(y->count);
+        nat_sub(r->limb, y->limb, y->count, x->limb, x->count, 0);
+        r->sign = sign;
+    }
+
+    return lbig_trim(r);
+
+}
+
+// Return x + y.
+lbig* lbig_add(lbig* x, lbig* y) {
+    return lbig_add_signed(x, y, y->sign);
+}
+
+// Return x - y.
+lbig* lbig_sub(lbig* x, lbig* y) {
+    return lbig_add_signed(x, y, -y->sign);
+}
+
+// Return x * y, whatever its length.
+static lbig* lbig_mul_any(lbig* x, lbig* y) {
+
+    if(!x->count || !y->count) {
+        return lbig_alloc(0);
+    }
+
+    lbig* r = lbig_alloc(x->count + y->count);
+    nat_mul(r->limb, x->limb, x->count, y->limb, y->count, 0);
+    r->sign = x->sign * y->sign;
+
+    return lbig_trim(r);
+
+}
+
+// Return x * y, or NULL if it would exceed LBIG_MAX_LIMBS.
+lbig* lbig_mul(lbig* x, lbig* y) {
+    return x->count + y->count > LBIG_MAX_LIMBS ? NULL : lbig_mul_any(x, y);
+}
+
+// Return x / y rounded toward zero and store the remainder in *rem.
+lbig* lbig_divmod(lbig* x, lbig* y, lbig** rem) {
+
+    lbig* q;
+    lbig* r;
+
+    if(nat_cmp(x->limb, x->count, y->limb, y->count) < 0) {
+        q = lbig_alloc(0);
+        r = lbig_copy(x);
+    } else {
+        q = lbig_alloc(x->count - y->count + 1);
+        r = lbig_alloc(y->count);
+        nat_divmod(q->limb, r->limb, x->limb, x->count, y->limb, y->count);
+        q->sign = x->sign * y->sign;
+        r->sign = x->sign;
+        q = lbig_trim(q);
+        r = lbig_trim(r);
+    }
+
+    if(rem) {
+        *rem = r;
+    } else {
+        lbig_free(r);
+    }
+
+    return q;
+
+}
+
+// Return x to the power e, or NULL if it would exceed LBIG_MAX_LIMBS.
+lbig* lbig_pow(lbig* x, uint64_t e) {
+
+    // Check the size of the result up front.
+    if(x->count) {
+        uint64_t bits = 32 * (uint64_t)(x->count - 1) + 32 - __builtin_clz(x->limb[x->count - 1]);
+        if(bits > 1 && e > 32 * (uint64_t)LBIG_MAX_LIMBS / (bits - 1)) {
+            return NULL;
+        }
+    }
+
+    lbig_int one;
+    lbig* r = lbig_copy(lbig_set_int(&one, 1));
+    lbig* base = lbig_copy(x);
+
+    // Exponentiation by squaring.
+    while(e > 0) {
+        if(e & 1) {
+            lbig* t = lbig_mul_any(r, base);
+            lbig_free(r);
+            r = t;
+        }
+        e >>= 1;
+        if(e > 0) {
+            lbig* t = lbig_mul_any(base, base);
+            lbig_free(base);
+            base = t;
+        }
+    }
+
+    lbig_free(base);
+    return r;
+
+}
+
+// Return x mod |m|, between 0 and |m| - 1.
+static lbig* lbig_mod(lbig* x, lbig* m) {
+
+    lbig* r;
+    lbig_free(lbig_divmod(x, m, &r));
+
+    if(r->sign < 0) {
+        lbig* t = lbig_add_signed(r, m, 1);
+        lbig_free(r);
+        r = t;
+    }
+
+    return r;
+
+}
+
+// Return x to the power e modulo m, between 0 and |m| - 1.
+lbig* lbig_powmod(lbig* x, lbig* e, lbig* m) {
+
+    lbig_int one;
+    lbig* base = lbig_mod(x, m);
+    lbig* r = lbig_mod(lbig_set_int(&one, 1), m);
+
+    // Square and multiply from the top bit of e down, reducing each time so
+    // nothing grows past twice the length of m.
+    for(int i = e->count * 32 - 1; i >= 0; --i) {
+
+        lbig* t = lbig_mul_any(r, r);
+        lbig_free(r);
+        r = lbig_mod(t, m);
+        lbig_free(t);
+
+        if(e->limb[i / 32] >> (i % 32) & 1) {
+            t = lbig_mul_any(r, base);
+            lbig_free(r);
+            r = lbig_mod(t, m);
+            lbig_free(t);
+        }
+
+    }
+
+    lbig_free(base);
+    return r;
+
+}
+
+// Return 2^(32 2^j) in base 10^9, computing it from the smaller powers if
+// needed.
+static struct lbig_digits* lbig_power(struct lbig_digits* powers, int j) {
+
+    if(!powers[j].digit) {
+        if(j == 0) {
+            powers[0].digit = malloc(sizeof(uint32_t) * 2);
+            powers[0].digit[0] = 294967296;
+            powers[0].digit[1] = 4;
+            powers[0].count = 2;
+        } else {
+            struct lbig_digits* p = lbig_power(powers, j - 1);
+            powers[j].digit = malloc(sizeof(uint32_t) * 2 * p->count);
+            nat_mul(powers[j].digit, p->digit, p->count, p->digit, p->count, LBIG_DECIMAL);
+            powers[j].count = nat_len(powers[j].digit, 2 * p->count);
+        }
+    }
+
+    return &powers[j];
+
+}
+
+// Convert n binary limbs to base 10^9, storing the number of digits in
+// *count. Long inputs are split as hi 2^(32k) + lo and converted as
+// hi * 2^(32k) + lo in base 10^9, so the cost is that of Karatsuba
+// multiplication rather than the quadratic one of repeated division.
+static uint32_t* lbig_decimal(const uint32_t* a, int n, struct lbig_digits* powers, int* count) {
+
+    n = nat_len(a, n);
+
+    if(n <= LBIG_DECIMAL_SPLIT) {
+
+        // Each limb needs at most two digits.
+        uint32_t* d = malloc(sizeof(uint32_t) * (2 * n + 1));
+        uint32_t* t = malloc(sizeof(uint32_t) * (n + 1));
+        memcpy(t, a, sizeof(uint32_t) * n);
+        int dn = 0;
+
+        while(n > 0) {
+            uint64_t rem = 0;
+            for(int i = n - 1; i >= 0; --i) {
+                uint64_t u = (rem << 32) | t[i];
+                t[i] = (uint32_t)(u / LBIG_DECIMAL);
+                rem = u % LBIG_DECIMAL;
+            }
+            d[dn++] = (uint32_t)rem;
+            n = nat_len(t, n);
+        }
+
+        free(t);
+        *count = dn;
+        return d;
+
+    }
+
+    // Split at the largest power of two below n, so the powers of 2^32
+    // needed are shared by all the pieces.
+    int j = 0;
+    while((2 << j) < n) {
+        j++;
+    }
+    int k = 1 << j;
+
+    int lo_count, hi_count;
+    uint32_t* lo = lbig_decimal(a, k, powers, &lo_count);
+    uint32_t* hi = lbig_decimal(a + k, n - k, powers, &hi_count);
+    struct lbig_digits* p = lbig_power(powers, j);
+
+    int dn = hi_count + p->count + 1;
+    uint32_t* d = malloc(sizeof(uint32_t) * dn);
+    nat_mul(d, hi, hi_count, p->digit, p->count, LBIG_DECIMAL);
+    d[dn - 1] = 0;
+    nat_add_into(d, dn, lo, lo_count, LBIG_DECIMAL);
+
+    free(lo);
+    free(hi);
+    *count = nat_len(d, dn);
+    return d;
+
+}
+
+// Return x in decimal as a new malloc'd string.
+char* lbig_to_str(lbig* x) {
+
+    if(!x->count) {
+        char* s = malloc(2);
+        strcpy(s, "0");
+        return s;
+    }
+
+    struct lbig_digits powers[32] = { { NULL, 0 } };
+    int count;
+    uint32_t* d = lbig_decimal(x->limb, x->count, powers, &count);
+
+    for(int j = 0; j < 32; ++j) {
+        free(powers[j].digit);
+    }
+
+    // Every digit but the first is zero padded to nine characters.
+    char* s = malloc(9 * count + 2);
+    char* p = s;
+    if(x->sign < 0) {
+        *p++ = '-';
+    }
+    p += sprintf(p, "%u", d[count - 1]);
+    for(int i = count - 2; i >= 0; --i) {
+        p += sprintf(p, "%09u", d[i]);
+    }
+
+    free(d);
+    return s;
+
+}
+
+// Hash a bignum.
+unsigned lbig_hash(lbig* x) {
+
+    unsigned h = 2166136261u ^ (unsigned)x->sign;
+
+    for(int i = 0; i < x->count; ++i) {
+        h = (h ^ x->limb[i]) * 16777619u;
+    }
+
+    return h;
+
+}
@@ -0,0 +1,92 @@
+#ifndef LBIG_H
+#define LBIG_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "lmem.h"
+
+// Operands shorter than this many limbs are multiplied by the schoolbook
+// method, longer ones by Karatsuba's.
+#ifndef LBIG_KARATSUBA
+#define LBIG_KARATSUBA 32
+#endif
+
+// Results longer than this many limbs are not computed exactly.
+#define LBIG_MAX_LIMBS (1 << 24)
+
+typedef struct lbig lbig;
+
+// An arbitrary precision integer, the payload of Integers too large for an
+// int64_t. The magnitude is stored as base 2^32 limbs, least significant
+// first, with no leading zero limbs, so zero has none. A bignum belongs to
+// a single lval and never changes once built.
+struct lbig {
+    int sign; // 1 or -1
+    int count; // Limbs used
+    uint32_t limb[];
+};
+
+// Room for a bignum holding any int64_t, for temporaries.
+typedef union {
+    lbig big;
+    char bytes[sizeof(lbig) + 2 * sizeof(uint32_t)];
+} lbig_int;
+
+// Store x in space and return it as a bignum. Never allocates.
+lbig* lbig_set_int(lbig_int* space, int64_t x);
+
+// Build a bignum from an integral, finite double.
+lbig* lbig_from_double(double x);
+
+// Parse a decimal integer with an optional leading '-'.
+lbig* lbig_read(char* s);
+
+// Copy a bignum.
+lbig* lbig_copy(lbig* x);
+
+// Free a bignum.
+void lbig_free(lbig* x);
+
+// Store x in *out and return true if it fits in an int64_t.
+bool lbig_to_int(lbig* x, int64_t* out);
+
+// Nearest double to x.
+double lbig_to_double(lbig* x);
+
+// Nearest double to x / y, even where x and y are out of double range.
+double lbig_ratio(lbig* x, lbig* y);
+
+// Compare two bignums, returning -1, 0 or 1.
+int lbig_cmp(lbig* x, lbig* y);
+
+// Return -x.
+lbig* lbig_neg(lbig* x);
+
+// Return x + y.
+lbig* lbig_add(lbig* x, lbig* y);
+
+// Return x - y.
+lbig* lbig_sub(lbig* x, lbig* y);
+
+// Return x * y, or NULL if it would exceed LBIG_MAX_LIMBS.
+lbig* lbig_mul(lbig* x, lbig* y);
+
+// Return x / y rounded toward zero and, if rem is given, store the
+// remainder (with the sign of x) in *rem. y must not be zero.
+lbig* lbig_divmod(lbig* x, lbig* y, lbig** rem);
+
+// Return x to the power e, or NULL if it would exceed LBIG_MAX_LIMBS.
+lbig* lbig_pow(lbig* x, uint64_t e);
+
+// Return x to the power e modulo m, between 0 and |m| - 1. e must not be
+// negative and m must not be zero.
+lbig* lbig_powmod(lbig* x, lbig* e, lbig* m);
+
+// Return x in decimal as a new malloc'd string.
+char* lbig_to_str(lbig* x);
+
+// Hash a bignum.
+unsigned lbig_hash(lbig* x);
+
+#endif
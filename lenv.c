@@ -1,101 +1,250 @@
+#include <stdint.h>
 #include "lenv.h"
 
+// Environments with at most this many entries are searched linearly.
+#define LENV_LINEAR_MAX 8
+
+// Deleted frames kept for reuse, each with room for at least
+// LENV_FRAME_MIN entries.
+#define LENV_SPARE_MAX 64
+#define LENV_FRAME_MIN 4
+static lenv* spare[LENV_SPARE_MAX];
+static int spare_count = 0;
+
+// The global environment: the one without a parent that names are put in.
+static lenv* global = NULL;
+
 // Create a pointer to a new lenv
 lenv* lenv_new(void) {
 
-    lenv* e = malloc(sizeof(lenv));
+    lenv* e = lmem_alloc(sizeof(lenv));
     e->parent = NULL;
     e->count = 0;
+    e->capacity = 0;
     e->syms = NULL;
     e->vals = NULL;
+    e->index = NULL;
+    e->index_size = 0;
+    e->gc_flags = 0;
 
     return e;
 
 }
 
-// Copy a lisp environment.
-lenv* lenv_copy(lenv* e) {
+// Hash an interned symbol by its address.
+static unsigned lenv_hash(char* sym) {
+
+    uintptr_t p = (uintptr_t)sym >> 3;
+    return (unsigned)(p * 2654435761u);
+
+}
+
+// Rebuild the hash index with room for at least twice the current entries.
+static void lenv_reindex(lenv* e) {
+
+    // Keep the load factor at or below one half.
+    int size = 16;
+    while(size < e->count * 2 + 2) {
+        size *= 2;
+    }
 
-    lenv* new = malloc(sizeof(lenv));
-    new->parent = e->parent;
-    new->count = e->count;
-    new->syms = malloc(sizeof(char*) * new->count);
-    new->vals = malloc(sizeof(lval*) * new->count);
+    lmem_free(e->index, sizeof(int) * e->index_size);
+    e->index = lmem_alloc(sizeof(int) * size);
+    e->index_size = size;
 
+    for(int i = 0; i < size; ++i) {
+        e->index[i] = -1;
+    }
+
+    // Reinsert every entry.
     for(int i = 0; i < e->count; ++i) {
-        new->syms[i] = malloc(strlen(e->syms[i]) + 1);
-        strcpy(new->syms[i], e->syms[i]);
-        new->vals[i] = lval_copy(e->vals[i]);
+        unsigned j = lenv_hash(e->syms[i]) & (size - 1);
+        while(e->index[j] != -1) {
+            j = (j + 1) & (size - 1);
+        }
+        e->index[j] = i;
     }
 
-    return new;
+}
+
+// Find the entry position of an interned symbol in this environment only.
+// Returns -1 if the symbol is not bound here.
+static int lenv_find(lenv* e, char* sym) {
+
+    // Small environments: a pointer comparison per entry.
+    if(!e->index) {
+        for(int i = 0; i < e->count; ++i) {
+            if(e->syms[i] == sym) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // Otherwise probe the hash index.
+    unsigned mask = e->index_size - 1;
+    unsigned j = lenv_hash(sym) & mask;
+    while(e->index[j] != -1) {
+        if(e->syms[e->index[j]] == sym) {
+            return e->index[j];
+        }
+        j = (j + 1) & mask;
+    }
+
+    return -1;
 
 }
 
 // Delete a lisp environment.
 void lenv_del(lenv* e) {
 
-    // Iterate through all symbols and values and deletes them.
+    // Iterate through all values and delete them. Symbols are interned.
     for(int i = 0; i < e->count; ++i) {
-        free(e->syms[i]);
+        lsym_info(e->syms[i])->bound--;
         lval_del(e->vals[i]);
     }
 
     // Delete the actual arrays and object itself.
-    free(e->syms);
-    free(e->vals);
-    free(e);
+    lmem_free(e->syms, sizeof(char*) * e->capacity);
+    lmem_free(e->vals, sizeof(lval*) * e->capacity);
+    lmem_free(e->index, sizeof(int) * e->index_size);
+    lgc_release_env(e);
+
+}
+
+// Create an environment below parent binding count distinct symbols to
+// vals, taking over the references in vals. It is not recorded by the write
+// barrier, so it must be rooted with lgc_push_env while in use.
+lenv* lenv_frame(lenv* parent, char** syms, lval** vals, int count) {
+
+    lenv* e;
+
+    // Calls mostly nest, so the last frame deleted usually fits.
+    if(spare_count && spare[spare_count - 1]->capacity >= count) {
+        e = spare[--spare_count];
+    } else {
+        e = lenv_new();
+        e->capacity = count > LENV_FRAME_MIN ? count : LENV_FRAME_MIN;
+        e->syms = lmem_alloc(sizeof(char*) * e->capacity);
+        e->vals = lmem_alloc(sizeof(lval*) * e->capacity);
+    }
+
+    e->parent = parent;
+    e->count = count;
+
+    for(int i = 0; i < count; ++i) {
+        lsym_info(syms[i])->bound++;
+        e->syms[i] = syms[i];
+        e->vals[i] = vals[i];
+    }
+
+    if(count > LENV_LINEAR_MAX) {
+        lenv_reindex(e);
+    }
+
+    return e;
 
 }
 
+// Delete an environment made by lenv_frame, keeping it for reuse unless
+// it has grown an index or is known to the collector.
+void lenv_del_frame(lenv* e) {
+
+    if(e->index || e->gc_flags || spare_count == LENV_SPARE_MAX) {
+        lenv_del(e);
+        return;
+    }
+
+    for(int i = 0; i < e->count; ++i) {
+        lsym_info(e->syms[i])->bound--;
+        lval_del(e->vals[i]);
+    }
+    e->count = 0;
+
+    spare[spare_count++] = e;
+
+}
+
+// Position of an interned symbol bound in this environment only, or -1.
+int lenv_slot(lenv* e, char* sym) {
+    return lenv_find(e, sym);
+}
+
 // Get a value from the environement.
 lval* lenv_get(lenv* e, lval* k) {
-    
-    // Iterate over all items in environment
-    for(int i = 0; i < e->count; ++i) {
-        // Check if stored string matches symbol string.
-        // If it does, return a copy of the value.
-        if(strcmp(e->syms[i], k->sym) == 0) {
-            return lval_copy(e->vals[i]);
+
+    // A name bound nowhere but the global environment needs no search.
+    struct lsym_info* info = lsym_info(k->sym);
+    if(info->bound == (info->global != -1)) {
+        if(info->global != -1) {
+            return lval_copy(global->vals[info->global]);
         }
+        return lval_err("Unbound symbol: '%s'", k->sym);
     }
 
-    // If no symbol in current environment check in parent environment
-    if(e->parent) {
-        return lenv_get(e->parent, k);
+    // Walk up the parent environments until the symbol is found.
+    for(; e; e = e->parent) {
+        // If found, return a shared reference to the value.
+        int i = lenv_find(e, k->sym);
+        if(i != -1) {
+            return lval_copy(e->vals[i]);
+        }
+    }
 
     // Otherwise, no symbol found and return error
-    } else {
-        return lval_err("Unbound symbol: '%s'", k->sym);
-    }
+    return lval_err("Unbound symbol: '%s'", k->sym);
 
 }
 
 // Put values into local environment.
 void lenv_put(lenv* e, lval* k, lval* v) {
 
-    // Iterate over all itmes in environment to see if
-    // variable already exists
-    for(int i = 0; i < e->count; ++i) {
+    // If variable already exists, delete item at that position
+    // and replace with variable supplied by user
+    int i = lenv_find(e, k->sym);
+    if(i != -1) {
+        lval_del(e->vals[i]);
+        e->vals[i] = lval_copy(v);
+        lgc_barrier_env(e, v);
+        return;
+    }
 
-        // If variable is found, delete item at that position
-        // and replace with variable supplied by user
-        if(strcmp(e->syms[i], k->sym) == 0) {
-            lval_del(e->vals[i]);
-            e->vals[i] = lval_copy(v);
-            return;
-        }
+    // If no existing entry found, make space for new entry.
+    if(e->count == e->capacity) {
+        int capacity = e->capacity ? e->capacity * 2 : 4;
+        e->vals = lmem_realloc(e->vals, sizeof(lval*) * e->capacity, sizeof(lval*) * capacity);
+        e->syms = lmem_realloc(e->syms, sizeof(char*) * e->capacity, sizeof(char*) * capacity);
+        e->capacity = capacity;
     }
 
-    // If no existing entry found, allocate space for new entry.
+    // Share the value and store the interned symbol.
+    e->vals[e->count] = lval_copy(v);
+    e->syms[e->count] = k->sym;
     e->count++;
-    e->vals = realloc(e->vals, sizeof(lval*) * e->count);
-    e->syms = realloc(e->syms, sizeof(char*) * e->count);
+    lgc_barrier_env(e, v);
+
+    // Only the global environment has no parent. Its entries never move,
+    // so the name can remember where it is.
+    struct lsym_info* info = lsym_info(k->sym);
+    info->bound++;
+    if(!e->parent) {
+        info->global = e->count - 1;
+        global = e;
+    }
 
-    // Copy contents of lval and symbol string into new location
-    e->vals[e->count - 1] = lval_copy(v);
-    e->syms[e->count - 1] = malloc(strlen(k->sym) + 1);
-    strcpy(e->syms[e->count - 1], k->sym);
+    // Index the new entry, building or growing the index as needed.
+    if(e->count > LENV_LINEAR_MAX) {
+        if(!e->index || e->count * 2 > e->index_size) {
+            lenv_reindex(e);
+        } else {
+            unsigned mask = e->index_size - 1;
+            unsigned j = lenv_hash(k->sym) & mask;
+            while(e->index[j] != -1) {
+                j = (j + 1) & mask;
+            }
+            e->index[j] = e->count - 1;
+        }
+    }
 
 }
 
@@ -136,6 +285,17 @@ void lenv_add_builtins(lenv* e) {
     lenv_add_builtin(e, "cons", builtin_cons);
     lenv_add_builtin(e, "len",  builtin_len);
     lenv_add_builtin(e, "init", builtin_init);
+    lenv_add_builtin(e, "slice", builtin_slice);
+    lenv_add_builtin(e, "nth", builtin_nth);
+    lenv_add_builtin(e, "update", builtin_update);
+
+    // Map functions
+    lenv_add_builtin(e, "map-new", builtin_map_new);
+    lenv_add_builtin(e, "map-get", builtin_map_get);
+    lenv_add_builtin(e, "map-put", builtin_map_put);
+    lenv_add_builtin(e, "map-del", builtin_map_del);
+    lenv_add_builtin(e, "map-keys", builtin_map_keys);
+    lenv_add_builtin(e, "map-len", builtin_map_len);
 
     // Mathematical functions
     lenv_add_builtin(e, "+", builtin_add);
@@ -150,6 +310,7 @@ void lenv_add_builtins(lenv* e) {
     lenv_add_builtin(e, "div", builtin_div);
     lenv_add_builtin(e, "min", builtin_min);
     lenv_add_builtin(e, "max", builtin_max);
+    lenv_add_builtin(e, "pow-mod", builtin_pow_mod);
 
     // Comparision functions
     lenv_add_builtin(e, "if", builtin_if);
@@ -177,6 +338,13 @@ void lenv_add_builtins(lenv* e) {
     lenv_add_builtin(e, "values", builtin_values);
     lenv_add_builtin(e, "exit", builtin_exit);
 
+    // Memory functions
+    lenv_add_builtin(e, "gc", builtin_gc);
+    lenv_add_builtin(e, "mem", builtin_mem);
+    lenv_add_builtin(e, "stack", builtin_stack);
+    lenv_add_builtin(e, "dispatch", builtin_dispatch);
+    lenv_add_builtin(e, "compile", builtin_compile);
+
     // String functions
     lenv_add_builtin(e, "load", builtin_load);
     lenv_add_builtin(e, "error", builtin_error);
@@ -11,21 +11,41 @@ struct lenv {
     lenv* parent;
 
     // Correspond names with values and the number of associations.
+    // Entries are kept in insertion order; names are interned symbols.
     int count;
+    int capacity;
     char** syms;
     lval** vals;
 
+    // Open-addressing hash index into syms/vals, keyed by interned symbol
+    // pointer. Empty slots hold -1. NULL while the environment is small
+    // enough that a linear pointer scan is faster.
+    int* index;
+    int index_size;
+
+    // Collector flags.
+    unsigned char gc_flags;
+
 };
 
 // Create a pointer to a new lenv.
 lenv* lenv_new();
 
-// Copy a lisp environment.
-lenv* lenv_copy(lenv* e);
-
 // Delete a lisp environment.
 void lenv_del(lenv* e);
 
+// Create an environment below parent binding count distinct symbols to
+// vals, taking over the references in vals. It is not recorded by the write
+// barrier, so it must be rooted with lgc_push_env while in use.
+lenv* lenv_frame(lenv* parent, char** syms, lval** vals, int count);
+
+// Delete an environment made by lenv_frame, keeping it for reuse unless
+// it has grown an index or is known to the collector.
+void lenv_del_frame(lenv* e);
+
+// Position of an interned symbol bound in this environment only, or -1.
+int lenv_slot(lenv* e, char* sym);
+
 // Get a value from the environement.
 lval* lenv_get(lenv* e, lval* k);
 
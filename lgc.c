@@ -0,0 +1,682 @@
+#include "lgc.h"
+#include "lval.h"
+
+// Never run a full collection more often than once per this many lvals
+// added to the old generation.
+#define LGC_MIN_THRESHOLD 100000
+
+// Bounds of the nursery and the next free byte in it.
+char* lgc_nursery_start = NULL;
+char* lgc_nursery_end = NULL;
+static char* nursery_top = NULL;
+
+// Young lvals allocated since the last minor collection and not yet freed.
+static long young_live = 0;
+
+// Every old lval. Each old lval records its position in slot.
+static lval** objects = NULL;
+static long object_count = 0;
+static long object_capacity = 0;
+
+// Remembered set: old lvals and environments that may point at young lvals.
+static lval** remembered = NULL;
+static long remembered_count = 0;
+static long remembered_capacity = 0;
+static lenv** remembered_envs = NULL;
+static long remembered_env_count = 0;
+static long remembered_env_capacity = 0;
+
+// Lvals promoted during a minor collection whose fields still need scanning.
+static lval** scan = NULL;
+static long scan_count = 0;
+static long scan_capacity = 0;
+
+// Addresses of C locals holding lvals.
+static lval*** roots = NULL;
+static int root_count = 0;
+static int root_capacity = 0;
+
+// Environments of running compiled functions.
+static lenv** env_roots = NULL;
+static int env_root_count = 0;
+static int env_root_capacity = 0;
+
+// A growable stack of lvals, such as the VM's, and its height.
+static lval*** stack = NULL;
+static int* stack_height = NULL;
+
+// Global environment.
+static lenv* global = NULL;
+
+// Work list for the mark phase.
+static lval** mark_stack = NULL;
+static long mark_count = 0;
+static long mark_capacity = 0;
+
+// An lval is marked in the current collection when its mark equals epoch.
+static unsigned epoch = 0;
+
+// Old lvals added since the last full collection, and how many trigger the
+// next one.
+static long since_last = 0;
+static long threshold = LGC_MIN_THRESHOLD;
+
+static bool stress = false;
+static struct lgc_stats stats;
+
+// Append v to a growable array of pointers.
+static void lgc_append(void*** array, long* count, long* capacity, void* v) {
+
+    if(*count == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 1024;
+        *array = realloc(*array, sizeof(void*) * *capacity);
+    }
+
+    (*array)[(*count)++] = v;
+
+}
+
+// Add an lval to the old generation registry.
+static void lgc_register(lval* v) {
+
+    v->slot = object_count;
+    lgc_append((void***)&objects, &object_count, &object_capacity, v);
+    since_last++;
+
+}
+
+// Allocate and register a new lval of the given size in bytes.
+lval* lgc_alloc(size_t size) {
+
+    if(!lgc_nursery_start) {
+        lgc_nursery_start = malloc(LGC_NURSERY_SIZE);
+        lgc_nursery_end = lgc_nursery_start + LGC_NURSERY_SIZE;
+        nursery_top = lgc_nursery_start;
+    }
+
+    lval* v;
+
+    // Bump allocate in the nursery, or go straight to the old generation if
+    // it is full until the next safepoint empties it.
+    if(nursery_top + size <= lgc_nursery_end) {
+        v = (lval*)nursery_top;
+        nursery_top += size;
+        young_live++;
+    } else {
+        v = lmem_alloc(size);
+        lgc_register(v);
+    }
+
+    v->gc_flags = 0;
+    v->mark = 0;
+
+    stats.allocated++;
+    stats.live++;
+
+    return v;
+
+}
+
+// Free an lval whose reference count reached zero.
+void lgc_release(lval* v) {
+
+    stats.freed++;
+    stats.live--;
+
+    // Young memory is reclaimed wholesale when the nursery is reset.
+    if(lgc_is_young(v)) {
+        v->gc_flags |= LGC_DEAD;
+        young_live--;
+        return;
+    }
+
+    // Move the last object into the vacated slot.
+    lval* last = objects[--object_count];
+    objects[v->slot] = last;
+    last->slot = v->slot;
+
+    // The remembered set frees it at the next minor collection.
+    if(v->gc_flags & LGC_REMEMBERED) {
+        v->gc_flags |= LGC_DEAD;
+        return;
+    }
+
+    lmem_free(v, lval_sizeof(v->type));
+
+}
+
+// Free an lenv whose contents have already been released.
+void lgc_release_env(lenv* e) {
+
+    if(e->gc_flags & LGC_REMEMBERED) {
+        e->gc_flags |= LGC_DEAD;
+        return;
+    }
+
+    lmem_free(e, sizeof(lenv));
+
+}
+
+// Add an old lval that may point at young ones to the remembered set.
+void lgc_remember(lval* v) {
+
+    if(!(v->gc_flags & LGC_REMEMBERED)) {
+        v->gc_flags |= LGC_REMEMBERED;
+        lgc_append((void***)&remembered, &remembered_count, &remembered_capacity, v);
+    }
+
+}
+
+// Add an environment that may hold young values to the remembered set.
+void lgc_remember_env(lenv* e) {
+
+    if(!(e->gc_flags & LGC_REMEMBERED)) {
+        e->gc_flags |= LGC_REMEMBERED;
+        lgc_append((void***)&remembered_envs, &remembered_env_count, &remembered_env_capacity, e);
+    }
+
+}
+
+// Set the global environment, the root of all named values.
+void lgc_set_global(lenv* e) {
+    global = e;
+}
+
+// Push the address of a local lval* as a root.
+void lgc_push(lval** v) {
+
+    if(root_count == root_capacity) {
+        root_capacity = root_capacity ? root_capacity * 2 : 256;
+        roots = realloc(roots, sizeof(lval**) * root_capacity);
+    }
+
+    roots[root_count++] = v;
+
+}
+
+// Pop the n most recently pushed roots.
+void lgc_pop(int n) {
+    root_count -= n;
+}
+
+// Push an environment whose values are roots.
+void lgc_push_env(lenv* e) {
+
+    if(env_root_count == env_root_capacity) {
+        env_root_capacity = env_root_capacity ? env_root_capacity * 2 : 256;
+        env_roots = realloc(env_roots, sizeof(lenv*) * env_root_capacity);
+    }
+
+    env_roots[env_root_count++] = e;
+
+}
+
+// Pop the n most recently pushed environments.
+void lgc_pop_env(int n) {
+    env_root_count -= n;
+}
+
+// Treat the first *height lvals of the array *base as roots.
+void lgc_set_stack(lval*** base, int* height) {
+
+    stack = base;
+    stack_height = height;
+
+}
+
+// What a collector pass does with each lval field, and with the roots of
+// the persistent vectors and maps that lvals hold.
+struct lgc_visitor {
+    void (*val)(lval**);
+    void (*vec)(lvec*);
+    void (*map)(lmap*);
+};
+
+// Apply a visitor to every field of v.
+static void lgc_each_field(lval* v, const struct lgc_visitor* visit) {
+
+    void (*fn)(lval**) = visit->val;
+
+    switch(v->type) {
+
+        case LVAL_FUN:
+            if(lval_is_partial(v)) {
+                fn(&v->target);
+                fn(&v->bound);
+            } else if(!v->builtin) {
+                fn(&v->formals);
+                fn(&v->body);
+                // Constants of its compiled body.
+                if(v->code) {
+                    for(int i = 0; i < v->code->const_count; ++i) {
+                        fn(&v->code->consts[i]);
+                    }
+                }
+            }
+            break;
+
+        case LVAL_SEXPR:
+        case LVAL_QEXPR:
+            // A slice references only its backing list, a vector its root.
+            if(v->backing) {
+                fn(&v->backing);
+                break;
+            }
+            if(v->vec) {
+                visit->vec(v->vec);
+                break;
+            }
+            for(int i = 0; i < v->count; ++i) {
+                // Cells may be empty while their contents are being evaluated.
+                if(v->cell[i]) {
+                    fn(&v->cell[i]);
+                }
+            }
+            break;
+
+        case LVAL_MAP:
+            if(v->map) {
+                visit->map(v->map);
+            }
+            break;
+
+        default:
+            break;
+    }
+
+}
+
+// If *p is young, copy it to the old generation (once) and update *p.
+static void lgc_evacuate(lval** p) {
+
+    lval* v = *p;
+    if(!v || !lgc_is_young(v)) {
+        return;
+    }
+
+    // Already copied by an earlier reference.
+    if(v->gc_flags & LGC_FORWARDED) {
+        *p = v->forward;
+        return;
+    }
+
+    size_t size = lval_sizeof(v->type);
+    lval* old = lmem_alloc(size);
+    memcpy(old, v, size);
+    old->gc_flags = 0;
+    lgc_register(old);
+
+    v->gc_flags |= LGC_FORWARDED;
+    v->forward = old;
+    *p = old;
+
+    // Its own fields may still point into the nursery.
+    lgc_append((void***)&scan, &scan_count, &scan_capacity, old);
+
+    young_live--;
+    stats.promoted++;
+
+}
+
+// Evacuate every young value held in a vector. Vector nodes never change,
+// so once a node has been evacuated it can be skipped for good.
+static void lgc_evacuate_vec(lvec* n) {
+
+    if(!n->young) {
+        return;
+    }
+
+    for(int i = 0; i < n->count; ++i) {
+        if(n->height) {
+            lgc_evacuate_vec(n->slot[i].node);
+        } else {
+            lgc_evacuate(&n->slot[i].val);
+        }
+    }
+
+    n->young = false;
+
+}
+
+// Evacuate every young key and value held in a map, skipping nodes that
+// have been evacuated before.
+static void lgc_evacuate_map(lmap* n) {
+
+    if(!n->young) {
+        return;
+    }
+
+    for(int i = 0; i < n->count; ++i) {
+        if(n->entry[i].key) {
+            lgc_evacuate(&n->entry[i].key);
+            lgc_evacuate(&n->entry[i].val);
+        } else {
+            lgc_evacuate_map(n->entry[i].node);
+        }
+    }
+
+    n->young = false;
+
+}
+
+static const struct lgc_visitor lgc_evacuator = { lgc_evacuate, lgc_evacuate_vec, lgc_evacuate_map };
+
+// Evacuate every young value in an environment.
+static void lgc_evacuate_env(lenv* e) {
+
+    for(int i = 0; i < e->count; ++i) {
+        lgc_evacuate(&e->vals[i]);
+    }
+
+}
+
+// Empty the nursery, promoting every survivor to the old generation.
+void lgc_minor(void) {
+
+    if(!lgc_nursery_start) {
+        return;
+    }
+
+    // Values referenced from C locals, running functions and the stack.
+    for(int i = 0; i < root_count; ++i) {
+        lgc_evacuate(roots[i]);
+    }
+    for(int i = 0; i < env_root_count; ++i) {
+        lgc_evacuate_env(env_roots[i]);
+    }
+    for(int i = 0; stack && i < *stack_height; ++i) {
+        lgc_evacuate(&(*stack)[i]);
+    }
+
+    // Values referenced from old objects.
+    for(long i = 0; i < remembered_count; ++i) {
+        lval* v = remembered[i];
+        if(v->gc_flags & LGC_DEAD) {
+            lmem_free(v, lval_sizeof(v->type));
+        } else {
+            v->gc_flags &= ~LGC_REMEMBERED;
+            lgc_each_field(v, &lgc_evacuator);
+        }
+    }
+    remembered_count = 0;
+
+    for(long i = 0; i < remembered_env_count; ++i) {
+        lenv* e = remembered_envs[i];
+        if(e->gc_flags & LGC_DEAD) {
+            lmem_free(e, sizeof(lenv));
+        } else {
+            e->gc_flags &= ~LGC_REMEMBERED;
+            lgc_evacuate_env(e);
+        }
+    }
+    remembered_env_count = 0;
+
+    // Values referenced from values that were just promoted.
+    while(scan_count) {
+        lgc_each_field(scan[--scan_count], &lgc_evacuator);
+    }
+
+    // Anything young neither dead nor reached was leaked. Promote it too, so
+    // the next full collection can sweep it. This is the only case where the
+    // whole nursery is walked.
+    if(young_live > 0) {
+        for(char* p = lgc_nursery_start; p < nursery_top; p += lval_sizeof(((lval*)p)->type)) {
+            lval* v = (lval*)p;
+            if(!(v->gc_flags & (LGC_FORWARDED | LGC_DEAD))) {
+                lgc_evacuate(&v);
+            }
+        }
+        while(scan_count) {
+            lgc_each_field(scan[--scan_count], &lgc_evacuator);
+        }
+    }
+
+    // Reset the nursery. Under stress, poison it so stale pointers show up.
+    if(stress) {
+        memset(lgc_nursery_start, 0xdb, nursery_top - lgc_nursery_start);
+    }
+    nursery_top = lgc_nursery_start;
+    young_live = 0;
+
+    stats.minor_collections++;
+
+}
+
+// Mark v and queue it for scanning if it was not already marked.
+static void lgc_mark(lval** p) {
+
+    lval* v = *p;
+    if(!v || !lval_is_heap(v) || v->mark == epoch) {
+        return;
+    }
+
+    v->mark = epoch;
+    lgc_append((void***)&mark_stack, &mark_count, &mark_capacity, v);
+
+}
+
+// Mark every value held in a vector, visiting shared nodes once.
+static void lgc_mark_vec(lvec* n) {
+
+    if(n->mark == epoch) {
+        return;
+    }
+
+    n->mark = epoch;
+
+    for(int i = 0; i < n->count; ++i) {
+        if(n->height) {
+            lgc_mark_vec(n->slot[i].node);
+        } else {
+            lgc_mark(&n->slot[i].val);
+        }
+    }
+
+}
+
+// Mark every key and value held in a map, visiting shared nodes once.
+static void lgc_mark_map(lmap* n) {
+
+    if(n->mark == epoch) {
+        return;
+    }
+
+    n->mark = epoch;
+
+    for(int i = 0; i < n->count; ++i) {
+        if(n->entry[i].key) {
+            lgc_mark(&n->entry[i].key);
+            lgc_mark(&n->entry[i].val);
+        } else {
+            lgc_mark_map(n->entry[i].node);
+        }
+    }
+
+}
+
+static const struct lgc_visitor lgc_marker = { lgc_mark, lgc_mark_vec, lgc_mark_map };
+
+// Drop a reference held by a dead object to a surviving one.
+static void lgc_drop_ref(lval** p) {
+
+    if(lval_is_heap(*p) && (*p)->mark == epoch) {
+        (*p)->refs--;
+    }
+
+}
+
+// Drop a reference held by a dead object to a vector. A node whose last
+// reference goes is freed here, after dropping its own references; nodes
+// also held by survivors were marked and keep going.
+static void lgc_drop_vec(lvec* n) {
+
+    if(--n->refs > 0) {
+        return;
+    }
+
+    for(int i = 0; i < n->count; ++i) {
+        if(n->height) {
+            lgc_drop_vec(n->slot[i].node);
+        } else {
+            lgc_drop_ref(&n->slot[i].val);
+        }
+    }
+
+    lvec_free(n);
+
+}
+
+// Drop a reference held by a dead object to a map, as for vectors.
+static void lgc_drop_map(lmap* n) {
+
+    if(--n->refs > 0) {
+        return;
+    }
+
+    for(int i = 0; i < n->count; ++i) {
+        if(n->entry[i].key) {
+            lgc_drop_ref(&n->entry[i].key);
+            lgc_drop_ref(&n->entry[i].val);
+        } else {
+            lgc_drop_map(n->entry[i].node);
+        }
+    }
+
+    lmap_free(n);
+
+}
+
+static const struct lgc_visitor lgc_dropper = { lgc_drop_ref, lgc_drop_vec, lgc_drop_map };
+
+// Free the storage owned directly by a dead lval, without touching the
+// lvals it references (those are either swept too or already released).
+static void lgc_free(lval* v) {
+
+    switch(v->type) {
+
+        case LVAL_FUN:
+            if(!v->builtin && !v->target) {
+                if(v->code) {
+                    lvm_free(v->code);
+                }
+            }
+            break;
+
+        case LVAL_ERR:
+            free(v->err);
+            break;
+
+        case LVAL_STR:
+            free(v->str);
+            break;
+
+        case LVAL_BIG:
+            lbig_free(v->big);
+            break;
+
+        case LVAL_SEXPR:
+        case LVAL_QEXPR:
+            lval_free_cells(v);
+            break;
+
+        default:
+            break;
+    }
+
+    lmem_free(v, lval_sizeof(v->type));
+
+}
+
+// Run a full collection now. Returns the number of lvals reclaimed.
+long lgc_collect(void) {
+
+    // With the nursery empty everything is in the old generation, and the
+    // remembered set is empty.
+    lgc_minor();
+
+    epoch++;
+
+    // Mark everything reachable from the roots. Environment parents are not
+    // followed: a parent is always either the global environment or the
+    // environment of a function that is itself rooted further up the C stack,
+    // or the frame of a compiled function, pushed with lgc_push_env.
+    if(global) {
+        for(int i = 0; i < global->count; ++i) {
+            lgc_mark(&global->vals[i]);
+        }
+    }
+
+    for(int i = 0; i < root_count; ++i) {
+        lgc_mark(roots[i]);
+    }
+    for(int i = 0; i < env_root_count; ++i) {
+        for(int j = 0; j < env_roots[i]->count; ++j) {
+            lgc_mark(&env_roots[i]->vals[j]);
+        }
+    }
+    for(int i = 0; stack && i < *stack_height; ++i) {
+        lgc_mark(&(*stack)[i]);
+    }
+
+    while(mark_count) {
+        lval* v = mark_stack[--mark_count];
+        lgc_each_field(v, &lgc_marker);
+    }
+
+    // Dead objects no longer own their references to live ones.
+    for(long i = 0; i < object_count; ++i) {
+        if(objects[i]->mark != epoch) {
+            lgc_each_field(objects[i], &lgc_dropper);
+        }
+    }
+
+    // Free the dead and compact the survivors.
+    long kept = 0;
+    for(long i = 0; i < object_count; ++i) {
+        lval* v = objects[i];
+        if(v->mark == epoch) {
+            v->slot = kept;
+            objects[kept++] = v;
+        } else {
+            lgc_free(v);
+        }
+    }
+
+    long reclaimed = object_count - kept;
+    object_count = kept;
+
+    stats.collections++;
+    stats.collected += reclaimed;
+    stats.live = kept;
+
+    // Next collection once the old generation has had a chance to double.
+    since_last = 0;
+    threshold = (kept * 2 > LGC_MIN_THRESHOLD) ? kept * 2 : LGC_MIN_THRESHOLD;
+
+    return reclaimed;
+
+}
+
+// Collect if enough has been allocated since the last collection.
+void lgc_safepoint(void) {
+
+    if(stress || since_last >= threshold) {
+        lgc_collect();
+
+    // Empty the nursery once half full, leaving room for the allocations
+    // made by a single builtin between safepoints.
+    } else if(nursery_top - lgc_nursery_start >= LGC_NURSERY_SIZE / 2) {
+        lgc_minor();
+    }
+
+}
+
+// Collect at every safepoint, for validating root registration.
+void lgc_set_stress(bool on) {
+    stress = on;
+}
+
+// Current allocation and collection counters.
+struct lgc_stats lgc_get_stats(void) {
+    return stats;
+}
@@ -0,0 +1,121 @@
+#ifndef LGC_H
+#define LGC_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "lbuiltin.h"
+#include "lmem.h"
+
+// Bytes in the nursery, where new lvals are allocated by bumping a pointer.
+#define LGC_NURSERY_SIZE (1 << 20)
+
+// Collector flags kept on lvals and lenvs.
+#define LGC_FORWARDED 1 // Young lval that has been copied out; see forward.
+#define LGC_DEAD 2 // Freed, but the remembered set still refers to it.
+#define LGC_REMEMBERED 4 // Old object in the remembered set.
+
+// Allocation and collection counters.
+struct lgc_stats {
+    long allocated; // lvals ever allocated
+    long freed; // lvals freed by reference counting
+    long collected; // lvals freed by the tracing collector
+    long collections; // number of full collections run
+    long minor_collections; // number of nursery collections run
+    long promoted; // lvals copied from the nursery to the old generation
+    long live; // lvals currently allocated
+};
+
+// Values are reference counted and freed as soon as their last owner lets
+// go. On top of that every lval is known to the collector, which
+// periodically marks everything reachable from the roots and sweeps the
+// rest. This reclaims values that reference counting misses (leaked
+// references, cycles) without builtins having to be perfect.
+//
+// New lvals are young: they live in the nursery, a single block carved up
+// by bumping a pointer. Most die young by reference count and cost nothing
+// more. A minor collection copies the young lvals still reachable into the
+// old generation (malloc'd and registered for sweeping) and resets the
+// nursery, so it costs time proportional to the survivors. Old objects that
+// are made to point at young ones are recorded by the write barrier in a
+// remembered set, which acts as extra roots for minor collections.
+//
+// Roots are the global environment plus the addresses of C locals pushed
+// with lgc_push. Collection only happens at lgc_safepoint, so any lval held
+// in a C local across a call that may reach a safepoint (anything that
+// evaluates) must be pushed for that duration, and popped before ownership
+// of it is given away. Young lvals move, so after such a call only the
+// pushed variable itself is up to date, never a copy of it.
+
+// Bounds of the nursery.
+extern char* lgc_nursery_start;
+extern char* lgc_nursery_end;
+
+// True if v lives in the nursery.
+#define lgc_is_young(v) \
+    ((char*)(v) >= lgc_nursery_start && (char*)(v) < lgc_nursery_end)
+
+// Write barrier: call after storing child into a field of lval owner.
+#define lgc_barrier(owner, child) \
+    do { \
+        if(lgc_is_young(child) && !lgc_is_young(owner)) { \
+            lgc_remember(owner); \
+        } \
+    } while(0)
+
+// Write barrier: call after storing child into environment e.
+#define lgc_barrier_env(e, child) \
+    do { \
+        if(lgc_is_young(child)) { \
+            lgc_remember_env(e); \
+        } \
+    } while(0)
+
+// Allocate and register a new lval of the given size in bytes.
+lval* lgc_alloc(size_t size);
+
+// Free an lval whose reference count reached zero.
+void lgc_release(lval* v);
+
+// Free an lenv whose contents have already been released.
+void lgc_release_env(lenv* e);
+
+// Add an old lval that may point at young ones to the remembered set.
+void lgc_remember(lval* v);
+
+// Add an environment that may hold young values to the remembered set.
+void lgc_remember_env(lenv* e);
+
+// Set the global environment, the root of all named values.
+void lgc_set_global(lenv* e);
+
+// Push the address of a local lval* as a root.
+void lgc_push(lval** v);
+
+// Pop the n most recently pushed roots.
+void lgc_pop(int n);
+
+// Push an environment whose values are roots.
+void lgc_push_env(lenv* e);
+
+// Pop the n most recently pushed environments.
+void lgc_pop_env(int n);
+
+// Treat the first *height lvals of the array *base as roots.
+void lgc_set_stack(lval*** base, int* height);
+
+// Collect if enough has been allocated since the last collection.
+void lgc_safepoint(void);
+
+// Empty the nursery, promoting every survivor to the old generation.
+void lgc_minor(void);
+
+// Run a full collection now. Returns the number of lvals reclaimed.
+long lgc_collect(void);
+
+// Collect at every safepoint, for validating root registration.
+void lgc_set_stress(bool on);
+
+// Current allocation and collection counters.
+struct lgc_stats lgc_get_stats(void);
+
+#endif
@@ -0,0 +1,435 @@
+// mmap and getpid are POSIX, beyond what -std=c11 declares.
+#define _DEFAULT_SOURCE
+
+#include "ljit.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef LJIT_X86_64
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Bytes before placed code, holding the size of its mapping.
+#define LJIT_HEADER 16
+
+// Start an empty block.
+void ljit_init(ljit_buf* b) {
+
+    *b = (ljit_buf){ NULL, 0, 0, NULL, 0, 0 };
+
+}
+
+// Free a block's buffers, placed or not.
+void ljit_done(ljit_buf* b) {
+
+    free(b->bytes);
+    free(b->addrs);
+    ljit_init(b);
+
+}
+
+// Offset of the next byte to be emitted.
+int ljit_here(ljit_buf* b) {
+    return b->count;
+}
+
+// Emit a byte.
+void ljit_byte(ljit_buf* b, uint8_t x) {
+
+    if(b->count == b->capacity) {
+        b->capacity = b->capacity ? b->capacity * 2 : 256;
+        b->bytes = realloc(b->bytes, b->capacity);
+    }
+
+    b->bytes[b->count++] = x;
+
+}
+
+// Emit a 32-bit word, little-endian.
+void ljit_u32(ljit_buf* b, uint32_t x) {
+
+    for(int i = 0; i < 4; ++i) {
+        ljit_byte(b, x >> (8 * i));
+    }
+
+}
+
+// Emit a 64-bit word, little-endian.
+void ljit_u64(ljit_buf* b, uint64_t x) {
+
+    for(int i = 0; i < 8; ++i) {
+        ljit_byte(b, x >> (8 * i));
+    }
+
+}
+
+// Store the address of offset target in the word at offset at, once
+// placed.
+void ljit_addr(ljit_buf* b, int at, int target) {
+
+    if(b->addr_count == b->addr_capacity) {
+        b->addr_capacity = b->addr_capacity ? b->addr_capacity * 2 : 16;
+        b->addrs = realloc(b->addrs, sizeof(int) * 2 * b->addr_capacity);
+    }
+
+    b->addrs[2 * b->addr_count] = at;
+    b->addrs[2 * b->addr_count + 1] = target;
+    b->addr_count++;
+
+}
+
+// Emit a REX prefix with the given W bit and the high bits of the registers
+// in the reg, index and base (or r/m) fields, unless it would be empty.
+static void ljit_rex(ljit_buf* b, bool w, int reg, int index, int base) {
+
+    uint8_t rex = 0x40 | (w << 3) | ((reg >> 3) << 2) | ((index >> 3) << 1) | (base >> 3);
+    if(rex != 0x40) {
+        ljit_byte(b, rex);
+    }
+
+}
+
+// Emit a ModRM byte addressing register rm directly.
+static void ljit_modrm(ljit_buf* b, int reg, int rm) {
+
+    ljit_byte(b, 0xC0 | ((reg & 7) << 3) | (rm & 7));
+
+}
+
+// Emit an instruction with a memory operand: a REX prefix as needed, the
+// opcode, and the ModRM and SIB bytes and displacement for
+// [base + index * 8 + disp], where index is -1 for none and may not be RSP.
+static void ljit_mem(ljit_buf* b, bool w, uint8_t opcode, int reg, int base, int index, int32_t disp) {
+
+    ljit_rex(b, w, reg, index == -1 ? 0 : index, base);
+    ljit_byte(b, opcode);
+
+    // RBP and R13 with no displacement would mean something else, so take
+    // a zero one.
+    int mod = (disp == 0 && (base & 7) != LJIT_RBP) ? 0 : (disp >= -128 && disp <= 127) ? 1 : 2;
+
+    // RSP and R12 as a base need a SIB byte, as does an index.
+    if(index != -1 || (base & 7) == LJIT_RSP) {
+        ljit_byte(b, (mod << 6) | ((reg & 7) << 3) | 4);
+        ljit_byte(b, (index == -1 ? 0x20 : 0xC0 | ((index & 7) << 3)) | (base & 7));
+    } else {
+        ljit_byte(b, (mod << 6) | ((reg & 7) << 3) | (base & 7));
+    }
+
+    if(mod == 1) {
+        ljit_byte(b, (uint8_t)disp);
+    } else if(mod == 2) {
+        ljit_u32(b, (uint32_t)disp);
+    }
+
+}
+
+// Push a register.
+void ljit_push(ljit_buf* b, enum ljit_reg r) {
+
+    ljit_rex(b, false, 0, 0, r);
+    ljit_byte(b, 0x50 + (r & 7));
+
+}
+
+// Pop a register.
+void ljit_pop(ljit_buf* b, enum ljit_reg r) {
+
+    ljit_rex(b, false, 0, 0, r);
+    ljit_byte(b, 0x58 + (r & 7));
+
+}
+
+// Return.
+void ljit_ret(ljit_buf* b) {
+
+    ljit_byte(b, 0xC3);
+
+}
+
+// dst = src
+void ljit_mov(ljit_buf* b, enum ljit_reg dst, enum ljit_reg src) {
+
+    ljit_rex(b, true, src, 0, dst);
+    ljit_byte(b, 0x89);
+    ljit_modrm(b, src, dst);
+
+}
+
+// dst = x, in the shortest form that holds it.
+void ljit_mov_imm(ljit_buf* b, enum ljit_reg dst, uint64_t x) {
+
+    // The 32-bit form clears the upper half.
+    bool wide = x > UINT32_MAX;
+    ljit_rex(b, wide, 0, 0, dst);
+    ljit_byte(b, 0xB8 + (dst & 7));
+
+    if(wide) {
+        ljit_u64(b, x);
+    } else {
+        ljit_u32(b, x);
+    }
+
+}
+
+// dst = address of offset target
+void ljit_mov_addr(ljit_buf* b, enum ljit_reg dst, int target) {
+
+    ljit_rex(b, true, 0, 0, dst);
+    ljit_byte(b, 0xB8 + (dst & 7));
+    ljit_addr(b, b->count, target);
+    ljit_u64(b, 0);
+
+}
+
+// dst = src, 32 bits, clearing the upper half.
+void ljit_mov32(ljit_buf* b, enum ljit_reg dst, enum ljit_reg src) {
+
+    ljit_rex(b, false, src, 0, dst);
+    ljit_byte(b, 0x89);
+    ljit_modrm(b, src, dst);
+
+}
+
+// dst ^= src, 32 bits, clearing the upper half.
+void ljit_xor32(ljit_buf* b, enum ljit_reg dst, enum ljit_reg src) {
+
+    ljit_rex(b, false, src, 0, dst);
+    ljit_byte(b, 0x31);
+    ljit_modrm(b, src, dst);
+
+}
+
+// Set the flags for x & y, 32 bits.
+void ljit_test32(ljit_buf* b, enum ljit_reg x, enum ljit_reg y) {
+
+    ljit_rex(b, false, y, 0, x);
+    ljit_byte(b, 0x85);
+    ljit_modrm(b, y, x);
+
+}
+
+// dst |= x, 32 bits.
+void ljit_or32_imm(ljit_buf* b, enum ljit_reg dst, uint32_t x) {
+
+    ljit_rex(b, false, 0, 0, dst);
+    ljit_byte(b, 0x81);
+    ljit_modrm(b, 1, dst);
+    ljit_u32(b, x);
+
+}
+
+// r >>= n, unsigned.
+void ljit_shr_imm(ljit_buf* b, enum ljit_reg r, uint8_t n) {
+
+    ljit_rex(b, true, 0, 0, r);
+    ljit_byte(b, 0xC1);
+    ljit_modrm(b, 5, r);
+    ljit_byte(b, n);
+
+}
+
+// r += 1
+void ljit_inc(ljit_buf* b, enum ljit_reg r) {
+
+    ljit_rex(b, true, 0, 0, r);
+    ljit_byte(b, 0xFF);
+    ljit_modrm(b, 0, r);
+
+}
+
+// [base] += src
+void ljit_add_to_mem(ljit_buf* b, enum ljit_reg base, enum ljit_reg src) {
+
+    ljit_mem(b, true, 0x01, src, base, -1, 0);
+
+}
+
+// dst = [base + disp]
+void ljit_load(ljit_buf* b, enum ljit_reg dst, enum ljit_reg base, int32_t disp) {
+
+    ljit_mem(b, true, 0x8B, dst, base, -1, disp);
+
+}
+
+// dst = [base + index * 8 + disp]
+void ljit_load_index(ljit_buf* b, enum ljit_reg dst, enum ljit_reg base, enum ljit_reg index, int32_t disp) {
+
+    ljit_mem(b, true, 0x8B, dst, base, index, disp);
+
+}
+
+// [base + index * 8 + disp] = src
+void ljit_store_index(ljit_buf* b, enum ljit_reg base, enum ljit_reg index, int32_t disp, enum ljit_reg src) {
+
+    ljit_mem(b, true, 0x89, src, base, index, disp);
+
+}
+
+// dst = 32-bit [base + disp], sign-extended.
+void ljit_load32s(ljit_buf* b, enum ljit_reg dst, enum ljit_reg base, int32_t disp) {
+
+    ljit_mem(b, true, 0x63, dst, base, -1, disp);
+
+}
+
+// 32-bit [base + disp] += 1
+void ljit_inc32_mem(ljit_buf* b, enum ljit_reg base, int32_t disp) {
+
+    ljit_mem(b, false, 0xFF, 0, base, -1, disp);
+
+}
+
+// 32-bit [base + disp] -= 1
+void ljit_dec32_mem(ljit_buf* b, enum ljit_reg base, int32_t disp) {
+
+    ljit_mem(b, false, 0xFF, 1, base, -1, disp);
+
+}
+
+// Set the flags for x - y.
+void ljit_cmp(ljit_buf* b, enum ljit_reg x, enum ljit_reg y) {
+
+    ljit_rex(b, true, y, 0, x);
+    ljit_byte(b, 0x39);
+    ljit_modrm(b, y, x);
+
+}
+
+// Call fn, through RAX.
+void ljit_call(ljit_buf* b, void (*fn)(void)) {
+
+    ljit_mov_imm(b, LJIT_RAX, (uint64_t)(uintptr_t)fn);
+    ljit_byte(b, 0xFF);
+    ljit_modrm(b, 2, LJIT_RAX);
+
+}
+
+// Jump through the table of addresses at base, indexed by index.
+void ljit_jmp_table(ljit_buf* b, enum ljit_reg base, enum ljit_reg index) {
+
+    ljit_mem(b, false, 0xFF, 4, base, index, 0);
+
+}
+
+// Emit the displacement of a jump to offset target from the end of it, or
+// zero for now if target is -1. Returns where it is.
+static int ljit_rel32(ljit_buf* b, int target) {
+
+    int at = b->count;
+    ljit_u32(b, target == -1 ? 0 : (uint32_t)(target - (at + 4)));
+    return at;
+
+}
+
+// Jump to offset target.
+int ljit_jmp(ljit_buf* b, int target) {
+
+    ljit_byte(b, 0xE9);
+    return ljit_rel32(b, target);
+
+}
+
+// Jump to offset target if cond holds.
+int ljit_jcc(ljit_buf* b, enum ljit_cond cond, int target) {
+
+    ljit_byte(b, 0x0F);
+    ljit_byte(b, 0x80 + cond);
+    return ljit_rel32(b, target);
+
+}
+
+// Point the jump whose displacement is at at to offset target.
+void ljit_patch(ljit_buf* b, int at, int target) {
+
+    uint32_t rel = target - (at + 4);
+    memcpy(&b->bytes[at], &rel, 4);
+
+}
+
+// Whether placed code is listed in the perf map.
+static bool perf_map_on = false;
+
+// List code placed from now on in the perf map if on is true.
+void ljit_set_perf_map(bool on) {
+    perf_map_on = on;
+}
+
+#ifdef LJIT_X86_64
+// List code at p of the given size under name in the perf map of this
+// process, where perf looks for the names of code it has no symbols for.
+static void ljit_perf_map(void* p, int size, const char* name) {
+
+    // Opened on first use.
+    static FILE* perf_map = NULL;
+
+    if(!perf_map_on) {
+        return;
+    }
+
+    if(!perf_map) {
+        char path[64];
+        snprintf(path, sizeof(path), "/tmp/perf-%ld.map", (long)getpid());
+        perf_map = fopen(path, "a");
+        if(!perf_map) {
+            return;
+        }
+    }
+
+    fprintf(perf_map, "%lx %x %s\n", (unsigned long)(uintptr_t)p, size, name);
+    fflush(perf_map);
+
+}
+#endif
+
+// Copy the block into new executable memory, resolving the addresses it
+// holds. Returns the address of its first byte, or NULL if machine code is
+// not supported here.
+void* ljit_place(ljit_buf* b, int start, const char* name) {
+
+#ifdef LJIT_X86_64
+    size_t size = LJIT_HEADER + b->count;
+    char* base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(base == MAP_FAILED) {
+        return NULL;
+    }
+
+    char* code = base + LJIT_HEADER;
+    memcpy(base, &size, sizeof(size));
+    memcpy(code, b->bytes, b->count);
+
+    for(int i = 0; i < b->addr_count; ++i) {
+        uint64_t addr = (uint64_t)(uintptr_t)(code + b->addrs[2 * i + 1]);
+        memcpy(code + b->addrs[2 * i], &addr, sizeof(addr));
+    }
+
+    // Never writable and executable at once.
+    if(mprotect(base, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(base, size);
+        return NULL;
+    }
+
+    if(name) {
+        ljit_perf_map(code + start, b->count - start, name);
+    }
+
+    return code;
+#else
+    return NULL;
+#endif
+
+}
+
+// Free memory returned by ljit_place.
+void ljit_release(void* p) {
+
+#ifdef LJIT_X86_64
+    char* base = (char*)p - LJIT_HEADER;
+    size_t size;
+    memcpy(&size, base, sizeof(size));
+    munmap(base, size);
+#endif
+
+}
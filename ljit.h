@@ -0,0 +1,106 @@
+#ifndef LJIT_H
+#define LJIT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Machine code is generated on x86-64 systems with mmap, unless LJIT_NONE
+// is defined. Elsewhere nothing is placed, and compiled functions stay on
+// the bytecode loop.
+#if defined(__x86_64__) && !defined(_WIN32) && !defined(LJIT_NONE)
+#define LJIT_X86_64
+#endif
+
+// General purpose registers, numbered as in instruction encodings.
+enum ljit_reg {
+    LJIT_RAX, LJIT_RCX, LJIT_RDX, LJIT_RBX, LJIT_RSP, LJIT_RBP, LJIT_RSI, LJIT_RDI,
+    LJIT_R8, LJIT_R9, LJIT_R10, LJIT_R11, LJIT_R12, LJIT_R13, LJIT_R14, LJIT_R15
+};
+
+// Conditions of jumps, numbered as in instruction encodings.
+enum ljit_cond {
+    LJIT_ZERO = 0x4,
+    LJIT_NONZERO = 0x5,
+    LJIT_SIGN = 0x8
+};
+
+// A block of machine code being assembled, to be placed in executable
+// memory when done. Jumps use offsets within the block, and the address of
+// any offset can be stored in it once it is placed.
+typedef struct ljit_buf {
+    unsigned char* bytes;
+    int count;
+    int capacity;
+    int* addrs; // Pairs of where to store an address and the offset it is of
+    int addr_count;
+    int addr_capacity;
+} ljit_buf;
+
+// Start an empty block.
+void ljit_init(ljit_buf* b);
+
+// Free a block's buffers, placed or not.
+void ljit_done(ljit_buf* b);
+
+// Offset of the next byte to be emitted.
+int ljit_here(ljit_buf* b);
+
+// Emit raw bytes or words.
+void ljit_byte(ljit_buf* b, uint8_t x);
+void ljit_u32(ljit_buf* b, uint32_t x);
+void ljit_u64(ljit_buf* b, uint64_t x);
+
+// Store the address of offset target in the word at offset at, once
+// placed.
+void ljit_addr(ljit_buf* b, int at, int target);
+
+// Instructions. Registers are 64-bit unless the name says 32.
+void ljit_push(ljit_buf* b, enum ljit_reg r);
+void ljit_pop(ljit_buf* b, enum ljit_reg r);
+void ljit_ret(ljit_buf* b);
+void ljit_mov(ljit_buf* b, enum ljit_reg dst, enum ljit_reg src);
+void ljit_mov_imm(ljit_buf* b, enum ljit_reg dst, uint64_t x);
+void ljit_mov_addr(ljit_buf* b, enum ljit_reg dst, int target);
+void ljit_mov32(ljit_buf* b, enum ljit_reg dst, enum ljit_reg src);
+void ljit_xor32(ljit_buf* b, enum ljit_reg dst, enum ljit_reg src);
+void ljit_test32(ljit_buf* b, enum ljit_reg x, enum ljit_reg y);
+void ljit_or32_imm(ljit_buf* b, enum ljit_reg dst, uint32_t x);
+void ljit_shr_imm(ljit_buf* b, enum ljit_reg r, uint8_t n);
+void ljit_inc(ljit_buf* b, enum ljit_reg r);
+void ljit_add_to_mem(ljit_buf* b, enum ljit_reg base, enum ljit_reg src);
+void ljit_load(ljit_buf* b, enum ljit_reg dst, enum ljit_reg base, int32_t disp);
+void ljit_load_index(ljit_buf* b, enum ljit_reg dst, enum ljit_reg base, enum ljit_reg index, int32_t disp);
+void ljit_store_index(ljit_buf* b, enum ljit_reg base, enum ljit_reg index, int32_t disp, enum ljit_reg src);
+void ljit_load32s(ljit_buf* b, enum ljit_reg dst, enum ljit_reg base, int32_t disp);
+void ljit_inc32_mem(ljit_buf* b, enum ljit_reg base, int32_t disp);
+void ljit_dec32_mem(ljit_buf* b, enum ljit_reg base, int32_t disp);
+void ljit_cmp(ljit_buf* b, enum ljit_reg x, enum ljit_reg y);
+void ljit_call(ljit_buf* b, void (*fn)(void));
+
+// Jump through the table of addresses at base, indexed by index.
+void ljit_jmp_table(ljit_buf* b, enum ljit_reg base, enum ljit_reg index);
+
+// Jumps to offset target, or to be patched later when target is -1. Each
+// returns where its displacement is, for ljit_patch.
+int ljit_jmp(ljit_buf* b, int target);
+int ljit_jcc(ljit_buf* b, enum ljit_cond cond, int target);
+
+// Point the jump whose displacement is at at to offset target.
+void ljit_patch(ljit_buf* b, int at, int target);
+
+// Copy the block into new executable memory, resolving the addresses it
+// holds. Returns the address of its first byte, or NULL if machine code is
+// not supported here. If name is not NULL and ljit_set_perf_map was turned
+// on, code from offset start to the end is listed under it in
+// /tmp/perf-<pid>.map, for perf to name.
+void* ljit_place(ljit_buf* b, int start, const char* name);
+
+// List code placed from now on in the perf map if on is true. Off by
+// default, so that nothing is written to /tmp unasked.
+void ljit_set_perf_map(bool on);
+
+// Free memory returned by ljit_place.
+void ljit_release(void* p);
+
+#endif
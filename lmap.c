@@ -0,0 +1,344 @@
+#include "lmap.h"
+#include "lval.h"
+
+// The hash fragment that picks an entry at the given depth.
+#define lmap_frag(hash, shift) (((hash) >> (shift)) & ((1u << LMAP_BITS) - 1))
+
+// Position in a node's dense entry array of the entry for bit.
+#define lmap_index(n, bit) __builtin_popcount((n)->bitmap & ((bit) - 1))
+
+// Bytes used by a node with count entries.
+static size_t lmap_bytes(int count) {
+    return offsetof(lmap, entry) + sizeof(struct lmap_entry) * count;
+}
+
+// True if an entry may reach young lvals.
+static bool lmap_entry_young(struct lmap_entry* e) {
+    return e->key ? lgc_is_young(e->key) || lgc_is_young(e->val) : e->node->young;
+}
+
+// Build a node from count entries, taking a new reference to each.
+static lmap* lmap_make(struct lmap_entry* entries, int count, unsigned bitmap, bool collision) {
+
+    lmap* n = lmem_alloc(lmap_bytes(count));
+    n->refs = 1;
+    n->mark = 0;
+    n->young = false;
+    n->collision = collision;
+    n->bitmap = bitmap;
+    n->count = count;
+    memcpy(n->entry, entries, sizeof(struct lmap_entry) * count);
+
+    for(int i = 0; i < count; ++i) {
+        struct lmap_entry* e = &n->entry[i];
+        if(e->key) {
+            lval_copy(e->key);
+            lval_copy(e->val);
+        } else {
+            lmap_retain(e->node);
+        }
+        n->young |= lmap_entry_young(e);
+    }
+
+    return n;
+
+}
+
+// Copy n with removed entries at idx replaced by e, if given, sharing the
+// rest of its entries.
+static lmap* lmap_splice(lmap* n, int idx, int removed, struct lmap_entry* e, unsigned bitmap) {
+
+    struct lmap_entry local[1 << LMAP_BITS];
+    int added = e ? 1 : 0;
+    int count = n->count - removed + added;
+
+    // Only collision nodes can outgrow a full node.
+    struct lmap_entry* entries = count <= (1 << LMAP_BITS) ? local : malloc(sizeof(struct lmap_entry) * count);
+
+    memcpy(entries, n->entry, sizeof(struct lmap_entry) * idx);
+    if(e) {
+        entries[idx] = *e;
+    }
+    memcpy(&entries[idx + added], &n->entry[idx + removed], sizeof(struct lmap_entry) * (n->count - idx - removed));
+
+    lmap* x = lmap_make(entries, count, bitmap, n->collision);
+
+    if(entries != local) {
+        free(entries);
+    }
+
+    return x;
+
+}
+
+// Build the subtree at depth shift holding two entries whose hashes agree
+// above it.
+static lmap* lmap_pair(struct lmap_entry* a, struct lmap_entry* b, int shift) {
+
+    // Out of hash bits: keep both in a collision node.
+    if(shift >= 32) {
+        struct lmap_entry entries[2] = { *a, *b };
+        return lmap_make(entries, 2, 0, true);
+    }
+
+    unsigned fa = lmap_frag(a->hash, shift);
+    unsigned fb = lmap_frag(b->hash, shift);
+
+    // Still the same fragment: go one level deeper.
+    if(fa == fb) {
+        struct lmap_entry sub = { .key = NULL };
+        sub.node = lmap_pair(a, b, shift + LMAP_BITS);
+        lmap* x = lmap_make(&sub, 1, 1u << fa, false);
+        lmap_release(sub.node);
+        return x;
+    }
+
+    struct lmap_entry entries[2] = { fa < fb ? *a : *b, fa < fb ? *b : *a };
+    return lmap_make(entries, 2, (1u << fa) | (1u << fb), false);
+
+}
+
+// Share a map.
+lmap* lmap_retain(lmap* n) {
+
+    n->refs++;
+    return n;
+
+}
+
+// Release a reference to a map, freeing it with the last one.
+void lmap_release(lmap* n) {
+
+    if(--n->refs > 0) {
+        return;
+    }
+
+    for(int i = 0; i < n->count; ++i) {
+        if(n->entry[i].key) {
+            lval_del(n->entry[i].key);
+            lval_del(n->entry[i].val);
+        } else {
+            lmap_release(n->entry[i].node);
+        }
+    }
+
+    lmap_free(n);
+
+}
+
+// Free the storage of a single node without releasing what it references.
+void lmap_free(lmap* n) {
+    lmem_free(n, lmap_bytes(n->count));
+}
+
+// Return (without a new reference) the value of key, or NULL if absent.
+lval* lmap_get(lmap* n, lval* key, unsigned hash) {
+
+    for(int shift = 0; n; shift += LMAP_BITS) {
+
+        if(n->collision) {
+            for(int i = 0; i < n->count; ++i) {
+                if(lval_eq(n->entry[i].key, key)) {
+                    return n->entry[i].val;
+                }
+            }
+            return NULL;
+        }
+
+        unsigned bit = 1u << lmap_frag(hash, shift);
+        if(!(n->bitmap & bit)) {
+            return NULL;
+        }
+
+        struct lmap_entry* e = &n->entry[lmap_index(n, bit)];
+        if(!e->key) {
+            n = e->node;
+            continue;
+        }
+
+        return (e->hash == hash && lval_eq(e->key, key)) ? e->val : NULL;
+
+    }
+
+    return NULL;
+
+}
+
+// Put key into the subtree n at depth shift.
+static lmap* lmap_put_at(lmap* n, lval* key, lval* val, unsigned hash, int shift, bool* added) {
+
+    struct lmap_entry e = { .key = key, .val = val, .hash = hash };
+
+    if(n->collision) {
+        for(int i = 0; i < n->count; ++i) {
+            if(lval_eq(n->entry[i].key, key)) {
+                return lmap_splice(n, i, 1, &e, 0);
+            }
+        }
+        *added = true;
+        return lmap_splice(n, n->count, 0, &e, 0);
+    }
+
+    unsigned bit = 1u << lmap_frag(hash, shift);
+    int i = lmap_index(n, bit);
+
+    // A free fragment: add the entry here.
+    if(!(n->bitmap & bit)) {
+        *added = true;
+        return lmap_splice(n, i, 0, &e, n->bitmap | bit);
+    }
+
+    struct lmap_entry* old = &n->entry[i];
+    struct lmap_entry sub = { .key = NULL };
+
+    // Same key: replace its value.
+    if(old->key && old->hash == hash && lval_eq(old->key, key)) {
+        return lmap_splice(n, i, 1, &e, n->bitmap);
+    }
+
+    // Otherwise descend, splitting a key entry into a subtree if needed.
+    if(old->key) {
+        *added = true;
+        sub.node = lmap_pair(old, &e, shift + LMAP_BITS);
+    } else {
+        sub.node = lmap_put_at(old->node, key, val, hash, shift + LMAP_BITS, added);
+    }
+
+    lmap* x = lmap_splice(n, i, 1, &sub, n->bitmap);
+    lmap_release(sub.node);
+    return x;
+
+}
+
+// Return a new map with key bound to val. Sets *added if key was absent.
+lmap* lmap_put(lmap* n, lval* key, lval* val, unsigned hash, bool* added) {
+
+    if(!n) {
+        struct lmap_entry e = { .key = key, .val = val, .hash = hash };
+        *added = true;
+        return lmap_make(&e, 1, 1u << lmap_frag(hash, 0), false);
+    }
+
+    return lmap_put_at(n, key, val, hash, 0, added);
+
+}
+
+// Remove key from the subtree n at depth shift.
+static lmap* lmap_del_at(lmap* n, lval* key, unsigned hash, int shift, bool* removed) {
+
+    if(n->collision) {
+        for(int i = 0; i < n->count; ++i) {
+            if(lval_eq(n->entry[i].key, key)) {
+                *removed = true;
+                return n->count == 1 ? NULL : lmap_splice(n, i, 1, NULL, 0);
+            }
+        }
+        return lmap_retain(n);
+    }
+
+    unsigned bit = 1u << lmap_frag(hash, shift);
+    if(!(n->bitmap & bit)) {
+        return lmap_retain(n);
+    }
+
+    int i = lmap_index(n, bit);
+    struct lmap_entry* old = &n->entry[i];
+
+    if(old->key) {
+        if(old->hash != hash || !lval_eq(old->key, key)) {
+            return lmap_retain(n);
+        }
+        *removed = true;
+        return n->count == 1 ? NULL : lmap_splice(n, i, 1, NULL, n->bitmap & ~bit);
+    }
+
+    lmap* child = lmap_del_at(old->node, key, hash, shift + LMAP_BITS, removed);
+    if(!*removed) {
+        lmap_release(child);
+        return lmap_retain(n);
+    }
+
+    lmap* x;
+
+    // The subtree emptied: drop its entry.
+    if(!child) {
+        return n->count == 1 ? NULL : lmap_splice(n, i, 1, NULL, n->bitmap & ~bit);
+
+    // One key left in it: pull the key up into this node.
+    } else if(child->count == 1 && child->entry[0].key) {
+        x = lmap_splice(n, i, 1, &child->entry[0], n->bitmap);
+
+    } else {
+        struct lmap_entry sub = { .key = NULL, .node = child };
+        x = lmap_splice(n, i, 1, &sub, n->bitmap);
+    }
+
+    lmap_release(child);
+    return x;
+
+}
+
+// Return a new map without key, or NULL if it would be empty. Sets *removed
+// if key was present.
+lmap* lmap_del(lmap* n, lval* key, unsigned hash, bool* removed) {
+    return n ? lmap_del_at(n, key, hash, 0, removed) : NULL;
+}
+
+// Call fn on every key and value of n.
+void lmap_each(lmap* n, void (*fn)(lval* key, lval* val, void* ctx), void* ctx) {
+
+    if(!n) {
+        return;
+    }
+
+    for(int i = 0; i < n->count; ++i) {
+        if(n->entry[i].key) {
+            fn(n->entry[i].key, n->entry[i].val, ctx);
+        } else {
+            lmap_each(n->entry[i].node, fn, ctx);
+        }
+    }
+
+}
+
+// True if every key of x is bound to an equal value in y.
+bool lmap_subset(lmap* x, lmap* y) {
+
+    if(!x) {
+        return true;
+    }
+
+    for(int i = 0; i < x->count; ++i) {
+        struct lmap_entry* e = &x->entry[i];
+        if(!e->key) {
+            if(!lmap_subset(e->node, y)) {
+                return false;
+            }
+            continue;
+        }
+        lval* v = lmap_get(y, e->key, e->hash);
+        if(!v || !lval_eq(e->val, v)) {
+            return false;
+        }
+    }
+
+    return true;
+
+}
+
+// Hash the contents of n independently of their order.
+unsigned lmap_hash(lmap* n) {
+
+    if(!n) {
+        return 0;
+    }
+
+    unsigned h = 0;
+    for(int i = 0; i < n->count; ++i) {
+        struct lmap_entry* e = &n->entry[i];
+        h += e->key ? e->hash ^ (lval_hash(e->val) * 2654435761u) : lmap_hash(e->node);
+    }
+
+    return h;
+
+}
@@ -0,0 +1,75 @@
+#ifndef LMAP_H
+#define LMAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "lbuiltin.h"
+#include "lmem.h"
+
+// Bits of a key's hash consumed at each level of a map.
+#define LMAP_BITS 5
+
+// Bits of keys' hashes that maps use. Define it as a small mask to make
+// keys collide.
+#ifndef LMAP_HASH_MASK
+#define LMAP_HASH_MASK 0xffffffffu
+#endif
+
+typedef struct lmap lmap;
+
+// An entry is either a key and its value, or (with key NULL) a subtree of
+// keys whose hashes share this node's prefix.
+struct lmap_entry {
+    lval* key;
+    union {
+        lval* val;
+        lmap* node;
+    };
+    unsigned hash;
+};
+
+// Node of a hash array mapped trie (HAMT), the persistent hash map behind
+// Map values. Bit i of bitmap is set when the node has an entry for hash
+// fragment i, and entries are stored densely in fragment order. Keys whose
+// whole hashes are equal end up together in a collision node, which is
+// searched linearly. Like vector nodes, map nodes never change once built.
+struct lmap {
+    int refs;
+    unsigned mark; // Collector epoch
+    bool young; // May reference young lvals, directly or through children
+    bool collision;
+    unsigned bitmap;
+    int count; // Entries used
+    struct lmap_entry entry[];
+};
+
+// Share a map.
+lmap* lmap_retain(lmap* n);
+
+// Release a reference to a map, freeing it with the last one.
+void lmap_release(lmap* n);
+
+// Free the storage of a single node without releasing what it references.
+void lmap_free(lmap* n);
+
+// Return (without a new reference) the value of key, or NULL if absent.
+// n may be NULL, the empty map.
+lval* lmap_get(lmap* n, lval* key, unsigned hash);
+
+// Return a new map with key bound to val. Sets *added if key was absent.
+lmap* lmap_put(lmap* n, lval* key, lval* val, unsigned hash, bool* added);
+
+// Return a new map without key, or NULL if it would be empty. Sets *removed
+// if key was present.
+lmap* lmap_del(lmap* n, lval* key, unsigned hash, bool* removed);
+
+// Call fn on every key and value of n.
+void lmap_each(lmap* n, void (*fn)(lval* key, lval* val, void* ctx), void* ctx);
+
+// True if every key of x is bound to an equal value in y.
+bool lmap_subset(lmap* x, lmap* y);
+
+// Hash the contents of n independently of their order.
+unsigned lmap_hash(lmap* n);
+
+#endif
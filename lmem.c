@@ -0,0 +1,177 @@
+#include "lmem.h"
+
+// 8, 16, ... 64 bytes, then 128, 256, ... LMEM_LARGE bytes.
+#define LMEM_CLASSES 13
+
+// A pool of equally sized blocks.
+struct lmem_pool {
+    size_t size;
+    void* free; // Returned blocks, linked through their first word
+    char* top; // Next unused block in the current slab
+    char* end;
+    long slabs;
+    long allocs;
+    long frees;
+};
+
+static struct lmem_pool pools[LMEM_CLASSES];
+static long large_bytes = 0;
+static long large_allocs = 0;
+static long large_frees = 0;
+
+// Index of the size class serving blocks of the given size (<= LMEM_LARGE).
+static int lmem_class(size_t size) {
+
+    if(size <= 64) {
+        return (size + 7) / 8 - 1;
+    }
+
+    int c = 8;
+    size_t s = 128;
+    while(s < size) {
+        s *= 2;
+        ++c;
+    }
+
+    return c;
+
+}
+
+// The pool for blocks of the given size, set up on first use.
+static struct lmem_pool* lmem_pool(size_t size) {
+
+    int c = lmem_class(size);
+    struct lmem_pool* pool = &pools[c];
+
+    if(!pool->size) {
+        pool->size = (c < 8) ? (size_t)(c + 1) * 8 : (size_t)128 << (c - 8);
+    }
+
+    return pool;
+
+}
+
+// Allocate size bytes. Returns NULL for size 0.
+void* lmem_alloc(size_t size) {
+
+    if(size == 0) {
+        return NULL;
+    }
+
+    if(size > LMEM_LARGE) {
+        large_bytes += size;
+        large_allocs++;
+        return malloc(size);
+    }
+
+    struct lmem_pool* pool = lmem_pool(size);
+    pool->allocs++;
+
+    // Reuse a returned block while it is still warm.
+    if(pool->free) {
+        void* p = pool->free;
+        pool->free = *(void**)p;
+        return p;
+    }
+
+    // Otherwise carve the next block, starting a new slab if needed.
+    if(pool->top + pool->size > pool->end) {
+        pool->top = malloc(LMEM_SLAB_SIZE);
+        pool->end = pool->top + LMEM_SLAB_SIZE;
+        pool->slabs++;
+    }
+
+    void* p = pool->top;
+    pool->top += pool->size;
+    return p;
+
+}
+
+// Return a block allocated with the given size.
+void lmem_free(void* p, size_t size) {
+
+    if(!p) {
+        return;
+    }
+
+    if(size > LMEM_LARGE) {
+        large_bytes -= size;
+        large_frees++;
+        free(p);
+        return;
+    }
+
+    struct lmem_pool* pool = lmem_pool(size);
+    *(void**)p = pool->free;
+    pool->free = p;
+    pool->frees++;
+
+}
+
+// Resize a block, moving it only if it changes size class.
+void* lmem_realloc(void* p, size_t old_size, size_t new_size) {
+
+    if(!p) {
+        return lmem_alloc(new_size);
+    }
+
+    if(new_size == 0) {
+        lmem_free(p, old_size);
+        return NULL;
+    }
+
+    // Both large: let malloc grow it in place if it can.
+    if(old_size > LMEM_LARGE && new_size > LMEM_LARGE) {
+        large_bytes += new_size - old_size;
+        return realloc(p, new_size);
+    }
+
+    // Still fits the block it already has.
+    if(old_size <= LMEM_LARGE && new_size <= LMEM_LARGE
+            && lmem_class(old_size) == lmem_class(new_size)) {
+        return p;
+    }
+
+    void* q = lmem_alloc(new_size);
+    memcpy(q, p, old_size < new_size ? old_size : new_size);
+    lmem_free(p, old_size);
+
+    return q;
+
+}
+
+// Counters for the size class serving blocks of the given size, or for all
+// memory if size is 0.
+struct lmem_stats lmem_get_stats(size_t size) {
+
+    struct lmem_stats stats = { 0 };
+
+    if(size > LMEM_LARGE) {
+        stats.allocs = large_allocs;
+        stats.frees = large_frees;
+        stats.large = large_bytes;
+        return stats;
+    }
+
+    int first = 0;
+    int last = LMEM_CLASSES - 1;
+    if(size) {
+        first = last = lmem_class(size);
+        stats.size = lmem_pool(size)->size;
+    } else {
+        stats.allocs = large_allocs;
+        stats.frees = large_frees;
+        stats.large = large_bytes;
+    }
+
+    for(int c = first; c <= last; ++c) {
+        struct lmem_pool* pool = &pools[c];
+        stats.arena += pool->slabs * LMEM_SLAB_SIZE;
+        stats.used += (pool->allocs - pool->frees) * (long)pool->size;
+        stats.allocs += pool->allocs;
+        stats.frees += pool->frees;
+    }
+
+    return stats;
+
+}
@@ -0,0 +1,43 @@
+#ifndef LMEM_H
+#define LMEM_H
+
+#include <stdlib.h>
+#include <string.h>
+
+// Bytes in each slab carved up by a size class.
+#define LMEM_SLAB_SIZE (64 * 1024)
+
+// Requests larger than this go straight to malloc.
+#define LMEM_LARGE 2048
+
+// Memory counters, either for one size class or in total.
+struct lmem_stats {
+    long size; // block size served (0 for totals)
+    long arena; // bytes obtained from malloc for slabs
+    long used; // bytes in blocks currently handed out
+    long allocs; // blocks ever handed out
+    long frees; // blocks ever returned
+    long large; // bytes currently in allocations too large for a slab
+};
+
+// Small, fixed-size blocks (old generation lvals, lenvs and cell and entry
+// arrays) are served from per-size-class pools: slabs of LMEM_SLAB_SIZE
+// bytes carved into equal blocks, with a free list of returned blocks.
+// Sizes up to 64 bytes are classed in steps of 8 (so each kind of lval gets
+// its own pool), larger ones in powers of two. Callers pass the size back
+// when freeing, so blocks carry no header.
+
+// Allocate size bytes. Returns NULL for size 0.
+void* lmem_alloc(size_t size);
+
+// Return a block allocated with the given size.
+void lmem_free(void* p, size_t size);
+
+// Resize a block, moving it only if it changes size class.
+void* lmem_realloc(void* p, size_t old_size, size_t new_size);
+
+// Counters for the size class serving blocks of the given size, or for all
+// memory if size is 0.
+struct lmem_stats lmem_get_stats(size_t size);
+
+#endif
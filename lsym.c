@@ -0,0 +1,72 @@
+#include "lsym.h"
+
+// Open-addressing table of interned names. Always a power of two in size.
+static char** table = NULL;
+static int table_size = 0;
+static int table_count = 0;
+
+// FNV-1a hash of a null terminated string.
+static unsigned lsym_hash_str(char* s) {
+
+    unsigned h = 2166136261u;
+    while(*s) {
+        h ^= (unsigned char)*s++;
+        h *= 16777619u;
+    }
+
+    return h;
+
+}
+
+// Double the size of the table and reinsert every name.
+static void lsym_grow(void) {
+
+    int old_size = table_size;
+    char** old = table;
+
+    table_size = old_size ? old_size * 2 : 256;
+    table = calloc(table_size, sizeof(char*));
+
+    for(int i = 0; i < old_size; ++i) {
+        if(old[i]) {
+            unsigned j = lsym_hash_str(old[i]) & (table_size - 1);
+            while(table[j]) {
+                j = (j + 1) & (table_size - 1);
+            }
+            table[j] = old[i];
+        }
+    }
+
+    free(old);
+
+}
+
+// Return the canonical (interned) copy of a symbol name.
+char* lsym_intern(char* s) {
+
+    // Keep the load factor at or below one half.
+    if((table_count + 1) * 2 > table_size) {
+        lsym_grow();
+    }
+
+    // Linear probe until we find the name or an empty slot.
+    unsigned j = lsym_hash_str(s) & (table_size - 1);
+    while(table[j]) {
+        if(strcmp(table[j], s) == 0) {
+            return table[j];
+        }
+        j = (j + 1) & (table_size - 1);
+    }
+
+    // Not seen before, so store a permanent copy after its information.
+    struct lsym_info* info = malloc(sizeof(struct lsym_info) + strlen(s) + 1);
+    info->bound = 0;
+    info->global = -1;
+    char* name = (char*)(info + 1);
+    strcpy(name, s);
+    table[j] = name;
+    ++table_count;
+
+    return table[j];
+
+}
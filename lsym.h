@@ -0,0 +1,23 @@
+#ifndef LSYM_H
+#define LSYM_H
+
+#include <stdlib.h>
+#include <string.h>
+
+// Return the canonical (interned) copy of a symbol name.
+// Interned names live for the lifetime of the interpreter, so two symbols
+// are equal exactly when their interned pointers are equal.
+char* lsym_intern(char* s);
+
+// What is known about an interned name, kept just before it. While the
+// only binding of a name is in the global environment, a lookup can go
+// straight to its entry there, which def replaces in place.
+struct lsym_info {
+    int bound; // Environment entries binding the name, global one included
+    int global; // Position of its entry in the global environment, or -1
+};
+
+// The information kept about interned name s.
+#define lsym_info(s) ((struct lsym_info*)((s) - sizeof(struct lsym_info)))
+
+#endif
@@ -8,6 +8,9 @@ char* ltype_name(enum lval_type type) {
             return "Function";
         case LVAL_NUM:
             return "Number";
+        case LVAL_INT:
+        case LVAL_BIG:
+            return "Integer";
         case LVAL_BOOL:
             return "Boolean";
         case LVAL_ERR:
@@ -20,6 +23,8 @@ char* ltype_name(enum lval_type type) {
             return "S-Expression";
         case LVAL_QEXPR:
             return "Q-Expression";
+        case LVAL_MAP:
+            return "Map";
         case LVAL_OKAY:
             return "OKAY";
         default:
@@ -28,33 +33,176 @@ char* ltype_name(enum lval_type type) {
 
 }
 
+// Name of v's type as given in error messages. Integers of either size go
+// by Number, as every number did before Integers had a type of their own;
+// ltype_name(LVAL_INT) still names what a function expects when it takes
+// only Integers.
+char* lval_type_name(lval* v) {
+    return ltype_name(lval_is_number(v) ? LVAL_NUM : lval_type(v));
+}
+
+// Payload-less values are shared and never freed.
+static lval lval_true = { .type = LVAL_BOOL, .refs = LVAL_IMMORTAL, .val = true };
+static lval lval_false = { .type = LVAL_BOOL, .refs = LVAL_IMMORTAL, .val = false };
+static lval lval_ok = { .type = LVAL_OKAY, .refs = LVAL_IMMORTAL };
+
+#ifndef LVAL_IMMEDIATE
+// Shared Integers from LVAL_SMALL_MIN up to LVAL_SMALL_MAX, filled in on
+// first use.
+static lval lval_small[LVAL_SMALL_MAX - LVAL_SMALL_MIN + 1];
+#endif
+
+// Number of bytes allocated for an lval of the given type.
+size_t lval_sizeof(enum lval_type type) {
+
+    size_t size;
+
+    // Header plus everything up to the end of the type's last field.
+    switch(type) {
+        case LVAL_NUM:
+            size = offsetof(lval, num) + sizeof(double);
+            break;
+        case LVAL_INT:
+            size = offsetof(lval, integer) + sizeof(int64_t);
+            break;
+        case LVAL_BIG:
+            size = offsetof(lval, big) + sizeof(lbig*);
+            break;
+        case LVAL_BOOL:
+            size = offsetof(lval, val) + sizeof(bool);
+            break;
+        case LVAL_ERR:
+        case LVAL_SYM:
+        case LVAL_STR:
+            size = offsetof(lval, str) + sizeof(char*);
+            break;
+        case LVAL_FUN:
+            size = offsetof(lval, bound) + sizeof(lval*);
+            break;
+        case LVAL_SEXPR:
+        case LVAL_QEXPR:
+            size = offsetof(lval, cell) + sizeof(lval**);
+            break;
+        case LVAL_MAP:
+            size = offsetof(lval, size) + sizeof(int);
+            break;
+        case LVAL_OKAY:
+        default:
+            size = offsetof(lval, num);
+            break;
+    }
+
+    // Keep every allocation pointer aligned.
+    return (size + 7) & ~(size_t)7;
+
+}
+
+// Allocate an lval of the given type holding a single reference.
+static lval* lval_new(enum lval_type type) {
+
+    lval* v = lgc_alloc(lval_sizeof(type));
+    v->type = type;
+    v->refs = 1;
+
+    return v;
+
+}
+
+#ifdef LVAL_IMMEDIATE
+// Construct an Integer lval too large to be an immediate.
+lval* lval_int_boxed(int64_t x) {
+
+    lval* v = lval_new(LVAL_INT);
+    v->integer = x;
+
+    return v;
+
+}
+#else
 // Construct a pointer to a new Number lval.
 lval* lval_num(double x) {
 
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_NUM;
+    lval* v = lval_new(LVAL_NUM);
     v->num = x;
 
     return v;
 
 }
 
-// Construct a pointer to a new Boolean lval.
-lval* lval_bool(bool x) {
+// Construct a pointer to a new Integer lval.
+lval* lval_int(int64_t x) {
+
+    lval* v = lval_new(LVAL_INT);
+    v->integer = x;
+
+    return v;
 
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_BOOL;
-    v->val = x;
+}
+
+// Return an Integer lval for x, shared when x is small. Never allocates a
+// small Integer, but the result must be unshared before it is modified.
+lval* lval_int_shared(int64_t x) {
+
+    if(x < LVAL_SMALL_MIN || x > LVAL_SMALL_MAX) {
+        return lval_int(x);
+    }
+
+    lval* v = &lval_small[x - LVAL_SMALL_MIN];
+    if(!v->refs) {
+        v->type = LVAL_INT;
+        v->refs = LVAL_IMMORTAL;
+        v->integer = x;
+    }
+
+    return lval_copy(v);
+
+}
+#endif
+
+// Construct an Integer lval from a bignum, consuming it.
+lval* lval_big(lbig* x) {
+
+    int64_t i;
+    if(lbig_to_int(x, &i)) {
+        lbig_free(x);
+        return lval_int(i);
+    }
+
+    lval* v = lval_new(LVAL_BIG);
+    v->big = x;
 
     return v;
 
 }
 
+// View an Integer as a bignum, using space for one that fits an int64_t.
+lbig* lval_to_big(lval* v, lbig_int* space) {
+    return lval_type(v) == LVAL_BIG ? v->big : lbig_set_int(space, lval_int_value(v));
+}
+
+// Value of an Integer or Number as a double.
+double lval_as_double(lval* v) {
+
+    switch(lval_type(v)) {
+        case LVAL_INT:
+            return (double)lval_int_value(v);
+        case LVAL_BIG:
+            return lbig_to_double(v->big);
+        default:
+            return lval_num_value(v);
+    }
+
+}
+
+// Return the shared Boolean lval for x.
+lval* lval_bool(bool x) {
+    return lval_copy(x ? &lval_true : &lval_false);
+}
+
 // Construct a pointer to a new Error lval
 lval* lval_err(char* fmt, ...) {
 
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_ERR;
+    lval* v = lval_new(LVAL_ERR);
     
     // Create a va list and initialize it
     va_list va;
@@ -79,10 +227,8 @@ lval* lval_err(char* fmt, ...) {
 // Construct a pointer to a new Symbol lval
 lval* lval_sym(char* s) {
 
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_SYM;
-    v->sym = malloc(strlen(s) + 1);
-    strcpy(v->sym, s);
+    lval* v = lval_new(LVAL_SYM);
+    v->sym = lsym_intern(s);
 
     return v;
 
@@ -91,8 +237,7 @@ lval* lval_sym(char* s) {
 // Construct a pointer to a new String lval
 lval* lval_str(char* s) {
 
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_STR;
+    lval* v = lval_new(LVAL_STR);
     v->str = malloc(strlen(s) + 1);
     strcpy(v->str, s);
 
@@ -103,8 +248,7 @@ lval* lval_str(char* s) {
 // Construct a pointer to a new built-in Function lval
 lval* lval_fun(lbuiltin func) {
 
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_FUN;
+    lval* v = lval_new(LVAL_FUN);
     v->builtin = func;
 
     return v;
@@ -114,18 +258,39 @@ lval* lval_fun(lbuiltin func) {
 // Construct a pointer to a new user-defined Function lval
 lval* lval_lambda(lval* formals, lval* body) {
     
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_FUN;
+    lval* v = lval_new(LVAL_FUN);
 
     // Set Builtin to Null
     v->builtin = NULL;
 
-    // Build new environment
-    v->env = lenv_new();
-
     // Set formals and body
     v->formals = formals;
     v->body = body;
+    v->code = NULL;
+    v->target = NULL;
+    v->bound = NULL;
+    lgc_barrier(v, formals);
+    lgc_barrier(v, body);
+
+    return v;
+
+}
+
+// Construct a partial application of lambda f to the arguments in list a,
+// consuming a. Partial applications of partial applications apply the
+// original lambda directly.
+static lval* lval_partial(lval* f, lval* a) {
+
+    lval* v = lval_new(LVAL_FUN);
+    v->builtin = NULL;
+    v->formals = NULL;
+    v->body = NULL;
+    v->code = NULL;
+    v->target = lval_copy(f);
+    v->bound = a;
+    a->type = LVAL_QEXPR;
+    lgc_barrier(v, v->target);
+    lgc_barrier(v, a);
 
     return v;
 
@@ -134,9 +299,12 @@ lval* lval_lambda(lval* formals, lval* body) {
 // Construct a pointer to a new emtpy S-Expression lval.
 lval* lval_sexpr(void) {
 
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_SEXPR;
+    lval* v = lval_new(LVAL_SEXPR);
     v->count = 0;
+    v->start = 0;
+    v->capacity = 0;
+    v->backing = NULL;
+    v->vec = NULL;
     v->cell = NULL;
 
     return v;
@@ -146,51 +314,161 @@ lval* lval_sexpr(void) {
 // Construct a pointer to a new empty Q-Expression lval.
 lval* lval_qexpr(void) {
 
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_QEXPR;
+    lval* v = lval_new(LVAL_QEXPR);
     v->count = 0;
+    v->start = 0;
+    v->capacity = 0;
+    v->backing = NULL;
+    v->vec = NULL;
     v->cell = NULL;
 
     return v;
 
 }
 
-// Construct a pointer to a new Okay lval.
+// Construct a pointer to a new empty Map lval.
+lval* lval_map(void) {
+
+    lval* v = lval_new(LVAL_MAP);
+    v->map = NULL;
+    v->size = 0;
+
+    return v;
+
+}
+
+// Make a Map lval holding size keys under root n. Consumes n.
+static lval* lval_map_root(lmap* n, int size) {
+
+    lval* v = lval_new(LVAL_MAP);
+    v->map = n;
+    v->size = size;
+
+    if(n && n->young && !lgc_is_young(v)) {
+        lgc_remember(v);
+    }
+
+    return v;
+
+}
+
+// Return the shared Okay lval.
 lval* lval_okay(void) {
+    return lval_copy(&lval_ok);
+}
+
+// Make a Q-Expression stored in vector n. Consumes n.
+static lval* lval_vector(lvec* n) {
+
+    lval* v = lval_new(LVAL_QEXPR);
+    v->count = n->size;
+    v->start = 0;
+    v->capacity = 0;
+    v->backing = NULL;
+    v->vec = n;
+    v->cell = NULL;
 
-    lval* v = malloc(sizeof(lval));
-    v->type = LVAL_OKAY;
+    if(n->young && !lgc_is_young(v)) {
+        lgc_remember(v);
+    }
 
     return v;
 
 }
 
-// Copy an lval (useful when putting things in/out of the environment).
-lval* lval_copy(lval* v) {
-    
-    lval* x = malloc(sizeof(lval));
-    x->type = v->type;
-    
+// Give a slice or vector list a flat cell array of its own, in place. The
+// elements are unchanged, so this is safe on shared lists too.
+void lval_flatten(lval* v) {
+
+    if(!v->backing && !v->vec) {
+        return;
+    }
+
+    lval** cell = lmem_alloc(sizeof(lval*) * v->count);
+
+    if(v->vec) {
+        lvec_copy_out(v->vec, cell);
+        lvec_release(v->vec);
+    } else {
+        for(int i = 0; i < v->count; ++i) {
+            cell[i] = lval_copy(v->cell[i]);
+        }
+        lval_del(v->backing);
+    }
+
+    v->backing = NULL;
+    v->vec = NULL;
+    v->start = 0;
+    v->capacity = v->count;
+    v->cell = cell;
+
+    for(int i = 0; i < v->count; ++i) {
+        lgc_barrier(v, cell[i]);
+    }
+
+}
+
+// Return a version of v that the caller may mutate.
+lval* lval_unshare(lval* v) {
+
+    // Immediates have nothing in place to mutate.
+    if(!lval_is_heap(v)) {
+        return v;
+    }
+
+    // Sole owner can mutate in place, once a list has its own cells.
+    if(v->refs == 1) {
+        if(v->type == LVAL_SEXPR || v->type == LVAL_QEXPR) {
+            lval_flatten(v);
+        }
+        return v;
+    }
+
+    lval* x = lval_new(v->type);
+
     switch(v->type) {
 
         case LVAL_FUN:
             // Builtin function (copy function pointer)
             if(v->builtin) {
                 x->builtin = v->builtin;
-            
-            // User-defined function (copy its lenv, parameters, and body)
+
+            // Partial application (share the function and arguments)
+            } else if(v->target) {
+                x->builtin = NULL;
+                x->formals = NULL;
+                x->body = NULL;
+                x->code = NULL;
+                x->target = lval_copy(v->target);
+                x->bound = lval_copy(v->bound);
+                lgc_barrier(x, x->target);
+                lgc_barrier(x, x->bound);
+
+            // User-defined function (share parameters and body)
             } else {
                 x->builtin = NULL;
-                x->env = lenv_copy(v->env);
                 x->formals = lval_copy(v->formals);
                 x->body = lval_copy(v->body);
+                x->code = NULL;
+                x->target = NULL;
+                x->bound = NULL;
+                lgc_barrier(x, x->formals);
+                lgc_barrier(x, x->body);
             }
             break;
-        
+
         case LVAL_NUM:
             x->num = v->num;
             break;
 
+        case LVAL_INT:
+            x->integer = v->integer;
+            break;
+
+        case LVAL_BIG:
+            x->big = lbig_copy(v->big);
+            break;
+
         case LVAL_BOOL:
             x->val = v->val;
             break;
@@ -201,9 +479,9 @@ lval* lval_copy(lval* v) {
             strcpy(x->err, v->err);
             break;
 
+        // Symbols are interned so share the name.
         case LVAL_SYM:
-            x->sym = malloc(strlen(v->sym) + 1);
-            strcpy(x->sym, v->sym);
+            x->sym = v->sym;
             break;
 
         case LVAL_STR:
@@ -211,13 +489,27 @@ lval* lval_copy(lval* v) {
             strcpy(x->str, v->str);
             break;
 
-        // Copy Lists by copying each sub-expression
+        // Copy the cell array, sharing each sub-expression
         case LVAL_SEXPR:
         case LVAL_QEXPR:
             x->count = v->count;
-            x->cell = malloc(sizeof(lval*) * x->count);
+            x->start = 0;
+            x->capacity = v->count;
+            x->backing = NULL;
+            x->vec = NULL;
+            x->cell = lmem_alloc(sizeof(lval*) * x->capacity);
             for(int i = 0; i < x->count; ++i) {
-                x->cell[i] = lval_copy(v->cell[i]);
+                x->cell[i] = lval_copy(lval_index(v, i));
+                lgc_barrier(x, x->cell[i]);
+            }
+            break;
+
+        // Maps never change, so share the whole trie.
+        case LVAL_MAP:
+            x->map = v->map ? lmap_retain(v->map) : NULL;
+            x->size = v->size;
+            if(x->map && x->map->young && !lgc_is_young(x)) {
+                lgc_remember(x);
             }
             break;
 
@@ -227,21 +519,28 @@ lval* lval_copy(lval* v) {
             break;
     }
 
+    // Give up our reference to the shared original.
+    v->refs--;
     return x;
 
 }
 
-// Delete a Lisp Value.
-void lval_del(lval* v) {
+// Free v itself and release what it holds.
+static void lval_free_one(lval* v) {
 
     switch(v->type) {
 
         // Delete internals if user defined function
         case LVAL_FUN:
-            if(!v->builtin) {
-                lenv_del(v->env);
+            if(lval_is_partial(v)) {
+                lval_del(v->target);
+                lval_del(v->bound);
+            } else if(!v->builtin) {
                 lval_del(v->formals);
                 lval_del(v->body);
+                if(v->code) {
+                    lvm_release(v->code);
+                }
             }
             break;
         
@@ -250,54 +549,245 @@ void lval_del(lval* v) {
             free(v->err);
             break;
 
-        case LVAL_SYM:
-            free(v->sym);
-            break;
-
         case LVAL_STR:
             free(v->str);
             break;
 
+        case LVAL_BIG:
+            lbig_free(v->big);
+            break;
+
         // For Sexpr and Qexpr, recursively delete all the elements inside
         case LVAL_QEXPR:
         case LVAL_SEXPR:
 
+            // A slice only holds its backing list, a vector its root.
+            if(v->backing) {
+                lval_del(v->backing);
+                break;
+            }
+            if(v->vec) {
+                lvec_release(v->vec);
+                break;
+            }
+
             for(int i = 0; i < v->count; i++) {
                 lval_del(v->cell[i]);
             }
 
             // Free memory allocated to contain the pointers
-            free(v->cell);
+            lval_free_cells(v);
+            break;
+
+        case LVAL_MAP:
+            if(v->map) {
+                lmap_release(v->map);
+            }
             break;
 
         // These types have no allocated memory to take care of.
         case LVAL_NUM:
         case LVAL_BOOL:
+        case LVAL_SYM:
         case LVAL_OKAY:
         default:
             break;
     }
 
     // Free the memory allocated for the "lval" structure itself
-    free(v);
+    lgc_release(v);
+
+}
+
+// Delete a Lisp Value whose last reference has been released. Values that
+// die while another is being freed wait in a list instead of being freed
+// recursively, so deep nesting cannot use up the C stack.
+void lval_free(lval* v) {
+
+    static lval** pending = NULL;
+    static int count = 0;
+    static int capacity = 0;
+    static bool freeing = false;
+
+    if(freeing) {
+        if(count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            pending = realloc(pending, sizeof(lval*) * capacity);
+        }
+        pending[count++] = v;
+        return;
+    }
+
+    freeing = true;
+    lval_free_one(v);
+    while(count) {
+        lval_free_one(pending[--count]);
+    }
+    freeing = false;
 
 }
 
 // Add an element to an S-Expression or Q-Expression.
 lval* lval_add(lval* v, lval* x) {
 
-    v->count++;
-    v->cell = realloc(v->cell, sizeof(lval*) * v->count);
-    v->cell[v->count - 1] = x;
+    lval_reserve(v, 1);
+    v->cell[v->count++] = x;
+    lgc_barrier(v, x);
+
+    return v;
+
+}
+
+// Make room for at least n more elements at the end of a list.
+void lval_reserve(lval* v, int n) {
+
+    lval_flatten(v);
+
+    // Already room after the last element.
+    if(v->start + v->count + n <= v->capacity) {
+        return;
+    }
+
+    lval** base = v->cell - v->start;
+
+    // If pops from the front freed at least half the array, slide the
+    // elements back down instead of growing.
+    if(v->count + n <= v->capacity && v->start >= v->capacity / 2) {
+        memmove(base, v->cell, sizeof(lval*) * v->count);
+        v->cell = base;
+        v->start = 0;
+        return;
+    }
+
+    // Otherwise at least double the capacity, so appends are amortized O(1).
+    int capacity = v->capacity ? v->capacity * 2 : 4;
+    while(capacity < v->count + n) {
+        capacity *= 2;
+    }
+
+    if(v->start == 0) {
+        base = lmem_realloc(base, sizeof(lval*) * v->capacity, sizeof(lval*) * capacity);
+    } else {
+        base = lmem_alloc(sizeof(lval*) * capacity);
+        memcpy(base, v->cell, sizeof(lval*) * v->count);
+        lval_free_cells(v);
+    }
+
+    v->cell = base;
+    v->start = 0;
+    v->capacity = capacity;
+
+}
+
+// Free the cell array of a list. Slices and vectors own no cells.
+void lval_free_cells(lval* v) {
+
+    if(!v->backing && !v->vec) {
+        lmem_free(v->cell - v->start, sizeof(lval*) * v->capacity);
+    }
+
+}
+
+// Return (without a new reference) element i of a list.
+lval* lval_index(lval* v, int i) {
+    return v->vec ? lvec_get(v->vec, i) : v->cell[i];
+}
+
+// Return a list with element i replaced by x. Consumes v and x.
+lval* lval_update(lval* v, int i, lval* x) {
+
+    // Vectors copy only the path to the element.
+    if(v->vec) {
+        lval* u = lval_vector(lvec_set(v->vec, i, x));
+        lval_del(v);
+        return u;
+    }
+
+    v = lval_unshare(v);
+    lval_del(v->cell[i]);
+    v->cell[i] = x;
+    lgc_barrier(v, x);
 
     return v;
 
 }
 
+// Take count elements of list v starting at offset, sharing its cells.
+// Consumes v.
+lval* lval_slice(lval* v, int offset, int count) {
+
+    // Nothing left to share.
+    if(count == 0) {
+        lval* x = v->type == LVAL_SEXPR ? lval_sexpr() : lval_qexpr();
+        lval_del(v);
+        return x;
+    }
+
+    // A vector is sliced in O(log n), unless little enough of it is left to
+    // be worth flattening.
+    if(v->vec) {
+        lval* x;
+        if(count < LVAL_VEC_MIN / 2) {
+            x = lval_qexpr();
+            lval_reserve(x, count);
+            for(int i = 0; i < count; ++i) {
+                x->cell[i] = lval_copy(lvec_get(v->vec, offset + i));
+            }
+            x->count = count;
+        } else {
+            x = lval_vector(lvec_slice(v->vec, offset, count));
+        }
+        lval_del(v);
+        return x;
+    }
+
+    // A list we own outright is trimmed in place.
+    if(v->refs == 1 && !v->backing) {
+        for(int i = 0; i < offset; ++i) {
+            lval_del(v->cell[i]);
+        }
+        for(int i = offset + count; i < v->count; ++i) {
+            lval_del(v->cell[i]);
+        }
+        v->cell += offset;
+        v->start += offset;
+        v->count = count;
+        return v;
+    }
+
+    // So is a slice we own outright.
+    if(v->refs == 1) {
+        v->cell += offset;
+        v->count = count;
+        return v;
+    }
+
+    // Otherwise make a new view onto whichever list owns the cells.
+    lval* x = lval_new(v->type);
+    x->count = count;
+    x->start = 0;
+    x->capacity = 0;
+    x->backing = lval_copy(v->backing ? v->backing : v);
+    x->vec = NULL;
+    x->cell = v->cell + offset;
+    lgc_barrier(x, x->backing);
+
+    lval_del(v);
+    return x;
+
+}
+
 // Convert an AST number to an lval number and check for error.
 lval* lval_read_num(mpc_ast_t* t) {
 
     errno = 0;
+
+    // Integral literals are read exactly, unless they do not fit.
+    if(!strchr(t->contents, '.')) {
+        long long i = strtoll(t->contents, NULL, 10);
+        return (errno != ERANGE)? lval_int(i) : lval_big(lbig_read(t->contents));
+    }
+
     double x = strtod(t->contents, NULL);
 
     return (errno != ERANGE)? lval_num(x) : lval_err("invalid number");
@@ -326,6 +816,34 @@ lval* lval_read_str(mpc_ast_t* t) {
     
 }
 
+// Create the parsers of Blisp source.
+void lval_read_init(void) {
+
+    Number = mpc_new("number");
+    Boolean = mpc_new("boolean");
+    Symbol = mpc_new("symbol");
+    String = mpc_new("string");
+    Comment = mpc_new("comment");
+    Sexpr = mpc_new("sexpr");
+    Qexpr = mpc_new("qexpr");
+    Expr = mpc_new("expr");
+    Blisp = mpc_new("blisp");
+
+    // Define the parsers with the following language
+    mpca_lang(MPCA_LANG_DEFAULT,
+            " number : /-?[0-9]+([.][0-9]+)?/ ; \
+              boolean : /(true|false)/ ; \
+              symbol : /[a-zA-Z0-9_+\\-*\\/\\\\=<>!&^\\|%]+/ ; \
+              string : /\"(\\\\.|[^\"])*\"/ ; \
+              comment: /;[^\\r\\n]*/ ; \
+              sexpr  : '(' <expr>* ')' ; \
+              qexpr  : '{' <expr>* '}' ; \
+              expr   : <number> | <boolean> | <symbol> | <string> | <comment> | <sexpr> | <qexpr> ; \
+              blisp  : /^/ <expr>* /$/ ; \
+            ", Number, Boolean, Symbol, String, Comment, Sexpr, Qexpr, Expr, Blisp);
+
+}
+
 // Convert AST to S-Expression.
 lval* lval_read(mpc_ast_t* t) {
 
@@ -378,12 +896,18 @@ lval* lval_read(mpc_ast_t* t) {
 // Print an S-Expression type lval.
 void lval_expr_print(lenv* e, lval* v, char open, char close) {
     
+    // Too deep to print all of it.
+    if(lvm_native_exhausted()) {
+        printf("%c...%c", open, close);
+        return;
+    }
+
     putchar(open);
 
     for(int i = 0; i < v->count; ++i) {
 
         // Print value contained within
-        lval_print(e, v->cell[i]);
+        lval_print(e, lval_index(v, i));
 
         // Don't print trailing space if last element
         if(i != (v->count - 1)) {
@@ -398,6 +922,23 @@ void lval_expr_print(lenv* e, lval* v, char open, char close) {
 // Print a Function type lval.
 void lval_func_print(lenv* e, lval* v) {
    
+    // A partial application prints as the function still to be applied:
+    // the remaining formals and the body.
+    if(lval_is_partial(v)) {
+        lval* formals = v->target->formals;
+        printf("(λ {");
+        for(int i = v->bound->count; i < formals->count; ++i) {
+            lval_print(e, lval_index(formals, i));
+            if(i != formals->count - 1) {
+                putchar(' ');
+            }
+        }
+        printf("} ");
+        lval_print(e, v->target->body);
+        putchar(')');
+        return;
+    }
+
     // Print out function params and body if user-defined
     if(!v->builtin) {
         printf("(λ ");
@@ -408,13 +949,16 @@ void lval_func_print(lenv* e, lval* v) {
         return;
     }
 
-    // Iterate through all builtin functions
-    for(int i = 0; i < e->count; ++i) {
+    // Iterate through all builtin functions, out to the global environment.
+    // Other values may be immediates, which have no fields to compare.
+    for(; e; e = e->parent) {
+        for(int i = 0; i < e->count; ++i) {
 
-        // If function pointers are equal, print corresponding name.
-        if(e->vals[i]->builtin == v->builtin) {
-            printf("<builtin: %s>", e->syms[i]);
-            return;
+            // If function pointers are equal, print corresponding name.
+            if(lval_type(e->vals[i]) == LVAL_FUN && e->vals[i]->builtin == v->builtin) {
+                printf("<builtin: %s>", e->syms[i]);
+                return;
+            }
         }
     }
 
@@ -441,14 +985,57 @@ void lval_print_str(lval* v) {
 
 }
 
+// Where a map is being printed, and whether an entry has been yet.
+struct lval_map_printer {
+    lenv* e;
+    bool first;
+};
+
+// Print one key and value of a map being printed.
+static void lval_map_print_entry(lval* key, lval* val, void* ctx) {
+
+    struct lval_map_printer* p = ctx;
+    if(!p->first) {
+        putchar(' ');
+    }
+    p->first = false;
+
+    lval_print(p->e, key);
+    putchar(' ');
+    lval_print(p->e, val);
+
+}
+
+// Print a Map type lval.
+void lval_map_print(lenv* e, lval* v) {
+
+    struct lval_map_printer p = { e, true };
+
+    printf("#{");
+    lmap_each(v->map, lval_map_print_entry, &p);
+    putchar('}');
+
+}
+
 // Print an lval.
 void lval_print(lenv* e, lval* v) {
 
-    switch(v->type) {
+    switch(lval_type(v)) {
         case LVAL_NUM:
-            printf("%g", v->num);
+            printf("%g", lval_num_value(v));
+            break;
+
+        case LVAL_INT:
+            printf("%" PRId64, lval_int_value(v));
             break;
 
+        case LVAL_BIG: {
+            char* digits = lbig_to_str(v->big);
+            printf("%s", digits);
+            free(digits);
+            break;
+        }
+
         case LVAL_BOOL:
             printf((v->val)? "true" : "false");
             break;
@@ -477,6 +1064,10 @@ void lval_print(lenv* e, lval* v) {
             lval_expr_print(e, v, '{', '}');
             break;
 
+        case LVAL_MAP:
+            lval_map_print(e, v);
+            break;
+
         // Don't print anything for Okay type.
         case LVAL_OKAY:        
         default:
@@ -493,20 +1084,81 @@ void lval_println(lenv* e, lval* v) {
 
 }
 
+// Return (without a new reference) the value of key in map m, or NULL.
+lval* lval_map_get(lval* m, lval* key) {
+    return lmap_get(m->map, key, (lval_hash(key) & LMAP_HASH_MASK));
+}
+
+// Return map m with key bound to val. Consumes m, key and val.
+lval* lval_map_put(lval* m, lval* key, lval* val) {
+
+    bool added = false;
+    lmap* n = lmap_put(m->map, key, val, (lval_hash(key) & LMAP_HASH_MASK), &added);
+    lval* x = lval_map_root(n, m->size + added);
+
+    lval_del(m);
+    lval_del(key);
+    lval_del(val);
+    return x;
+
+}
+
+// Return map m without key. Consumes m and key.
+lval* lval_map_del(lval* m, lval* key) {
+
+    bool removed = false;
+    lmap* n = lmap_del(m->map, key, (lval_hash(key) & LMAP_HASH_MASK), &removed);
+    lval* x = lval_map_root(n, m->size - removed);
+
+    lval_del(m);
+    lval_del(key);
+    return x;
+
+}
+
+// Add a key to the Q-Expression ctx.
+static void lval_map_add_key(lval* key, lval* val, void* ctx) {
+    lval_add(ctx, lval_copy(key));
+}
+
+// Return a Q-Expression of the keys of map m. Consumes m.
+lval* lval_map_keys(lval* m) {
+
+    lval* keys = lval_qexpr();
+    lval_reserve(keys, m->size);
+    lmap_each(m->map, lval_map_add_key, keys);
+
+    lval_del(m);
+    return keys;
+
+}
+
 // Extract a single element from an S-Expression at index i and shift the rest of the list backwards
 lval* lval_pop(lval* v, int i) {
-    
+
+    lval_flatten(v);
+
     // Find the item at index i
     lval* x = v->cell[i];
 
-    // Shift memory after the item at i is over the top
-    memmove(&v->cell[i], &v->cell[i + 1], sizeof(lval*) * (v->count - i - 1));
+    // Close the gap by shifting whichever side is shorter. Shifting the
+    // front up leaves a free slot before the list, so popping index 0 is O(1).
+    if(i < v->count - i - 1) {
+        memmove(&v->cell[1], &v->cell[0], sizeof(lval*) * i);
+        v->cell++;
+        v->start++;
+    } else {
+        memmove(&v->cell[i], &v->cell[i + 1], sizeof(lval*) * (v->count - i - 1));
+    }
 
     // Decrease the count of items in the list
     --(v->count);
 
-    // Reallocate the memory used
-    v->cell = realloc(v->cell, sizeof(lval*) * v->count);
+    // Once empty, start again from the beginning of the array.
+    if(v->count == 0) {
+        v->cell -= v->start;
+        v->start = 0;
+    }
 
     return x;
 
@@ -515,40 +1167,107 @@ lval* lval_pop(lval* v, int i) {
 // Take element i from the list and delete the rest.
 lval* lval_take(lval* v, int i) {
 
-    lval* x = lval_pop(v, i);
+    // Share element i rather than popping it, so v need not be mutable.
+    lval* x = lval_copy(v->cell[i]);
 
     lval_del(v);
     return x;
     
 }
 
+// Join two long Q-Expressions as persistent vectors, sharing both.
+static lval* lval_join_vec(lval* x, lval* y) {
+
+    lvec* a = x->vec ? lvec_retain(x->vec) : lvec_from(x->cell, x->count);
+    lvec* b = y->vec ? lvec_retain(y->vec) : lvec_from(y->cell, y->count);
+    lval* v = lval_vector(lvec_concat(a, b));
+
+    lvec_release(a);
+    lvec_release(b);
+    lval_del(x);
+    lval_del(y);
+    return v;
+
+}
+
 // Join two Q-Expressions or Strings.
 lval* lval_join(lval* x, lval* y) {
 
-    // For each cell in y add x to it
-    while(y->count) {
-        x = lval_add(x, lval_pop(y, 0));
+    // Long lists switch to the vector representation.
+    if(lval_type(x) == LVAL_QEXPR && x->count && y->count && x->count + y->count > LVAL_VEC_MIN) {
+        return lval_join_vec(x, y);
     }
 
-    // Delete the empty y and return x
+    x = lval_unshare(x);
+    lval_reserve(x, y->count);
+
+    // A vector too short to switch back yet.
+    if(y->vec) {
+        lvec_copy_out(y->vec, &x->cell[x->count]);
+        x->count += y->count;
+
+    // If y owns its cells and is ours alone, move its elements over wholesale.
+    } else if(y->refs == 1 && !y->backing) {
+        memcpy(&x->cell[x->count], y->cell, sizeof(lval*) * y->count);
+        x->count += y->count;
+        y->count = 0;
+
+    // Otherwise add a reference to each of them.
+    } else {
+        for(int i = 0; i < y->count; ++i) {
+            x->cell[x->count++] = lval_copy(y->cell[i]);
+        }
+    }
+
+    // Young elements may now hang off an old x.
+    if(!lgc_is_young(x)) {
+        lgc_remember(x);
+    }
+
+    // Release y and return x
     lval_del(y);
     return x;
     
 }
 
-// Evaluate an Expression.
+// Evaluate each expression of program in turn, printing errors.
+void lval_eval_all(lenv* e, lval* program) {
+
+    // Keep the remaining expressions alive while evaluating.
+    lgc_push(&program);
+
+    while(program->count) {
+
+        lval* x = lval_eval(e, lval_pop(program, 0));
+
+        // If evaluation leads to error then print it
+        if(lval_type(x) == LVAL_ERR) {
+            lval_println(e, x);
+        }
+
+        lval_del(x);
+
+    }
+
+    lgc_pop(1);
+    lval_del(program);
+
+}
+
+// Evaluate an Expression. S-Expressions are evaluated by the tree walker
+// on the VM's stack (see lvm.h), so nesting takes no C stack.
 lval* lval_eval(lenv* e, lval* v) {
    
     // Evaluate symbols
-    if(v->type == LVAL_SYM) {
+    if(lval_type(v) == LVAL_SYM) {
         lval* x = lenv_get(e, v);
         lval_del(v); // Environment already returns copy of v
         return x;
     }
 
     // Evaluate s-expressions.
-    else if(v->type == LVAL_SEXPR) {
-        return lval_eval_sexpr(e, v);
+    else if(lval_type(v) == LVAL_SEXPR) {
+        return lvm_eval(e, v);
 
     // All other lval types remain the same.
     } else {
@@ -557,86 +1276,65 @@ lval* lval_eval(lenv* e, lval* v) {
 
 }
 
+// Evaluate list v as an S-Expression, leaving v unchanged, so that quoted
+// bodies run without being copied or retagged.
+lval* lval_eval_list(lenv* e, lval* v) {
+    return lvm_eval(e, lval_copy(v));
+}
 
 // Evaluate an S-Expression.
 lval* lval_eval_sexpr(lenv* e, lval* v) {
+    return lvm_eval(e, v);
+}
 
-    // Evaluate children
-    for(int i = 0; i < v->count; ++i) {
-        v->cell[i] = lval_eval(e, v->cell[i]);
-
-        // Error checking
-        if(v->cell[i]->type == LVAL_ERR) {
-            return lval_take(v, i);
-        }
-    }
-
-    // Empty expression
-    if(v->count == 0) {
-        return v;
-    }
-
-    // Single expression
-    if(v->count == 1) {
-        return lval_take(v, 0);
-    }
-
-    // Ensure first element is a function after evaluation
-    lval* first = lval_pop(v, 0);
-    if(first->type != LVAL_FUN) {
-        lval* err = lval_err("S-Expression starts with incorrect type. Got %s, Expected %s",
-                              ltype_name(first->type), ltype_name(LVAL_FUN));
-        lval_del(v);
-        lval_del(first);
-        return err;
-    }
+// Give up on a call part way through binding its arguments.
+static void lval_call_abort(lenv* frame, lval* a) {
 
-    // If so, call function to get result.
-    lval* result = lval_call(e, first, v);
-    
-    lval_del(first);
-    return result;
+    lgc_pop_env(1);
+    lenv_del_frame(frame);
+    lval_del(a);
 
 }
 
-// Calls a built-in or user-defined function.
-lval* lval_call(lenv* e, lval* f, lval* a) {
-
-    // If built-in function then simply call that
-    if(f->builtin) {
-        return f->builtin(e, a);
-    }
+// Bind arguments a of a call of user-defined function f, of which the
+// first held were held by a partial application, in frame, made for it
+// and pushed as a root. Returns NULL, or an error after giving up on the
+// call. Consumes a.
+static lval* lval_call_bind(lenv* frame, lval* f, lval* a, int held, char* amp) {
 
     // Record argument counts
     int given_args = a->count;
     int total_args = f->formals->count;
 
+    // Position of the next formal to bind.
+    int i = 0;
+
     // While arguments still remain to be processed
     while(a->count) {
 
         // If we've ran out of formal arguments to bind
-        if(f->formals->count == 0) {
-            lval_del(a);
-            return lval_err("Function passed too many arguments. Got %i, Expected %i.", given_args, total_args);
+        if(i == total_args) {
+            lval_call_abort(frame, a);
+            return lval_err("Function passed too many arguments. Got %i, Expected %i.",
+                            given_args - held, total_args - held);
         }
 
-        // Pop the first symbol from the formals
-        lval* sym = lval_pop(f->formals, 0);
+        // Take the next symbol from the formals
+        lval* sym = lval_index(f->formals, i++);
 
         // Special case to deal with '&'
-        if(strcmp(sym->sym, "&") == 0) {
+        if(sym->sym == amp) {
 
             // Ensure '&' is followed by another symbol
-            if(f->formals->count != 1) {
-                lval_del(a);
+            if(i != total_args - 1) {
+                lval_call_abort(frame, a);
                 return lval_err("Function format invalid. Symbol '&' not followed by single symbol");
             }
 
-            // Next formal should be bound to remaining arguments
-            lval* nsym = lval_pop(f->formals, 0);
-            lenv_put(f->env, nsym, builtin_list(e, a));
-            lval_del(sym);
-            lval_del(nsym);
+            // Next formal should be bound to the remaining arguments, which
+            // are released with the argument list below.
+            a = builtin_list(frame, a);
+            lenv_put(frame, lval_index(f->formals, i++), a);
             break;
 
         }
@@ -644,69 +1342,240 @@ lval* lval_call(lenv* e, lval* f, lval* a) {
         // Pop the next argument from the list
         lval* val = lval_pop(a, 0);
 
-        // Bind a copy into the function's environment
-        lenv_put(f->env, sym, val);
-
-        // Delete symbol and value.
-        lval_del(sym);
+        // Bind a copy into the frame
+        lenv_put(frame, sym, val);
         lval_del(val);
 
     }
 
     // If '&' remains in formal list, then bind to empty list.
-    if(f->formals->count > 0 && strcmp(f->formals->cell[0]->sym, "&") == 0) {
+    if(i < total_args && lval_index(f->formals, i)->sym == amp) {
 
         // Check to ensure that & is not passed invalidly
-        if(f->formals->count != 2) {
+        if(total_args - i != 2) {
+            lval_call_abort(frame, a);
             return lval_err("Function format invalid. Symbol '&' not followed by single symbol");
         }
 
-        // Pop and delete '&' symbol.
-        lval_del(lval_pop(f->formals, 0));
-
-        // Pop next symbol and create empty list
-        lval* sym = lval_pop(f->formals, 0);
+        // Bind the symbol after '&' to an empty list.
         lval* val = lval_qexpr();
-
-        // Bind to environment and delete.
-        lenv_put(f->env, sym, val);
-        lval_del(sym);
+        lenv_put(frame, lval_index(f->formals, i + 1), val);
         lval_del(val);
 
     }
 
     // Argument list is now bound so can be cleaned up.
     lval_del(a);
+    return NULL;
 
-    // If all formals have been bound, then evaluate.
-    if(f->formals->count == 0) {
+}
 
-        // Set the parent environment to evaluation environment.
-        f->env->parent = e;
+// Interned variadic marker, compared by pointer.
+static char* lval_amp(void) {
 
-        // Evaluate and return
-        return builtin_eval(f->env, lval_add(lval_sexpr(), lval_copy(f->body)));
+    static char* amp = NULL;
+    if(!amp) {
+        amp = lsym_intern("&");
+    }
+    return amp;
 
-    // Otherwise, return partially evaluated function.
-    } else {
-        return lval_copy(f);
+}
+
+// True if a call of lambda f with n arguments only holds them, in a partial
+// application waiting for the rest: too few arguments, unless '&' is
+// reached first.
+bool lval_holds(lval* f, int n) {
+
+    if(n >= f->formals->count) {
+        return false;
+    }
+
+    for(int i = 0; i <= n; ++i) {
+        if(lval_index(f->formals, i)->sym == lval_amp()) {
+            return false;
+        }
     }
 
+    return true;
+
 }
 
-// Checks if two lvals are equal
-bool lval_eq(lval* x, lval* y) {
+// Bind arguments a of a call of user-defined function f from environment
+// e, of which the first held were held by a partial application, in a new
+// frame below e, pushed as a root, and set *frame to it. Returns NULL, or
+// else the value of the call without running it: a partial application
+// waiting for the rest of the arguments, or an error. Consumes a.
+lval* lval_bind(lenv* e, lval* f, lval* a, int held, lenv** frame) {
+
+    if(lval_holds(f, a->count)) {
+        return lval_partial(f, a);
+    }
+
+    *frame = lenv_frame(e, NULL, NULL, 0);
+    lgc_push_env(*frame);
+    return lval_call_bind(*frame, f, a, held, lval_amp());
+
+}
+
+// Calls a built-in or user-defined function.
+lval* lval_call(lenv* e, lval* f, lval* a) {
+
+    // If built-in function then simply call that
+    if(f->builtin) {
+        return f->builtin(e, a);
+    }
+
+    // Too few arguments run nothing: a partial application holds them,
+    // after those held already.
+    if(lval_is_partial(f) ? lval_holds(f->target, f->bound->count + a->count)
+                          : lval_holds(f, a->count)) {
+        if(lval_is_partial(f)) {
+            a = lval_join(lval_copy(f->bound), a);
+            f = f->target;
+        }
+        return lval_partial(f, a);
+    }
+
+    return lvm_apply(e, f, a);
+
+}
+
+// True if double d has exactly the integer value i.
+static bool lval_int_eq_num(int64_t i, double d) {
+
+    // Outside [-2^63, 2^63) d cannot be an int64_t (and NaN fails both).
+    if(!(d >= -9223372036854775808.0 && d < 9223372036854775808.0)) {
+        return false;
+    }
+
+    return (double)(int64_t)d == d && (int64_t)d == i;
+
+}
+
+// True if the Number d holds the same integer as the bignum b.
+static bool lval_big_eq_num(lbig* b, double d) {
+
+    if(!isfinite(d) || floor(d) != d) {
+        return false;
+    }
+
+    lbig* n = lbig_from_double(d);
+    bool eq = lbig_cmp(n, b) == 0;
+    lbig_free(n);
+
+    return eq;
+
+}
+
+// Order of integer i against double d, which is not NaN, exactly: -1, 0 or
+// 1 as i is less than, equal to or greater than d.
+int lval_int_cmp_num(int64_t i, double d) {
+
+    // Beyond [-2^63, 2^63), infinities included, d is past every int64_t.
+    if(d >= 9223372036854775808.0) {
+        return -1;
+    }
+    if(d < -9223372036854775808.0) {
+        return 1;
+    }
+
+    // Otherwise i is compared with the integer part of d, then its fraction.
+    double whole = floor(d);
+    int64_t n = (int64_t)whole;
+    if(i != n) {
+        return (i > n) - (i < n);
+    }
+
+    return whole < d ? -1 : 0;
+
+}
+
+// Order of Integer x against double d, which is not NaN, exactly: -1, 0 or
+// 1 as x is less than, equal to or greater than d.
+int lval_cmp_num(lval* x, double d) {
+
+    if(lval_type(x) == LVAL_INT) {
+        return lval_int_cmp_num(lval_int_value(x), d);
+    }
+
+    if(isinf(d)) {
+        return d > 0 ? -1 : 1;
+    }
+
+    double whole = floor(d);
+    lbig* n = lbig_from_double(whole);
+    int order = lbig_cmp(x->big, n);
+    lbig_free(n);
+
+    if(order != 0) {
+        return order;
+    }
+
+    return whole < d ? -1 : 0;
+
+}
+
+// Pairs that lval_eq can keep track of without allocating.
+#define LVAL_EQ_LOCAL 32
+
+// Pairs of lvals still to be compared by lval_eq.
+struct lval_pairs {
+    lval** v;
+    int count;
+    int capacity;
+};
+
+// Add the pair x, y to those still to be compared.
+static void lval_pairs_push(struct lval_pairs* p, lval* x, lval* y) {
+
+    // The first pairs are kept in lval_eq's own array.
+    if(p->count + 2 > p->capacity) {
+        if(p->capacity == 2 * LVAL_EQ_LOCAL) {
+            p->v = memcpy(malloc(sizeof(lval*) * p->capacity * 2), p->v, sizeof(lval*) * p->count);
+        } else {
+            p->v = realloc(p->v, sizeof(lval*) * p->capacity * 2);
+        }
+        p->capacity *= 2;
+    }
+
+    p->v[p->count++] = x;
+    p->v[p->count++] = y;
+
+}
+
+// Compare x and y apart from their elements, which are added to todo.
+static bool lval_eq_one(lval* x, lval* y, struct lval_pairs* todo) {
+
+    // Integers and Numbers compare by value.
+    if(lval_type(x) == LVAL_INT && lval_type(y) == LVAL_NUM) {
+        return lval_int_eq_num(lval_int_value(x), lval_num_value(y));
+    }
+    if(lval_type(x) == LVAL_NUM && lval_type(y) == LVAL_INT) {
+        return lval_int_eq_num(lval_int_value(y), lval_num_value(x));
+    }
+    if(lval_type(x) == LVAL_BIG && lval_type(y) == LVAL_NUM) {
+        return lval_big_eq_num(x->big, lval_num_value(y));
+    }
+    if(lval_type(x) == LVAL_NUM && lval_type(y) == LVAL_BIG) {
+        return lval_big_eq_num(y->big, lval_num_value(x));
+    }
 
     // Different types are always unequal.
-    if(x->type != y->type) {
+    if(lval_type(x) != lval_type(y)) {
         return 0;
     }
 
     // Compare based upon type
-    switch(x->type) {
+    switch(lval_type(x)) {
 
         case LVAL_NUM:
-            return (x->num == y->num);
+            return (lval_num_value(x) == lval_num_value(y));
+
+        case LVAL_INT:
+            return (lval_int_value(x) == lval_int_value(y));
+
+        case LVAL_BIG:
+            return lbig_cmp(x->big, y->big) == 0;
 
         case LVAL_BOOL:
             return (x->val == y->val);
@@ -714,8 +1583,9 @@ bool lval_eq(lval* x, lval* y) {
         case LVAL_ERR:
             return (strcmp(x->err, y->err) == 0);
         
+        // Interned symbols are equal exactly when their names are the same pointer.
         case LVAL_SYM:
-            return (strcmp(x->sym, y->sym) == 0);
+            return (x->sym == y->sym);
 
         case LVAL_STR:
             return (strcmp(x->str, y->str) == 0);
@@ -725,10 +1595,22 @@ bool lval_eq(lval* x, lval* y) {
             // Compare builtin function pointers are equal.
             if(x->builtin || y->builtin) {
                 return (x->builtin == y->builtin);
-            
+
+            // Partial applications are equal if they apply equal functions
+            // to equal arguments.
+            } else if(x->target || y->target) {
+                if(!x->target || !y->target) {
+                    return false;
+                }
+                lval_pairs_push(todo, x->bound, y->bound);
+                lval_pairs_push(todo, x->target, y->target);
+                return true;
+
             // Compare user-defined function parameters and body are equal.
             } else {
-                return lval_eq(x->formals, y->formals) && lval_eq(x->body, y->body);
+                lval_pairs_push(todo, x->body, y->body);
+                lval_pairs_push(todo, x->formals, y->formals);
+                return true;
             }
 
         // If List type, compare every individual element
@@ -740,16 +1622,17 @@ bool lval_eq(lval* x, lval* y) {
                 return false;
             }
 
-            // If any element is not equal then the whole list is not equal.
-            for(int i = 0; i < x->count; ++i) {
-                if(!lval_eq(x->cell[i], y->cell[i])) {
-                    return false;
-                }
+            // Every element must be equal too. Pushed last to first so the
+            // first are compared first.
+            for(int i = x->count - 1; i >= 0; --i) {
+                lval_pairs_push(todo, lval_index(x, i), lval_index(y, i));
             }
-
-            // Otherwise lists must be equal.
             return true;
 
+        // Maps are equal if they have the same keys bound to equal values.
+        case LVAL_MAP:
+            return x->size == y->size && lmap_subset(x->map, y->map);
+
         // Okay types are always equal since they contain no special data.
         case LVAL_OKAY:
             return true;
@@ -760,3 +1643,123 @@ bool lval_eq(lval* x, lval* y) {
     }
 
 }
+
+// Checks if two lvals are equal. Nested elements are compared from a list
+// of pairs rather than recursively, so depth cannot use up the C stack.
+bool lval_eq(lval* x, lval* y) {
+
+    lval* local[2 * LVAL_EQ_LOCAL];
+    struct lval_pairs todo = { local, 0, 2 * LVAL_EQ_LOCAL };
+    bool eq = lval_eq_one(x, y, &todo);
+
+    while(eq && todo.count) {
+        todo.count -= 2;
+        eq = lval_eq_one(todo.v[todo.count], todo.v[todo.count + 1], &todo);
+    }
+
+    if(todo.v != local) {
+        free(todo.v);
+    }
+
+    return eq;
+
+}
+
+// Hash a null terminated string (FNV-1a).
+static unsigned lval_hash_str(char* s) {
+
+    unsigned h = 2166136261u;
+    while(*s) {
+        h ^= (unsigned char)*s++;
+        h *= 16777619u;
+    }
+
+    return h;
+
+}
+
+// Hash 64 bits down to 32.
+static unsigned lval_hash_bits(uint64_t bits) {
+
+    bits ^= bits >> 33;
+    bits *= 0xff51afd7ed558ccdULL;
+    bits ^= bits >> 33;
+
+    return (unsigned)bits;
+
+}
+
+// Hash an lval. Values that are lval_eq hash equally.
+unsigned lval_hash(lval* v) {
+
+    switch(lval_type(v)) {
+
+        // Numbers with an integer value hash as that Integer, which also
+        // makes -0 hash like 0. Otherwise hash the bits.
+        case LVAL_NUM: {
+            double x = lval_num_value(v);
+            uint64_t bits;
+            if(x >= -9223372036854775808.0 && x < 9223372036854775808.0
+                    && (double)(int64_t)x == x) {
+                bits = (uint64_t)(int64_t)x;
+
+            // Larger integer values hash like the equal bignum.
+            } else if(isfinite(x) && floor(x) == x) {
+                lbig* b = lbig_from_double(x);
+                unsigned h = lbig_hash(b);
+                lbig_free(b);
+                return h;
+
+            } else {
+                memcpy(&bits, &x, sizeof(bits));
+            }
+            return lval_hash_bits(bits);
+        }
+
+        case LVAL_INT:
+            return lval_hash_bits((uint64_t)lval_int_value(v));
+
+        case LVAL_BIG:
+            return lbig_hash(v->big);
+
+        case LVAL_BOOL:
+            return v->val ? 1231 : 1237;
+
+        case LVAL_ERR:
+            return lval_hash_str(v->err);
+
+        case LVAL_SYM:
+            return lval_hash_str(v->sym) ^ 0x5bd1e995;
+
+        case LVAL_STR:
+            return lval_hash_str(v->str);
+
+        case LVAL_FUN:
+            if(v->builtin) {
+                return (unsigned)((size_t)v->builtin >> 3) * 2654435761u;
+            }
+            if(v->target) {
+                return lval_hash(v->target) * 31 + lval_hash(v->bound);
+            }
+            return lval_hash(v->formals) * 31 + lval_hash(v->body);
+
+        // Combine the elements in order.
+        case LVAL_SEXPR:
+        case LVAL_QEXPR: {
+            unsigned h = lval_type(v);
+            for(int i = 0; i < v->count; ++i) {
+                h = h * 31 + lval_hash(lval_index(v, i));
+            }
+            return h;
+        }
+
+        case LVAL_MAP:
+            return lmap_hash(v->map);
+
+        case LVAL_OKAY:
+        default:
+            return 0;
+
+    }
+
+}
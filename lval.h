@@ -1,25 +1,44 @@
 #ifndef LVAL_H
 #define LVAL_H
 
+#include <inttypes.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "lbig.h"
 #include "lbuiltin.h"
 #include "lenv.h"
+#include "lgc.h"
+#include "lmap.h"
+#include "lsym.h"
+#include "lvec.h"
+#include "lvm.h"
 #include "mpc.h"
 
+// Q-Expressions joined to more than this many elements are stored as
+// persistent vectors; slices of a vector shorter than half of it go back to
+// flat cell arrays. Define it as a huge number to keep every list flat.
+#ifndef LVAL_VEC_MIN
+#define LVAL_VEC_MIN 128
+#endif
+
 // Possible lisp types
 enum lval_type {
     LVAL_ERR, // Errors
     LVAL_NUM, // Numbers
+    LVAL_INT, // Integers
+    LVAL_BIG, // Integers too large for an int64_t
     LVAL_BOOL, // Booleans
     LVAL_SYM, // Symbols (variable names, function names, etc.)
     LVAL_STR, // Strings
     LVAL_FUN, // Functions
     LVAL_SEXPR, // Symbolic expresisons
     LVAL_QEXPR, // Quoted expressions
+    LVAL_MAP, // Hash maps
     LVAL_OKAY // Acknowledgement that an expression evaluated without error.
 };
 
@@ -31,30 +50,210 @@ struct lval {
 
     enum lval_type type;
 
-    // Basic
-    double num;
-    bool val;
-    char* err;
-    char* sym;
-    char* str;
+    // Number of owners sharing this value. Shared values are immutable;
+    // use lval_unshare before modifying one.
+    int refs;
+
+    // Collector bookkeeping: flags, mark epoch and, for old lvals, position
+    // in the heap registry or, for young lvals that have been moved, where to.
+    unsigned char gc_flags;
+    unsigned mark;
+    union {
+        long slot;
+        lval* forward;
+    };
+
+    // Only the member for this lval's type is allocated (see lval_sizeof).
+    union {
+
+        // Basic
+        double num;
+        int64_t integer;
+        struct lbig* big;
+        bool val;
+        char* err;
+        char* sym; // Interned, never freed
+        char* str;
+
+        // Function: a builtin, a lambda, or a lambda partially applied to
+        // the arguments in bound, a list, waiting for the rest. Only the
+        // fields of the kind in question are set.
+        struct {
+            lbuiltin builtin;
+            lval* formals;
+            lval* body;
+            struct lcode* code; // Compiled on first call, or NULL
+            lval* target; // Lambda partially applied, or NULL
+            lval* bound;
+        };
+
+        // Variable array of lvals and corresponding count
+        // For expressions. cell points start slots into an allocation of
+        // capacity slots, so popping from the front just advances it.
+        // A slice view has a backing list that owns the cells instead, and
+        // a long Q-Expression may keep its elements in a persistent vector.
+        struct {
+            int count;
+            int start;
+            int capacity;
+            struct lval* backing;
+            struct lvec* vec;
+            struct lval** cell;
+        };
+
+        // Map: root of its trie (NULL when empty) and number of keys.
+        struct {
+            struct lmap* map;
+            int size;
+        };
+
+    };
 
-    // Function
-    lbuiltin builtin;
-    lenv* env;
-    lval* formals;
-    lval* body;
+};
 
-    // Variable array of lvals and corresponding count
-    // For expressions
-    int count;
-    struct lval** cell;
+// Reference count of values that are never freed, such as the Booleans.
+#ifndef LVAL_IMMORTAL
+#define LVAL_IMMORTAL (1 << 30)
+#endif
 
-};
+// Number of bytes allocated for an lval of the given type.
+size_t lval_sizeof(enum lval_type type);
+
+// Numbers, and Integers from LVAL_IMM_MIN to LVAL_IMM_MAX, are immediates:
+// the lval* holds the value itself rather than pointing at it, so making
+// one allocates nothing and a list of them is a flat array of 8-byte words.
+// Pointers to lvals have their top 16 bits clear. An immediate Integer has
+// them all set and its value in the other 48; every other word is a Number
+// whose bits are offset by 2^49, which keeps them clear of both (NaNs are
+// made canonical first). Immediates have no header, so read their type and
+// value with lval_type, lval_num_value and lval_int_value. Define
+// LVAL_BOXED to allocate every number instead.
+#if !defined(LVAL_BOXED) && UINTPTR_MAX == UINT64_MAX
+#define LVAL_IMMEDIATE
+#endif
+
+// Accessors that cost no more than the fields they stand for, inlined
+// however big the function calling them, as macros would be.
+#if defined(__GNUC__) || defined(__clang__)
+#define LVAL_INLINE static inline __attribute__((always_inline))
+#else
+#define LVAL_INLINE static inline
+#endif
+
+#ifdef LVAL_IMMEDIATE
+
+#define LVAL_INT_TAG UINT64_C(0xFFFF000000000000)
+#define LVAL_NUM_OFFSET (UINT64_C(1) << 49)
+#define LVAL_IMM_MIN (-(INT64_C(1) << 47))
+#define LVAL_IMM_MAX ((INT64_C(1) << 47) - 1)
+
+// The bits of an lval*.
+#define lval_bits(v) ((uint64_t)(uintptr_t)(v))
+
+// True if v points at an lval, false if it is an immediate.
+#define lval_is_heap(v) (lval_bits(v) >> 48 == 0)
+
+// Type of any lval, immediate or not.
+LVAL_INLINE enum lval_type lval_type(lval* v) {
+
+    uint64_t tag = lval_bits(v) >> 48;
+    return tag == 0 ? v->type : tag == 0xFFFF ? LVAL_INT : LVAL_NUM;
+
+}
+
+// Value of a Number.
+LVAL_INLINE double lval_num_value(lval* v) {
+
+    uint64_t bits = lval_bits(v) - LVAL_NUM_OFFSET;
+    double x;
+    memcpy(&x, &bits, sizeof(x));
+    return x;
+
+}
+
+// Value of an Integer that fits an int64_t.
+LVAL_INLINE int64_t lval_int_value(lval* v) {
+    return lval_is_heap(v) ? v->integer : (int64_t)(lval_bits(v) << 16) >> 16;
+}
+
+// Make a Number. Never allocates.
+LVAL_INLINE lval* lval_num(double x) {
+
+    uint64_t bits = UINT64_C(0x7FF8000000000000);
+    if(x == x) {
+        memcpy(&bits, &x, sizeof(bits));
+    }
+    return (lval*)(uintptr_t)(bits + LVAL_NUM_OFFSET);
+
+}
+
+// Construct an Integer lval, allocating only outside LVAL_IMM_MIN to
+// LVAL_IMM_MAX.
+lval* lval_int_boxed(int64_t x);
+
+LVAL_INLINE lval* lval_int(int64_t x) {
+
+    if(x < LVAL_IMM_MIN || x > LVAL_IMM_MAX) {
+        return lval_int_boxed(x);
+    }
+    return (lval*)(uintptr_t)(LVAL_INT_TAG | ((uint64_t)x & ~LVAL_INT_TAG));
+
+}
+
+// Every small Integer is an immediate already.
+#define lval_int_shared(x) lval_int(x)
+
+#else
+
+#define lval_is_heap(v) true
+#define lval_type(v) ((v)->type)
+#define lval_num_value(v) ((v)->num)
+#define lval_int_value(v) ((v)->integer)
 
 // Construct a pointer to a new Number lval
 lval* lval_num(double x);
 
-// Construct a pointer to a new Boolean lval.
+// Construct a pointer to a new Integer lval
+lval* lval_int(int64_t x);
+
+// Range of the Integers that lval_int_shared does not allocate.
+#define LVAL_SMALL_MIN -128
+#define LVAL_SMALL_MAX 1023
+
+// Return an Integer lval for x, shared when x is small. Never allocates a
+// small Integer, but the result must be unshared before it is modified.
+lval* lval_int_shared(int64_t x);
+
+#endif
+
+// Name of v's type for error messages, calling every number a Number.
+char* lval_type_name(lval* v);
+
+// Construct an Integer lval from a bignum, consuming it. Values that fit
+// in an int64_t become plain Integers, so each integer has one form.
+lval* lval_big(lbig* x);
+
+// True if v is an Integer, of either size.
+#define lval_is_integer(v) (lval_type(v) == LVAL_INT || lval_type(v) == LVAL_BIG)
+
+// True if v is an Integer or a Number.
+#define lval_is_number(v) (lval_is_integer(v) || lval_type(v) == LVAL_NUM)
+
+// View an Integer as a bignum, using space for one that fits an int64_t.
+lbig* lval_to_big(lval* v, lbig_int* space);
+
+// Value of an Integer or Number as a double.
+double lval_as_double(lval* v);
+
+// Order of integer i against double d, which is not NaN, exactly: -1, 0 or
+// 1 as i is less than, equal to or greater than d.
+int lval_int_cmp_num(int64_t i, double d);
+
+// Order of Integer x against double d, which is not NaN, exactly: -1, 0 or
+// 1 as x is less than, equal to or greater than d.
+int lval_cmp_num(lval* x, double d);
+
+// Return the shared Boolean lval for x. Never allocates.
 lval* lval_bool(bool x);
 
 // Construct a pointer to a new Error lval
@@ -72,24 +271,87 @@ lval* lval_fun(lbuiltin func);
 // Construct a pointer to a new user-defined Function lval
 lval* lval_lambda(lval* formals, lval* body);
 
+// True if Function v is a partial application.
+#define lval_is_partial(v) (!(v)->builtin && (v)->target)
+
 // Construct a pointer to a new emtpy Sexpr lval
 lval* lval_sexpr(void);
 
 // Construct a pointer to a new empty Qexpr lval
 lval* lval_qexpr(void);
 
-// Construct a pointer to a new Okay lval.
+// Construct a pointer to a new empty Map lval
+lval* lval_map(void);
+
+// Return the shared Okay lval. Never allocates.
 lval* lval_okay(void);
 
-// Copy an lval (useful when putting things in/out of the environment)
-lval* lval_copy(lval* v);
+// Share an lval by taking another reference to it (useful when putting
+// things in/out of the environment). This is O(1) regardless of size, and
+// defined here so that every caller inlines it.
+LVAL_INLINE lval* lval_copy(lval* v) {
+
+    if(lval_is_heap(v)) {
+        v->refs++;
+    }
+    return v;
+
+}
+
+// Return a version of v that the caller may mutate: v itself when it has a
+// single owner, otherwise a shallow copy whose elements are shared.
+// Consumes the caller's reference to v. Immediates come back unchanged, so
+// a number is replaced, never modified.
+lval* lval_unshare(lval* v);
 
-// Delete a Lisp Value.
-void lval_del(lval* v);
+// Delete a Lisp Value whose last reference has been released.
+void lval_free(lval* v);
+
+// Release a reference to a Lisp Value, deleting it once none remain.
+LVAL_INLINE void lval_del(lval* v) {
+
+    if(lval_is_heap(v) && --v->refs <= 0) {
+        lval_free(v);
+    }
+
+}
 
 // Add an element to an S-Expression or Q-Expression
 lval* lval_add(lval* v, lval* x);
 
+// Make room for at least n more elements at the end of a list.
+void lval_reserve(lval* v, int n);
+
+// Free the cell array of a list.
+void lval_free_cells(lval* v);
+
+// Return (without a new reference) element i of a list.
+lval* lval_index(lval* v, int i);
+
+// Give a slice or vector list a flat cell array of its own, in place.
+void lval_flatten(lval* v);
+
+// Return a list with element i replaced by x. Consumes v and x.
+lval* lval_update(lval* v, int i, lval* x);
+
+// Take count elements of a list starting at offset, sharing its cells.
+lval* lval_slice(lval* v, int offset, int count);
+
+// Return (without a new reference) the value of key in map m, or NULL.
+lval* lval_map_get(lval* m, lval* key);
+
+// Return map m with key bound to val. Consumes m, key and val.
+lval* lval_map_put(lval* m, lval* key, lval* val);
+
+// Return map m without key. Consumes m and key.
+lval* lval_map_del(lval* m, lval* key);
+
+// Return a Q-Expression of the keys of map m. Consumes m.
+lval* lval_map_keys(lval* m);
+
+// Create the parsers of Blisp source, whose output lval_read reads.
+void lval_read_init(void);
+
 // Convert an AST number to an lval number and check for error.
 lval* lval_read_num(mpc_ast_t* t);
 
@@ -108,6 +370,9 @@ void lval_func_print(lenv* e, lval* v);
 // Print a String type lval.
 void lval_print_str(lval* v);
 
+// Print a Map type lval.
+void lval_map_print(lenv* e, lval* v);
+
 // Print an lval.
 void lval_print(lenv* e, lval* v);
 
@@ -126,13 +391,35 @@ lval* lval_join(lval* x, lval* y);
 // Evaluate an Expression.
 lval* lval_eval(lenv* e, lval* v);
 
+// Evaluate each expression of program in turn, as loading a file does,
+// printing those that fail. Consumes program.
+void lval_eval_all(lenv* e, lval* program);
+
+// Evaluate list v as an S-Expression, leaving v unchanged, so that quoted
+// bodies run without being copied or retagged.
+lval* lval_eval_list(lenv* e, lval* v);
+
 // Evaluate an S-Expression.
 lval* lval_eval_sexpr(lenv* e, lval* v);
 
 // Calls a built-in or user-defined function.
 lval* lval_call(lenv* e, lval* f, lval* a);
 
+// True if a call of lambda f with n arguments only holds them, in a partial
+// application waiting for the rest.
+bool lval_holds(lval* f, int n);
+
+// Bind arguments a of a call of user-defined function f from environment
+// e, of which the first held were held by a partial application, in a new
+// frame below e, pushed as a root, and set *frame to it. Returns NULL, or
+// else the value of the call without running it: a partial application
+// waiting for the rest of the arguments, or an error. Consumes a.
+lval* lval_bind(lenv* e, lval* f, lval* a, int held, lenv** frame);
+
 // Checks if two lvals are equal
 bool lval_eq(lval* x, lval* y);
 
+// Hash an lval. Values that are lval_eq hash equally.
+unsigned lval_hash(lval* v);
+
 #endif
@@ -0,0 +1,447 @@
+#include "lvec.h"
+#include "lval.h"
+
+// A rebalanced level may use this many more nodes than the minimum needed
+// to hold its slots. Higher values make concatenation cheaper and indexing
+// slightly slower.
+#define LVEC_EXTRAS 2
+
+// Bytes used by a node of the given height and slot count.
+static size_t lvec_bytes(int height, int count) {
+
+    size_t bytes = offsetof(lvec, slot) + sizeof(union lvec_slot) * count;
+
+    // Branches also keep their cumulative sizes.
+    if(height) {
+        bytes += sizeof(int) * count;
+    }
+
+    return bytes;
+
+}
+
+// Build a node of the given height from count slots, taking a new reference
+// to each.
+static lvec* lvec_make(int height, union lvec_slot* slots, int count) {
+
+    lvec* n = lmem_alloc(lvec_bytes(height, count));
+    n->refs = 1;
+    n->mark = 0;
+    n->height = height;
+    n->young = false;
+    n->count = count;
+    n->size = 0;
+
+    for(int i = 0; i < count; ++i) {
+        if(height) {
+            n->slot[i].node = lvec_retain(slots[i].node);
+            n->size += slots[i].node->size;
+            lvec_sizes(n)[i] = n->size;
+            n->young |= slots[i].node->young;
+        } else {
+            n->slot[i].val = lval_copy(slots[i].val);
+            n->size++;
+            n->young |= lgc_is_young(slots[i].val);
+        }
+    }
+
+    return n;
+
+}
+
+// Copy a node, sharing everything it references.
+static lvec* lvec_clone(lvec* n) {
+
+    size_t bytes = lvec_bytes(n->height, n->count);
+    lvec* x = lmem_alloc(bytes);
+    memcpy(x, n, bytes);
+    x->refs = 1;
+    x->mark = 0;
+
+    for(int i = 0; i < x->count; ++i) {
+        if(x->height) {
+            lvec_retain(x->slot[i].node);
+        } else {
+            lval_copy(x->slot[i].val);
+        }
+    }
+
+    return x;
+
+}
+
+// Replace a root with a single child by that child, as often as possible.
+static lvec* lvec_trim(lvec* n) {
+
+    while(n->height && n->count == 1) {
+        lvec* child = lvec_retain(n->slot[0].node);
+        lvec_release(n);
+        n = child;
+    }
+
+    return n;
+
+}
+
+// Build a vector holding references to count (at least 1) lvals.
+lvec* lvec_from(lval** vals, int count) {
+
+    union lvec_slot buffer[LVEC_WIDTH];
+
+    // Pack the lvals into full leaves.
+    int n = (count + LVEC_WIDTH - 1) / LVEC_WIDTH;
+    lvec** level = malloc(sizeof(lvec*) * n);
+
+    for(int i = 0; i < n; ++i) {
+        int len = count - i * LVEC_WIDTH < LVEC_WIDTH ? count - i * LVEC_WIDTH : LVEC_WIDTH;
+        for(int j = 0; j < len; ++j) {
+            buffer[j].val = vals[i * LVEC_WIDTH + j];
+        }
+        level[i] = lvec_make(0, buffer, len);
+    }
+
+    // Then group each level under full parents until one root is left.
+    for(int height = 1; n > 1; ++height) {
+
+        int parents = (n + LVEC_WIDTH - 1) / LVEC_WIDTH;
+
+        for(int i = 0; i < parents; ++i) {
+            int len = n - i * LVEC_WIDTH < LVEC_WIDTH ? n - i * LVEC_WIDTH : LVEC_WIDTH;
+            for(int j = 0; j < len; ++j) {
+                buffer[j].node = level[i * LVEC_WIDTH + j];
+            }
+            level[i] = lvec_make(height, buffer, len);
+            for(int j = 0; j < len; ++j) {
+                lvec_release(buffer[j].node);
+            }
+        }
+
+        n = parents;
+
+    }
+
+    lvec* root = level[0];
+    free(level);
+    return root;
+
+}
+
+// Share a vector.
+lvec* lvec_retain(lvec* n) {
+
+    n->refs++;
+    return n;
+
+}
+
+// Release a reference to a vector, freeing it with the last one.
+void lvec_release(lvec* n) {
+
+    if(--n->refs > 0) {
+        return;
+    }
+
+    for(int i = 0; i < n->count; ++i) {
+        if(n->height) {
+            lvec_release(n->slot[i].node);
+        } else {
+            lval_del(n->slot[i].val);
+        }
+    }
+
+    lvec_free(n);
+
+}
+
+// Free the storage of a single node without releasing what it references.
+void lvec_free(lvec* n) {
+    lmem_free(n, lvec_bytes(n->height, n->count));
+}
+
+// Find the child of branch n holding index *i, and make *i relative to it.
+static int lvec_child(lvec* n, int* i) {
+
+    // Each child holds at most LVEC_WIDTH^height lvals, so the radix index
+    // is a lower bound on the slot. Relaxed nodes may need a few steps more.
+    int shift = LVEC_BITS * n->height;
+    int s = shift < 31 ? *i >> shift : 0;
+
+    int* sizes = lvec_sizes(n);
+    while(sizes[s] <= *i) {
+        s++;
+    }
+
+    if(s > 0) {
+        *i -= sizes[s - 1];
+    }
+
+    return s;
+
+}
+
+// Return (without a new reference) the lval at index i.
+lval* lvec_get(lvec* n, int i) {
+
+    while(n->height) {
+        n = n->slot[lvec_child(n, &i)].node;
+    }
+
+    return n->slot[i].val;
+
+}
+
+// Return a new vector with index i replaced by x. Consumes x.
+lvec* lvec_set(lvec* n, int i, lval* x) {
+
+    lvec* c = lvec_clone(n);
+
+    if(!c->height) {
+        lval_del(c->slot[i].val);
+        c->slot[i].val = x;
+        c->young |= lgc_is_young(x);
+        return c;
+    }
+
+    // Copy the path down to the leaf.
+    int s = lvec_child(c, &i);
+    lvec* child = lvec_set(c->slot[s].node, i, x);
+    lvec_release(c->slot[s].node);
+    c->slot[s].node = child;
+    c->young |= child->young;
+
+    return c;
+
+}
+
+// Return a node of the same height as n holding its lvals from index from
+// up to, but not including, index to.
+static lvec* lvec_sub(lvec* n, int from, int to) {
+
+    if(from == 0 && to == n->size) {
+        return lvec_retain(n);
+    }
+
+    union lvec_slot buffer[LVEC_WIDTH];
+
+    if(!n->height) {
+        memcpy(buffer, &n->slot[from], sizeof(union lvec_slot) * (to - from));
+        return lvec_make(0, buffer, to - from);
+    }
+
+    // Children strictly inside the range are shared whole; the two at its
+    // edges are cut down recursively.
+    int lo = from;
+    int hi = to - 1;
+    int first = lvec_child(n, &lo);
+    int last = lvec_child(n, &hi);
+
+    int count = 0;
+    for(int s = first; s <= last; ++s) {
+        lvec* child = n->slot[s].node;
+        buffer[count++].node = lvec_sub(child, s == first ? lo : 0, s == last ? hi + 1 : child->size);
+    }
+
+    lvec* x = lvec_make(n->height, buffer, count);
+    for(int i = 0; i < count; ++i) {
+        lvec_release(buffer[i].node);
+    }
+
+    return x;
+
+}
+
+// Return a new vector holding count lvals of n starting at offset.
+lvec* lvec_slice(lvec* n, int offset, int count) {
+    return lvec_trim(lvec_sub(n, offset, offset + count));
+}
+
+// Redistribute the slots of count nodes of the same height over as few new
+// nodes as needed to stay within LVEC_EXTRAS of the optimum, writing new
+// references to them into out. Returns how many were written.
+static int lvec_rebalance(lvec** nodes, int count, lvec** out) {
+
+    int plan[2 * LVEC_WIDTH];
+    int total = 0;
+    for(int i = 0; i < count; ++i) {
+        plan[i] = nodes[i]->count;
+        total += plan[i];
+    }
+
+    // Plan the new node sizes: repeatedly find the first node that is not
+    // nearly full and spread its slots over the nodes after it.
+    int optimal = (total + LVEC_WIDTH - 1) / LVEC_WIDTH;
+    int length = count;
+    int i = 0;
+
+    while(length > optimal + LVEC_EXTRAS) {
+
+        while(plan[i] > LVEC_WIDTH - 1) {
+            i++;
+        }
+
+        int remaining = plan[i];
+        do {
+            int fill = remaining + plan[i + 1] < LVEC_WIDTH ? remaining + plan[i + 1] : LVEC_WIDTH;
+            remaining += plan[i + 1] - fill;
+            plan[i] = fill;
+            i++;
+        } while(remaining > 0);
+
+        // The last node visited was emptied.
+        for(int j = i; j < length - 1; ++j) {
+            plan[j] = plan[j + 1];
+        }
+        length--;
+        i--;
+
+    }
+
+    // Carry out the plan, reusing nodes whose contents do not change.
+    union lvec_slot buffer[LVEC_WIDTH];
+    int height = nodes[0]->height;
+    int node = 0;
+    int offset = 0;
+
+    for(int p = 0; p < length; ++p) {
+
+        if(offset == 0 && nodes[node]->count == plan[p]) {
+            out[p] = lvec_retain(nodes[node++]);
+            continue;
+        }
+
+        int filled = 0;
+        while(filled < plan[p]) {
+            int take = nodes[node]->count - offset;
+            if(take > plan[p] - filled) {
+                take = plan[p] - filled;
+            }
+            memcpy(&buffer[filled], &nodes[node]->slot[offset], sizeof(union lvec_slot) * take);
+            filled += take;
+            offset += take;
+            if(offset == nodes[node]->count) {
+                node++;
+                offset = 0;
+            }
+        }
+
+        out[p] = lvec_make(height, buffer, plan[p]);
+
+    }
+
+    return length;
+
+}
+
+// Concatenate the trees a and b into a node one level above the taller.
+static lvec* lvec_merge(lvec* a, lvec* b) {
+
+    union lvec_slot buffer[2 * LVEC_WIDTH];
+
+    // Two leaves become one if they fit, otherwise they sit side by side.
+    if(!a->height && !b->height) {
+
+        if(a->count + b->count > LVEC_WIDTH) {
+            buffer[0].node = a;
+            buffer[1].node = b;
+            return lvec_make(1, buffer, 2);
+        }
+
+        memcpy(buffer, a->slot, sizeof(union lvec_slot) * a->count);
+        memcpy(&buffer[a->count], b->slot, sizeof(union lvec_slot) * b->count);
+        lvec* leaf = lvec_make(0, buffer, a->count + b->count);
+        buffer[0].node = leaf;
+        lvec* x = lvec_make(1, buffer, 1);
+        lvec_release(leaf);
+        return x;
+
+    }
+
+    // Otherwise merge the facing edges of the two trees...
+    lvec* left = NULL;
+    lvec* right = NULL;
+    lvec* mid;
+
+    if(a->height > b->height) {
+        left = a;
+        mid = lvec_merge(a->slot[a->count - 1].node, b);
+    } else if(a->height < b->height) {
+        right = b;
+        mid = lvec_merge(a, b->slot[0].node);
+    } else {
+        left = a;
+        right = b;
+        mid = lvec_merge(a->slot[a->count - 1].node, b->slot[0].node);
+    }
+
+    // ...and rebalance the result together with the remaining children.
+    lvec* nodes[2 * LVEC_WIDTH];
+    int count = 0;
+
+    if(left) {
+        for(int i = 0; i < left->count - 1; ++i) {
+            nodes[count++] = left->slot[i].node;
+        }
+    }
+    for(int i = 0; i < mid->count; ++i) {
+        nodes[count++] = mid->slot[i].node;
+    }
+    if(right) {
+        for(int i = 1; i < right->count; ++i) {
+            nodes[count++] = right->slot[i].node;
+        }
+    }
+
+    lvec* out[2 * LVEC_WIDTH];
+    int length = lvec_rebalance(nodes, count, out);
+    int height = mid->height;
+    lvec_release(mid);
+
+    // At most two full nodes' worth is left: put them under a new parent.
+    lvec* parts[2];
+    int part_count = 0;
+
+    for(int p = 0; p < length; p += LVEC_WIDTH) {
+        int len = length - p < LVEC_WIDTH ? length - p : LVEC_WIDTH;
+        for(int j = 0; j < len; ++j) {
+            buffer[j].node = out[p + j];
+        }
+        parts[part_count++] = lvec_make(height, buffer, len);
+    }
+
+    for(int p = 0; p < length; ++p) {
+        lvec_release(out[p]);
+    }
+
+    for(int p = 0; p < part_count; ++p) {
+        buffer[p].node = parts[p];
+    }
+    lvec* x = lvec_make(height + 1, buffer, part_count);
+    for(int p = 0; p < part_count; ++p) {
+        lvec_release(parts[p]);
+    }
+
+    return x;
+
+}
+
+// Return a new vector holding the lvals of a followed by those of b.
+lvec* lvec_concat(lvec* a, lvec* b) {
+    return lvec_trim(lvec_merge(a, b));
+}
+
+// Store new references to every lval of n, in order, into out.
+void lvec_copy_out(lvec* n, lval** out) {
+
+    if(!n->height) {
+        for(int i = 0; i < n->count; ++i) {
+            out[i] = lval_copy(n->slot[i].val);
+        }
+        return;
+    }
+
+    for(int i = 0; i < n->count; ++i) {
+        lvec_copy_out(n->slot[i].node, out);
+        out += n->slot[i].node->size;
+    }
+
+}
@@ -0,0 +1,68 @@
+#ifndef LVEC_H
+#define LVEC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "lbuiltin.h"
+#include "lmem.h"
+
+// Branching factor of persistent vector nodes, as a power of two.
+#ifndef LVEC_BITS
+#define LVEC_BITS 5
+#endif
+#define LVEC_WIDTH (1 << LVEC_BITS)
+
+typedef struct lvec lvec;
+
+// A slot holds an lval in a leaf and a child node in a branch.
+union lvec_slot {
+    lval* val;
+    lvec* node;
+};
+
+// Node of a relaxed radix balanced (RRB) tree, the persistent vector behind
+// long Q-Expressions. Leaves have height 0. Nodes need not be full, so every
+// branch also keeps the cumulative number of lvals under each child, stored
+// just after its slots. Nodes are never changed once built; updates copy the
+// path to the root and share everything else by reference count.
+struct lvec {
+    int refs;
+    unsigned mark; // Collector epoch
+    unsigned char height;
+    bool young; // May reference young lvals, directly or through children
+    int count; // Slots used
+    int size; // Lvals under this node
+    union lvec_slot slot[];
+};
+
+// Cumulative lval counts of a branch.
+#define lvec_sizes(n) ((int*)&(n)->slot[(n)->count])
+
+// Build a vector holding references to count (at least 1) lvals.
+lvec* lvec_from(lval** vals, int count);
+
+// Share a vector.
+lvec* lvec_retain(lvec* n);
+
+// Release a reference to a vector, freeing it with the last one.
+void lvec_release(lvec* n);
+
+// Free the storage of a single node without releasing what it references.
+void lvec_free(lvec* n);
+
+// Return (without a new reference) the lval at index i.
+lval* lvec_get(lvec* n, int i);
+
+// Return a new vector with index i replaced by x. Consumes x.
+lvec* lvec_set(lvec* n, int i, lval* x);
+
+// Return a new vector holding count lvals of n starting at offset.
+lvec* lvec_slice(lvec* n, int offset, int count);
+
+// Return a new vector holding the lvals of a followed by those of b.
+lvec* lvec_concat(lvec* a, lvec* b);
+
+// Store new references to every lval of n, in order, into out.
+void lvec_copy_out(lvec* n, lval** out);
+
+#endif
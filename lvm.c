@@ -0,0 +1,2466 @@
+#include "lvm.h"
+#include "ljit.h"
+#include "lval.h"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+// Hot code is compiled to machine code where ljit can place it, unless
+// the loop is being profiled.
+#if defined(LJIT_X86_64) && !defined(LVM_PROFILE)
+#define LVM_JIT
+#endif
+
+// Values of every running compiled function, from the outermost call up.
+// Frames refer to it by position, since it moves when it grows.
+static lval** stack = NULL;
+static int height = 0;
+static int capacity = 0;
+
+// An Integer or a Number held unboxed in a slot of the stack.
+struct lvm_num {
+    bool integer;
+    union {
+        int64_t i;
+        double d;
+    };
+};
+
+// Values of stack slots holding unboxed numbers, at the same positions. The
+// slot itself holds unboxed, which nothing but the arithmetic instructions
+// ever reads.
+static struct lvm_num* nums = NULL;
+static lval unboxed = { .type = LVAL_OKAY, .refs = LVAL_IMMORTAL };
+
+// Functions of the instruction loop that must be inlined into it, for each
+// instruction to get code of its own.
+#if defined(__GNUC__) || defined(__clang__)
+#define LVM_INLINE static inline __attribute__((always_inline))
+#else
+#define LVM_INLINE static inline
+#endif
+
+// Where a running function carries on once what it has called returns.
+// The slot below the frame's values holds what it runs: a compiled
+// function, or for the tree walker, whose frames have no code, the list
+// it is evaluating (see lvm_walk).
+struct lvm_frame {
+    lcode* code;
+    int pc;
+    int base; // Height of the stack above the frame's slot
+    lenv* env;
+    int frames; // Environments owned, env and its first ancestors
+};
+
+// A tree walker frame whose list has been evaluated, about to call the
+// function above its slot with the values above that.
+#define LVM_WALK_CALL (-1)
+
+// Frames of the running functions, innermost last.
+static struct lvm_frame* calls = NULL;
+static int call_count = 0;
+static int call_capacity = 0;
+
+// Environments owned by running functions, counted at their usual size.
+#define LVM_ENV_BYTES (sizeof(lenv) + 4 * (sizeof(char*) + sizeof(lval*)))
+static long envs = 0;
+
+// Whether functions called often are compiled on to machine code.
+static bool jit = false;
+
+// Most stack memory that calls may use, and the deepest use so far.
+static size_t limit = LVM_STACK_LIMIT;
+static int peak_depth = 0;
+static size_t peak_bytes = 0;
+
+// Where the C stack started and how far it may grow from there.
+static char* native_base = NULL;
+static size_t native_size = 0;
+
+// Global environment.
+static lenv* global = NULL;
+
+// Instructions run by runs that have finished.
+static long steps = 0;
+
+const int lvm_op_size[LVM_OP_COUNT] = {
+    [LVM_CONST] = 2,
+    [LVM_LOCAL] = 2,
+    [LVM_GLOBAL] = 2,
+    [LVM_IF] = 3,
+    [LVM_BRANCH] = 4,
+    [LVM_JUMP] = 2,
+    [LVM_CALL] = 2,
+    [LVM_TAILCALL] = 2,
+    [LVM_RETURN] = 1,
+    [LVM_ADD] = 3,
+    [LVM_SUB] = 3,
+    [LVM_MUL] = 3,
+    [LVM_DIV] = 3,
+    [LVM_LT] = 3,
+    [LVM_GT] = 3,
+    [LVM_LE] = 3,
+    [LVM_GE] = 3,
+    [LVM_EQ] = 3,
+    [LVM_NE] = 3,
+    [LVM_GLOBAL_LOCAL] = 3,
+    [LVM_GLOBAL_GLOBAL] = 3,
+    [LVM_LOCAL_LOCAL] = 3,
+    [LVM_LOCAL_CONST] = 3,
+    [LVM_LOCAL_CALL] = 3,
+    [LVM_CONST_CALL] = 3
+};
+
+#ifndef LVM_NO_SUPER
+// Each superinstruction and the pair of instructions it stands for.
+static const int lvm_supers[][3] = {
+    { LVM_GLOBAL_LOCAL, LVM_GLOBAL, LVM_LOCAL },
+    { LVM_GLOBAL_GLOBAL, LVM_GLOBAL, LVM_GLOBAL },
+    { LVM_LOCAL_LOCAL, LVM_LOCAL, LVM_LOCAL },
+    { LVM_LOCAL_CONST, LVM_LOCAL, LVM_CONST },
+    { LVM_LOCAL_CALL, LVM_LOCAL, LVM_CALL },
+    { LVM_CONST_CALL, LVM_CONST, LVM_CALL }
+};
+#endif
+
+// Operator symbol and builtin of each arithmetic and comparison
+// instruction, from LVM_ADD on.
+static char* lvm_typed_names[] = { "+", "-", "*", "/", "<", ">", "<=", ">=", "==", "!=" };
+static const lbuiltin lvm_typed_builtins[] = {
+    builtin_add, builtin_sub, builtin_mul, builtin_div, builtin_less, builtin_greater,
+    builtin_less_or_equal, builtin_greater_or_equal, builtin_equal, builtin_not_equal
+};
+#define LVM_TYPED_COUNT ((int)(sizeof(lvm_typed_builtins) / sizeof(lvm_typed_builtins[0])))
+
+#ifdef LVM_PROFILE
+// Instructions run of each opcode, and of each opcode straight after
+// another in the same code.
+static long op_counts[LVM_OP_COUNT];
+static long pair_counts[LVM_OP_COUNT][LVM_OP_COUNT];
+
+// Instruction run last.
+static lcode* last_code = NULL;
+static int last_pc = 0;
+#endif
+
+// State of the compiler while it fills in a function's code.
+struct lvm_compiler {
+    lcode* code;
+    int op_capacity;
+    int const_capacity;
+    int name_capacity;
+    int depth; // Stack slots in use at the current instruction
+    int last; // Start of the last instruction if the next may merge into it, or -1
+};
+
+#ifdef LVM_PROFILE
+// Count the instruction at pc in code, which is about to run.
+static void lvm_profile(lcode* code, int pc) {
+
+    int op = code->ops[pc];
+    op_counts[op]++;
+
+    if(code == last_code && pc == last_pc + lvm_op_size[code->ops[last_pc]]) {
+        pair_counts[code->ops[last_pc]][op]++;
+    }
+
+    last_code = code;
+    last_pc = pc;
+
+}
+
+// Print the instruction counts, most common first, to stderr.
+static void lvm_profile_print(void) {
+
+    static const char* names[LVM_OP_COUNT] = {
+        "CONST", "LOCAL", "GLOBAL", "IF", "BRANCH", "JUMP", "CALL", "TAILCALL", "RETURN",
+        "ADD", "SUB", "MUL", "DIV", "LT", "GT", "LE", "GE", "EQ", "NE",
+        "GLOBAL_LOCAL", "GLOBAL_GLOBAL", "LOCAL_LOCAL", "LOCAL_CONST", "LOCAL_CALL", "CONST_CALL"
+    };
+
+    long total = 0;
+    for(int i = 0; i < LVM_OP_COUNT; ++i) {
+        total += op_counts[i];
+    }
+    fprintf(stderr, "%ld instructions\n", total);
+
+    // Repeatedly pick the largest count left, opcodes first, then pairs.
+    for(int pairs = 0; pairs < 2; ++pairs) {
+        bool shown[LVM_OP_COUNT][LVM_OP_COUNT] = {{false}};
+        for(int k = 0; k < (pairs ? 12 : LVM_OP_COUNT); ++k) {
+            int bi = 0, bj = 0;
+            long best = -1;
+            for(int i = 0; i < LVM_OP_COUNT; ++i) {
+                for(int j = 0; j < (pairs ? LVM_OP_COUNT : 1); ++j) {
+                    long n = pairs ? pair_counts[i][j] : op_counts[i];
+                    if(!shown[i][j] && n > best) {
+                        best = n;
+                        bi = i;
+                        bj = j;
+                    }
+                }
+            }
+            shown[bi][bj] = true;
+            if(pairs) {
+                fprintf(stderr, "%5.1f%% %s %s\n", 100.0 * best / (total ? total : 1),
+                        names[bi], names[bj]);
+            } else {
+                fprintf(stderr, "%5.1f%% %s\n", 100.0 * best / (total ? total : 1), names[bi]);
+            }
+        }
+    }
+
+}
+#endif
+
+// Prepare the VM to run below global environment e. Call from main, so
+// that the C stack can be measured from here.
+void lvm_init(lenv* e) {
+
+    global = e;
+    lgc_set_stack(&stack, &height);
+
+    // Leave some of the C stack for whatever runs between checks.
+    char here;
+    size_t size = LVM_NATIVE_STACK;
+#ifndef _WIN32
+    struct rlimit r;
+    if(getrlimit(RLIMIT_STACK, &r) == 0 && r.rlim_cur != RLIM_INFINITY) {
+        size = r.rlim_cur;
+    }
+#endif
+    native_base = &here;
+    native_size = size - size / 8;
+
+#ifdef LVM_PROFILE
+    atexit(lvm_profile_print);
+#endif
+
+}
+
+// Stack memory in use by running compiled functions, in bytes.
+static size_t lvm_bytes(void) {
+    return sizeof(lval*) * height + sizeof(struct lvm_frame) * call_count + LVM_ENV_BYTES * envs;
+}
+
+// Limit the stack memory that compiled functions may use to n bytes.
+void lvm_set_limit(size_t n) {
+    limit = n;
+}
+
+// Compile functions called often on to machine code if on is true.
+void lvm_set_jit(bool on) {
+    jit = on;
+}
+
+// True if the C stack is nearly used up, so evaluation must not nest any
+// deeper.
+bool lvm_native_exhausted(void) {
+
+    char here;
+    size_t used = native_base > &here ? native_base - &here : &here - native_base;
+
+    return used > native_size;
+
+}
+
+// Stack usage counters. If reset is true, the peaks start again from the
+// current usage afterwards.
+struct lvm_stats lvm_get_stats(bool reset) {
+
+    struct lvm_stats stats = { call_count, peak_depth, lvm_bytes(), peak_bytes, limit };
+
+    if(reset) {
+        peak_depth = call_count;
+        peak_bytes = lvm_bytes();
+    }
+
+    return stats;
+
+}
+
+// Number of instructions run so far.
+long lvm_steps(void) {
+    return steps;
+}
+
+// Make room for n more values on the stack.
+static void lvm_reserve(int n) {
+
+    if(height + n <= capacity) {
+        return;
+    }
+
+    while(capacity < height + n) {
+        capacity = capacity ? capacity * 2 : 1024;
+    }
+    stack = realloc(stack, sizeof(lval*) * capacity);
+    nums = realloc(nums, sizeof(struct lvm_num) * capacity);
+
+}
+
+// Append a word to the instructions.
+static void lvm_emit(struct lvm_compiler* c, int x) {
+
+    lcode* code = c->code;
+
+    if(code->op_count == c->op_capacity) {
+        c->op_capacity = c->op_capacity ? c->op_capacity * 2 : 32;
+        code->ops = realloc(code->ops, sizeof(int) * c->op_capacity);
+    }
+
+    code->ops[code->op_count++] = x;
+
+}
+
+// Start an instruction with opcode op, its operands to follow, merging it
+// into the one before where the pair makes a superinstruction.
+static void lvm_op(struct lvm_compiler* c, int op) {
+
+#ifndef LVM_NO_SUPER
+    if(c->last != -1) {
+        int* prev = &c->code->ops[c->last];
+        for(size_t i = 0; i < sizeof(lvm_supers) / sizeof(lvm_supers[0]); ++i) {
+            if(lvm_supers[i][1] == *prev && lvm_supers[i][2] == op) {
+                *prev = lvm_supers[i][0];
+                c->last = -1;
+                return;
+            }
+        }
+    }
+#endif
+
+    c->last = c->code->op_count;
+    lvm_emit(c, op);
+
+}
+
+// Return the position of the next instruction as a jump target, so that
+// it is not merged into the one before.
+static int lvm_label(struct lvm_compiler* c) {
+
+    c->last = -1;
+    return c->code->op_count;
+
+}
+
+// Note that the instructions so far leave n more values on the stack.
+static void lvm_grow(struct lvm_compiler* c, int n) {
+
+    c->depth += n;
+    if(c->depth > c->code->depth) {
+        c->code->depth = c->depth;
+    }
+
+}
+
+// Add a constant, consuming v, and return its index.
+static int lvm_const(struct lvm_compiler* c, lval* v) {
+
+    lcode* code = c->code;
+
+    if(code->const_count == c->const_capacity) {
+        c->const_capacity = c->const_capacity ? c->const_capacity * 2 : 8;
+        code->consts = realloc(code->consts, sizeof(lval*) * c->const_capacity);
+    }
+
+    code->consts[code->const_count] = v;
+    return code->const_count++;
+
+}
+
+// Return the index of free symbol sym, adding it if needed.
+static int lvm_name(struct lvm_compiler* c, char* sym) {
+
+    lcode* code = c->code;
+
+    for(int i = 0; i < code->name_count; ++i) {
+        if(code->names[i] == sym) {
+            return i;
+        }
+    }
+
+    if(code->name_count == c->name_capacity) {
+        c->name_capacity = c->name_capacity ? c->name_capacity * 2 : 8;
+        code->names = realloc(code->names, sizeof(char*) * c->name_capacity);
+    }
+
+    code->names[code->name_count] = sym;
+    return code->name_count++;
+
+}
+
+// Return the arithmetic or comparison instruction for operator symbol sym,
+// or -1 if it is none.
+static int lvm_typed_op(char* sym) {
+
+    // Interned names, compared by pointer.
+    static char* syms[LVM_TYPED_COUNT];
+    if(!syms[0]) {
+        for(int i = 0; i < LVM_TYPED_COUNT; ++i) {
+            syms[i] = lsym_intern(lvm_typed_names[i]);
+        }
+    }
+
+    for(int i = 0; i < LVM_TYPED_COUNT; ++i) {
+        if(syms[i] == sym) {
+            return LVM_ADD + i;
+        }
+    }
+
+    return -1;
+
+}
+
+static bool lvm_compile_list(struct lvm_compiler* c, lval* x, bool tail, bool raw);
+
+// Compile code pushing the value of expression x. If tail is true the
+// value is the function's result, so a call can replace the running one.
+// If raw is true the value is only an operand of arithmetic, so a number
+// may be left unboxed.
+static bool lvm_compile_expr(struct lvm_compiler* c, lval* x, bool tail, bool raw) {
+
+    switch(lval_type(x)) {
+
+        // Arguments by position, anything else by name.
+        case LVAL_SYM:
+            for(int i = 0; i < c->code->arity; ++i) {
+                if(c->code->formals[i] == x->sym) {
+                    lvm_op(c, LVM_LOCAL);
+                    lvm_emit(c, i);
+                    lvm_grow(c, 1);
+                    return true;
+                }
+            }
+            lvm_op(c, LVM_GLOBAL);
+            lvm_emit(c, lvm_name(c, x->sym));
+            lvm_grow(c, 1);
+            return true;
+
+        case LVAL_SEXPR:
+            return lvm_compile_list(c, x, tail, raw);
+
+        // Left to the tree walker, which returns it as the function's result.
+        case LVAL_ERR:
+            return false;
+
+        // Everything else evaluates to itself.
+        default:
+            lvm_op(c, LVM_CONST);
+            lvm_emit(c, lvm_const(c, lval_copy(x)));
+            lvm_grow(c, 1);
+            return true;
+    }
+
+}
+
+// Compile code pushing the value of list x evaluated as an S-Expression,
+// in tail position if tail is true, and maybe unboxed if raw is true.
+static bool lvm_compile_list(struct lvm_compiler* c, lval* x, bool tail, bool raw) {
+
+    // Interned name of the conditional, compared by pointer.
+    static char* if_sym = NULL;
+    if(!if_sym) {
+        if_sym = lsym_intern("if");
+    }
+
+    // Empty expression
+    if(x->count == 0) {
+        lvm_op(c, LVM_CONST);
+        lvm_emit(c, lvm_const(c, lval_sexpr()));
+        lvm_grow(c, 1);
+        return true;
+    }
+
+    // Single expression
+    if(x->count == 1) {
+        return lvm_compile_expr(c, lval_index(x, 0), tail, raw);
+    }
+
+    lval* head = lval_index(x, 0);
+
+    // A conditional compiles its branches inline, provided 'if' still
+    // means the builtin when it runs, so that only the one chosen is
+    // evaluated. A literal Q-Expression branch runs as code directly; any
+    // other is evaluated and given to the builtin, which runs the body it
+    // yields.
+    if(x->count == 4 && lval_type(head) == LVAL_SYM && head->sym == if_sym) {
+
+        int guard = c->code->op_count;
+        lvm_op(c, LVM_IF);
+        lvm_emit(c, lvm_name(c, if_sym));
+        lvm_emit(c, 0);
+
+        if(!lvm_compile_expr(c, lval_index(x, 1), false, false)) {
+            return false;
+        }
+
+        int then_k = lvm_const(c, lval_copy(lval_index(x, 2)));
+        int else_k = lvm_const(c, lval_copy(lval_index(x, 3)));
+        int branch = c->code->op_count;
+        lvm_op(c, LVM_BRANCH);
+        lvm_emit(c, then_k);
+        lvm_emit(c, else_k);
+        lvm_emit(c, 0);
+        lvm_grow(c, -1);
+
+        // Each branch leaves its value and jumps to the end.
+        int jumps[2];
+        for(int i = 0; i < 2; ++i) {
+            lval* y = lval_index(x, 2 + i);
+            if(i == 1) {
+                c->code->ops[branch + 3] = lvm_label(c);
+            }
+            if(lval_type(y) == LVAL_QEXPR) {
+                if(!lvm_compile_list(c, y, tail, raw)) {
+                    return false;
+                }
+            } else {
+                // (if true y {}) or (if false {} y)
+                lvm_op(c, LVM_CONST);
+                lvm_emit(c, lvm_const(c, lval_fun(builtin_if)));
+                lvm_op(c, LVM_CONST);
+                lvm_emit(c, lvm_const(c, lval_bool(i == 0)));
+                lvm_grow(c, 2);
+                for(int j = 0; j < 2; ++j) {
+                    if(j == i && !lvm_compile_expr(c, y, false, false)) {
+                        return false;
+                    } else if(j != i) {
+                        lvm_op(c, LVM_CONST);
+                        lvm_emit(c, lvm_const(c, lval_qexpr()));
+                        lvm_grow(c, 1);
+                    }
+                }
+                lvm_op(c, tail ? LVM_TAILCALL : LVM_CALL);
+                lvm_emit(c, 3);
+                lvm_grow(c, -3);
+            }
+            jumps[i] = c->code->op_count;
+            lvm_op(c, LVM_JUMP);
+            lvm_emit(c, 0);
+            lvm_grow(c, -1);
+        }
+
+        // Where 'if' means something else, an ordinary call of it.
+        c->code->ops[guard + 2] = lvm_label(c);
+        lvm_grow(c, 1);
+        for(int i = 1; i < 4; ++i) {
+            lval* y = lval_index(x, i);
+            if(i > 1 && lval_type(y) == LVAL_QEXPR) {
+                lvm_op(c, LVM_CONST);
+                lvm_emit(c, i == 2 ? then_k : else_k);
+                lvm_grow(c, 1);
+            } else if(!lvm_compile_expr(c, y, false, false)) {
+                return false;
+            }
+        }
+        lvm_op(c, tail ? LVM_TAILCALL : LVM_CALL);
+        lvm_emit(c, 3);
+        lvm_grow(c, -3);
+
+        int end = lvm_label(c);
+        c->code->ops[jumps[0] + 1] = end;
+        c->code->ops[jumps[1] + 1] = end;
+        return true;
+
+    }
+
+    // Arithmetic and comparison of two values by a free symbol get an
+    // instruction of their own, which looks the operator up after the
+    // operands and still calls it if it means something else.
+    int typed = lval_type(head) == LVAL_SYM && x->count == 3 ? lvm_typed_op(head->sym) : -1;
+    for(int i = 0; typed != -1 && i < c->code->arity; ++i) {
+        if(c->code->formals[i] == head->sym) {
+            typed = -1;
+        }
+    }
+
+    if(typed != -1) {
+        for(int i = 1; i < 3; ++i) {
+            if(!lvm_compile_expr(c, lval_index(x, i), false, true)) {
+                return false;
+            }
+        }
+        lvm_op(c, typed);
+        lvm_emit(c, lvm_name(c, head->sym));
+        lvm_emit(c, !raw);
+        // Room for the function, should it be called.
+        lvm_grow(c, 1);
+        lvm_grow(c, -2);
+        return true;
+    }
+
+    // Otherwise a call: the function, then its arguments, left to right.
+    for(int i = 0; i < x->count; ++i) {
+        if(!lvm_compile_expr(c, lval_index(x, i), false, false)) {
+            return false;
+        }
+    }
+
+    lvm_op(c, tail ? LVM_TAILCALL : LVM_CALL);
+    lvm_emit(c, x->count - 1);
+    lvm_grow(c, -(x->count - 1));
+
+    return true;
+
+}
+
+// Native code compiled ahead of time, by the instructions and free symbols
+// of the code it was compiled from.
+struct lvm_ahead {
+    const int* ops;
+    int op_count;
+    char* const* names;
+    int name_count;
+    lvm_native fn;
+};
+static struct lvm_ahead* ahead = NULL;
+static int ahead_count = 0;
+
+// Run code whose instructions and free symbols are ops and names on native
+// function fn, from when it is compiled.
+void lvm_register(const int* ops, int op_count, char* const* names, int name_count,
+                  lvm_native fn) {
+
+    ahead = realloc(ahead, sizeof(struct lvm_ahead) * (ahead_count + 1));
+    ahead[ahead_count++] = (struct lvm_ahead){ ops, op_count, names, name_count, fn };
+
+}
+
+// Give code the native code registered for the same instructions, if any.
+static void lvm_attach(lcode* code) {
+
+    for(int i = 0; i < ahead_count; ++i) {
+        struct lvm_ahead* a = &ahead[i];
+        if(a->op_count != code->op_count || a->name_count != code->name_count
+                || memcmp(a->ops, code->ops, sizeof(int) * code->op_count) != 0) {
+            continue;
+        }
+        int j = 0;
+        while(j < code->name_count && strcmp(a->names[j], code->names[j]) == 0) {
+            ++j;
+        }
+        if(j == code->name_count) {
+            code->native = a->fn;
+            return;
+        }
+    }
+
+}
+
+// Compile the formals and body of user-defined function f. Bodies holding
+// errors, and formals misusing '&', are left to the tree walker.
+static lcode* lvm_compile(lval* f) {
+
+    lcode* code = malloc(sizeof(lcode));
+    code->arity = 0;
+    code->formals = malloc(sizeof(char*) * (f->formals->count ? f->formals->count : 1));
+    code->variadic = false;
+    code->ops = NULL;
+    code->op_count = 0;
+    code->consts = NULL;
+    code->const_count = 0;
+    code->names = NULL;
+    code->name_count = 0;
+    code->depth = 0;
+    code->calls = 0;
+    code->jit = NULL;
+    code->native = NULL;
+
+    struct lvm_compiler c = { code, 0, 0, 0, 0, -1 };
+    bool ok = true;
+
+    // Arguments must be distinct symbols, each bound to one value but for
+    // a last one after '&', bound to a list of the rest.
+    for(int i = 0; i < f->formals->count; ++i) {
+        char* sym = lval_index(f->formals, i)->sym;
+        if(strcmp(sym, "&") == 0) {
+            ok &= !code->variadic && i == f->formals->count - 2;
+            code->variadic = true;
+            continue;
+        }
+        for(int j = 0; j < code->arity; ++j) {
+            ok &= code->formals[j] != sym;
+        }
+        code->formals[code->arity++] = sym;
+    }
+
+    if(ok && lvm_compile_list(&c, f->body, true, false)) {
+        lvm_op(&c, LVM_RETURN);
+        lvm_attach(code);
+    } else {
+        code->arity = -1;
+    }
+
+    // The constants belong to f from now on.
+    for(int i = 0; i < code->const_count; ++i) {
+        lgc_barrier(f, code->consts[i]);
+    }
+
+    return code;
+
+}
+
+// Compile user-defined function f, if not done already. Returns true if
+// calls with n arguments can run on the VM.
+bool lvm_can_call(lval* f, int n) {
+
+#ifdef LVM_TREE_WALK
+    return false;
+#endif
+
+    // Partial applications are called through their lambda.
+    if(f->target) {
+        return false;
+    }
+
+    if(!f->code) {
+        f->code = lvm_compile(f);
+    }
+
+    // Variadic code takes any number from those before '&' on.
+    if(f->code->variadic) {
+        return f->code->arity != -1 && n >= f->code->arity - 1;
+    }
+
+    return f->code->arity == n;
+
+}
+
+// Return (without a new reference) the value of free symbol sym as seen
+// from env, or NULL if it is unbound.
+static lval* lvm_lookup(lenv* env, char* sym) {
+
+    // A name bound nowhere but the global environment needs no search.
+    struct lsym_info* info = lsym_info(sym);
+    if(info->bound == (info->global != -1)) {
+        return info->global == -1 ? NULL : global->vals[info->global];
+    }
+
+    // Otherwise walk the callers' environments, as lenv_get does.
+    for(; env; env = env->parent) {
+        int i = lenv_slot(env, sym);
+        if(i != -1) {
+            return env->vals[i];
+        }
+    }
+
+    return NULL;
+
+}
+
+// Apply an arithmetic or comparison builtin to two Integers directly, or
+// return NULL to call it as usual.
+static lval* lvm_arith(lbuiltin fn, lval* x, lval* y) {
+
+    if(lval_type(x) != LVAL_INT || lval_type(y) != LVAL_INT) {
+        return NULL;
+    }
+
+    int64_t a = lval_int_value(x);
+    int64_t b = lval_int_value(y);
+    int64_t r;
+
+    if(fn == builtin_less) {
+        return lval_bool(a < b);
+    } else if(fn == builtin_greater) {
+        return lval_bool(a > b);
+    } else if(fn == builtin_less_or_equal) {
+        return lval_bool(a <= b);
+    } else if(fn == builtin_greater_or_equal) {
+        return lval_bool(a >= b);
+    } else if(fn == builtin_equal) {
+        return lval_bool(a == b);
+    } else if(fn == builtin_not_equal) {
+        return lval_bool(a != b);
+    } else if(fn == builtin_add) {
+        return builtin_int_op(LOP_ADD, a, b, &r) ? lval_int_shared(r) : NULL;
+    } else if(fn == builtin_sub) {
+        return builtin_int_op(LOP_SUB, a, b, &r) ? lval_int_shared(r) : NULL;
+    } else if(fn == builtin_mul) {
+        return builtin_int_op(LOP_MUL, a, b, &r) ? lval_int_shared(r) : NULL;
+    }
+
+    return NULL;
+
+}
+
+// Read the number in stack slot i, boxed or not, into r. Returns false if
+// the slot holds anything else.
+LVM_INLINE bool lvm_unbox(int i, struct lvm_num* r) {
+
+    lval* v = stack[i];
+
+    if(v == &unboxed) {
+        *r = nums[i];
+    } else if(lval_type(v) == LVAL_INT) {
+        *r = (struct lvm_num){ .integer = true, .i = lval_int_value(v) };
+    } else if(lval_type(v) == LVAL_NUM) {
+        *r = (struct lvm_num){ .integer = false, .d = lval_num_value(v) };
+    } else {
+        return false;
+    }
+
+    return true;
+
+}
+
+// Box the number in stack slot i if it is unboxed.
+static void lvm_box(int i) {
+
+    if(stack[i] == &unboxed) {
+        stack[i] = nums[i].integer ? lval_int_shared(nums[i].i) : lval_num(nums[i].d);
+    }
+
+}
+
+// Release the value popped from a stack slot, unless it marks a number
+// held unboxed, which was pushed without a reference.
+LVM_INLINE void lvm_drop(lval* v) {
+
+    if(v != &unboxed) {
+        lval_del(v);
+    }
+
+}
+
+// Apply arithmetic or comparison instruction op to numbers a and b, into
+// r, where a comparison gives the Integer 1 or 0. Returns false to have
+// the builtin called instead, which is left what goes beyond machine
+// numbers and errors: Integer results that overflow, division by zero,
+// and equality of anything but two Integers.
+LVM_INLINE bool lvm_compute(int op, struct lvm_num a, struct lvm_num b, struct lvm_num* r) {
+
+    // Integers whose quotient as doubles is the exact one, rounded.
+    const int64_t exact = (int64_t)1 << 53;
+
+    if(a.integer && b.integer) {
+
+        r->integer = true;
+
+        switch(op) {
+            case LVM_ADD:
+                return builtin_int_op(LOP_ADD, a.i, b.i, &r->i);
+            case LVM_SUB:
+                return builtin_int_op(LOP_SUB, a.i, b.i, &r->i);
+            case LVM_MUL:
+                return builtin_int_op(LOP_MUL, a.i, b.i, &r->i);
+            case LVM_DIV:
+                if(builtin_int_op(LOP_DIV, a.i, b.i, &r->i)) {
+                    return true;
+                }
+                if(b.i == 0 || a.i <= -exact || a.i >= exact || b.i <= -exact || b.i >= exact) {
+                    return false;
+                }
+                *r = (struct lvm_num){ .integer = false, .d = (double)a.i / (double)b.i };
+                return true;
+            case LVM_LT:
+                r->i = a.i < b.i;
+                return true;
+            case LVM_GT:
+                r->i = a.i > b.i;
+                return true;
+            case LVM_LE:
+                r->i = a.i <= b.i;
+                return true;
+            case LVM_GE:
+                r->i = a.i >= b.i;
+                return true;
+            case LVM_EQ:
+                r->i = a.i == b.i;
+                return true;
+            default:
+                r->i = a.i != b.i;
+                return true;
+        }
+
+    }
+
+    // An Integer is ordered against a Number exactly, as the builtins have
+    // it. Comparisons with NaN are all false.
+    if(op >= LVM_LT && op <= LVM_GE && a.integer != b.integer) {
+        double d = a.integer ? b.d : a.d;
+        *r = (struct lvm_num){ .integer = true, .i = 0 };
+        if(d != d) {
+            return true;
+        }
+        int order = a.integer ? lval_int_cmp_num(a.i, d) : -lval_int_cmp_num(b.i, d);
+        switch(op) {
+            case LVM_LT:
+                r->i = order < 0;
+                return true;
+            case LVM_GT:
+                r->i = order > 0;
+                return true;
+            case LVM_LE:
+                r->i = order <= 0;
+                return true;
+            default:
+                r->i = order >= 0;
+                return true;
+        }
+    }
+
+    double x = a.integer ? (double)a.i : a.d;
+    double y = b.integer ? (double)b.i : b.d;
+
+    // Comparisons with NaN are all false, as the builtins have them.
+    *r = (struct lvm_num){ .integer = op >= LVM_LT };
+
+    switch(op) {
+        case LVM_ADD:
+            r->d = x + y;
+            return true;
+        case LVM_SUB:
+            r->d = x - y;
+            return true;
+        case LVM_MUL:
+            r->d = x * y;
+            return true;
+        case LVM_DIV:
+            r->d = x / y;
+            return y != 0;
+        case LVM_LT:
+            r->i = x < y;
+            return true;
+        case LVM_GT:
+            r->i = x > y;
+            return true;
+        case LVM_LE:
+            r->i = x <= y;
+            return true;
+        case LVM_GE:
+            r->i = x >= y;
+            return true;
+        default:
+            return false;
+    }
+
+}
+
+// Apply arithmetic or comparison instruction op to the top two values of
+// the stack, popping them, if f is the builtin for op and they are numbers
+// it can work on directly. Leaves the result unboxed unless box is true or
+// it is a Boolean. Returns false, doing nothing, otherwise.
+LVM_INLINE bool lvm_typed(int op, lval* f, bool box) {
+
+    struct lvm_num a, b, r;
+
+    if(!f || lval_type(f) != LVAL_FUN || f->builtin != lvm_typed_builtins[op - LVM_ADD]
+            || !lvm_unbox(height - 2, &a) || !lvm_unbox(height - 1, &b)
+            || !lvm_compute(op, a, b, &r)) {
+        return false;
+    }
+
+    lvm_drop(stack[--height]);
+    lvm_drop(stack[--height]);
+
+    if(op >= LVM_LT) {
+        stack[height++] = lval_bool(r.i);
+    } else if(box) {
+        stack[height++] = r.integer ? lval_int_shared(r.i) : lval_num(r.d);
+    } else {
+        nums[height] = r;
+        stack[height++] = &unboxed;
+    }
+
+    return true;
+
+}
+
+// Put function f below the top two values of the stack, boxing them, for
+// it to be called with them where an arithmetic instruction's operator is
+// not the builtin.
+static void lvm_operator(lval* f) {
+
+    lvm_box(height - 2);
+    lvm_box(height - 1);
+    stack[height] = stack[height - 1];
+    stack[height - 1] = stack[height - 2];
+    stack[height - 2] = lval_copy(f);
+    height++;
+
+}
+
+// Pop the top n values of the stack into a new S-Expression.
+static lval* lvm_args(int n) {
+
+    lval* a = lval_sexpr();
+    lval_reserve(a, n);
+
+    for(int i = height - n; i < height; ++i) {
+        lval_add(a, stack[i]);
+    }
+    height -= n;
+
+    return a;
+
+}
+
+// Pop the top n values of the stack, returning the error for a call that
+// would go over the stack limit.
+static lval* lvm_overflow(int n) {
+
+    while(n-- > 0) {
+        lvm_drop(stack[--height]);
+    }
+
+    return lval_err("Recursion too deep: the stack is limited to %ld MB",
+                    (long)(limit >> 20));
+
+}
+
+static void lvm_jit(lcode* code);
+
+// Count a call of code, compiling it to machine code once it is hot.
+static void lvm_count(lcode* code) {
+
+    if(jit && code->calls < LVM_JIT_THRESHOLD && ++code->calls == LVM_JIT_THRESHOLD
+            && !code->native) {
+        lvm_jit(code);
+    }
+
+}
+
+// Replace the values of the top n of the stack past the first arity - 1
+// by a Q-Expression of them, to be bound to the last formal of variadic
+// code. Returns the new number of values.
+static int lvm_pack(lcode* code, int n) {
+
+    if(!code->variadic) {
+        return n;
+    }
+
+    int fixed = code->arity - 1;
+    lval* rest = lval_qexpr();
+    lval_reserve(rest, n - fixed);
+    for(int i = fixed; i < n; ++i) {
+        lval_add(rest, stack[height - n + i]);
+    }
+    height -= n - fixed;
+    stack[height++] = rest;
+
+    return code->arity;
+
+}
+
+// Push frame f, noting the deepest use of the stack.
+LVM_INLINE void lvm_push_call(struct lvm_frame f) {
+
+    if(call_count == call_capacity) {
+        call_capacity = call_capacity ? call_capacity * 2 : 64;
+        calls = realloc(calls, sizeof(struct lvm_frame) * call_capacity);
+    }
+    calls[call_count++] = f;
+
+    if(call_count > peak_depth) {
+        peak_depth = call_count;
+    }
+    if(lvm_bytes() > peak_bytes) {
+        peak_bytes = lvm_bytes();
+    }
+
+}
+
+// Start running the compiled function below the top n values of the
+// stack with them, popped into a new environment below parent. Returns
+// false, doing nothing, if that would go over the stack limit.
+static bool lvm_push_frame(lenv* parent, int n) {
+
+    if(lvm_bytes() + sizeof(struct lvm_frame) + LVM_ENV_BYTES > limit) {
+        return false;
+    }
+
+    lcode* code = stack[height - n - 1]->code;
+    n = lvm_pack(code, n);
+
+    // Every loop goes through a call of some function, so this is often
+    // enough. Everything live is on the stack or in a rooted environment.
+    lgc_safepoint();
+
+    lenv* frame = lenv_frame(parent, code->formals, &stack[height - n], n);
+    height -= n;
+    lgc_push_env(frame);
+    envs++;
+
+    lvm_push_call((struct lvm_frame){ code, 0, height, frame, 1 });
+    lvm_count(code);
+
+    lvm_reserve(code->depth);
+
+    return true;
+
+}
+
+// Release the environments a run owns.
+static void lvm_leave(lenv* env, int frames) {
+
+    lgc_pop_env(frames);
+    envs -= frames;
+
+    while(frames--) {
+        lenv* parent = env->parent;
+        lenv_del_frame(env);
+        env = parent;
+    }
+
+}
+
+LVM_INLINE lval* lvm_drive(int bottom);
+
+// Run compiled function f on the top n values of the stack, popping them,
+// with a new environment below e. f stays on the stack.
+static lval* lvm_enter(lenv* e, int n) {
+
+    if(!lvm_push_frame(e, n)) {
+        return lvm_overflow(n);
+    }
+
+    return lvm_drive(call_count - 1);
+
+}
+
+// Run \, def or = on values x and y directly when they take the form of
+// the special forms' literal Q-Expressions, or return NULL to call builtin
+// fn as usual.
+static lval* lvm_form(lenv* e, lbuiltin fn, lval* x, lval* y) {
+
+    if(fn == builtin_lambda) {
+        return builtin_lambda_form(x, y);
+    } else if(fn == builtin_def || fn == builtin_put) {
+        return builtin_var_form(e, x, y, fn == builtin_def);
+    }
+
+    return NULL;
+
+}
+
+// Call the function below the top n values of the stack with them, from
+// environment e, popping it and them. Compiled functions are run by the
+// caller instead.
+static lval* lvm_invoke(lenv* e, int n) {
+
+    lval* f = stack[height - n - 1];
+
+    if(lval_type(f) != LVAL_FUN) {
+        lval* err = lval_err("S-Expression starts with incorrect type. Got %s, Expected %s",
+                              lval_type_name(f), ltype_name(LVAL_FUN));
+        while(n-- >= 0) {
+            lval_del(stack[--height]);
+        }
+        return err;
+    }
+
+    // The function stays on the stack until the call returns.
+    lval* result;
+
+    if(f->builtin) {
+        if(n == 2 && ((result = lvm_arith(f->builtin, stack[height - 2], stack[height - 1]))
+                    || (result = lvm_form(e, f->builtin, stack[height - 2], stack[height - 1])))) {
+            lval_del(stack[--height]);
+            lval_del(stack[--height]);
+        } else {
+            result = f->builtin(e, lvm_args(n));
+        }
+    } else {
+        result = lval_call(e, f, lvm_args(n));
+    }
+
+    lval_del(stack[--height]);
+    return result;
+
+}
+
+// Replace the partial application below the top n values of the stack by
+// its lambda, with the arguments it holds inserted before them, so that
+// the lambda can be run as compiled. Returns the new number of arguments.
+static int lvm_spread(int n) {
+
+    lval* p = stack[height - n - 1];
+    int k = p->bound->count;
+    lvm_reserve(k);
+
+    memmove(&stack[height - n + k], &stack[height - n], sizeof(lval*) * n);
+    for(int i = 0; i < k; ++i) {
+        stack[height - n + i] = lval_copy(lval_index(p->bound, i));
+    }
+    stack[height - n - 1] = lval_copy(p->target);
+    height += k;
+
+    lval_del(p);
+    return n + k;
+
+}
+
+// If the call of the function below the top n values of the stack is of
+// eval or if with a quoted body to run, return that body, without a new
+// reference. Otherwise return NULL.
+LVM_INLINE lval* lvm_body(int n) {
+
+    lval* f = stack[height - n - 1];
+
+    if(lval_type(f) != LVAL_FUN) {
+        return NULL;
+    } else if(f->builtin == builtin_eval && n == 1 && lval_type(stack[height - 1]) == LVAL_QEXPR) {
+        return stack[height - 1];
+    } else if(f->builtin == builtin_if && n == 3 && lval_type(stack[height - 3]) == LVAL_BOOL
+            && lval_type(stack[height - (stack[height - 3]->val ? 2 : 1)]) == LVAL_QEXPR) {
+        return stack[height - (stack[height - 3]->val ? 2 : 1)];
+    }
+
+    return NULL;
+
+}
+
+// If the call of the function below the top n values of the stack is of
+// eval or if with a quoted body to run, pop it and them and return that
+// body. Otherwise return NULL.
+static lval* lvm_unfold(int n) {
+
+    lval* body = lvm_body(n);
+
+    if(!body) {
+        return NULL;
+    }
+
+    body = lval_copy(body);
+    while(n-- >= 0) {
+        lval_del(stack[--height]);
+    }
+
+    return body;
+
+}
+
+// True if the call of the function below the top n values of the stack
+// is left to the tree walker: of eval or if with a body to run, or of a
+// user-defined function that cannot run compiled, unless the call only
+// holds its arguments, which lval_call does.
+LVM_INLINE bool lvm_walks(int n) {
+
+    lval* f = stack[height - n - 1];
+
+    if(lval_type(f) != LVAL_FUN) {
+        return false;
+    } else if(f->builtin) {
+        return lvm_body(n) != NULL;
+    } else if(lval_is_partial(f)) {
+        return !lval_holds(f->target, f->bound->count + n);
+    }
+
+    return !lvm_can_call(f, n) && !lval_holds(f, n);
+
+}
+
+// Start the tree walker in a frame of its own, below which the function
+// running in frames of env carries on once it is done, on the call of the
+// function below the top n values of the stack with them, if lvm_walks.
+// Returns an error, having popped the function and values, if that would
+// go over the stack limit, or else NULL.
+static lval* lvm_push_walk(lenv* env, int n) {
+
+    if(lvm_bytes() + sizeof(struct lvm_frame) + sizeof(lval*) > limit) {
+        return lvm_overflow(n + 1);
+    }
+
+    // eval and if run their body in place of the call.
+    lval* body = lvm_unfold(n);
+    if(body) {
+        lvm_reserve(1);
+        stack[height++] = body;
+        lvm_push_call((struct lvm_frame){ NULL, 0, height, env, 0 });
+        return NULL;
+    }
+
+    // The function itself goes in the frame's slot too.
+    lvm_reserve(1);
+    memmove(&stack[height - n], &stack[height - n - 1], sizeof(lval*) * (n + 1));
+    stack[height - n - 1] = lval_copy(stack[height - n]);
+    height++;
+    lvm_push_call((struct lvm_frame){ NULL, LVM_WALK_CALL, height - n - 1, env, 0 });
+    return NULL;
+
+}
+
+// Bind the compiled function below the top n values of the stack to them,
+// to run in place of what the frame whose values start at base runs, as a
+// call in tail position. env and frames are the frame's environment and
+// the number of environments it owns, updated to the new ones. Its own
+// environment goes if the new arguments hide everything bound in it, and
+// otherwise is kept for dynamic scope, which counts towards the stack
+// limit. Returns an error, having popped the function and values, if that
+// would go over it, or else NULL.
+LVM_INLINE lval* lvm_rebind(int base, lenv** env, int* frames, int n) {
+
+    lcode* code = stack[height - n - 1]->code;
+    n = lvm_pack(code, n);
+
+    bool hidden = *frames > 0;
+    for(int i = 0; hidden && i < (*env)->count; ++i) {
+        hidden = false;
+        for(int j = 0; j < n; ++j) {
+            hidden |= code->formals[j] == (*env)->syms[i];
+        }
+    }
+
+    if(!hidden && lvm_bytes() + LVM_ENV_BYTES > limit) {
+        return lvm_overflow(n + 1);
+    }
+
+    lgc_safepoint();
+
+    lenv* frame = lenv_frame(hidden ? (*env)->parent : *env, code->formals,
+                             &stack[height - n], n);
+    height -= n;
+
+    if(hidden) {
+        lgc_pop_env(1);
+        lenv_del_frame(*env);
+        (*frames)--;
+        envs--;
+    }
+    lgc_push_env(frame);
+    *env = frame;
+    (*frames)++;
+    envs++;
+
+    // The new function takes the old one's place.
+    lval_del(stack[base - 1]);
+    stack[base - 1] = stack[--height];
+    lvm_reserve(code->depth);
+    lvm_count(code);
+
+    return NULL;
+
+}
+
+// Run the tree walker's frame on top of the stack, and those it starts to
+// evaluate the lists in it, until one of them finishes with a frame of
+// compiled code or frame bottom below, returning its value with its slot
+// left on the stack, or runs a compiled function, returning NULL. x is the
+// value of what the frame on top evaluated last, or NULL to start it.
+//
+// A frame evaluates the elements of its list onto the stack, starting a
+// frame of its own for each that is an S-Expression, and then calls the
+// first with the rest. A call in tail position is what the list gives, so
+// the frame runs the callee, or the body given to eval or if, in place of
+// the list, and a compiled function turns it into a frame of compiled
+// code. Only the branch of if chosen is evaluated.
+static lval* lvm_walk(int bottom, lval* x) {
+
+    int pc = calls[call_count - 1].pc;
+    int base = calls[call_count - 1].base;
+    lenv* env = calls[call_count - 1].env;
+    int frames = calls[call_count - 1].frames;
+
+    while(true) {
+
+        // The value of an element, which an error is for the whole list.
+        if(x) {
+            if(lval_type(x) == LVAL_ERR) {
+                goto finish;
+            }
+            stack[height++] = x;
+            x = NULL;
+        }
+
+        lval* list = stack[base - 1];
+
+        if(pc == 0) {
+
+            // Empty expression
+            if(list->count == 0) {
+                x = lval_sexpr();
+                goto finish;
+            }
+
+            // Single expression, whose value is the list's.
+            if(list->count == 1) {
+                lval* y = lval_index(list, 0);
+                if(lval_type(y) == LVAL_SEXPR) {
+                    stack[base - 1] = lval_copy(y);
+                    lval_del(list);
+                    continue;
+                }
+                x = lval_type(y) == LVAL_SYM ? lenv_get(env, y) : lval_copy(y);
+                goto finish;
+            }
+
+            // Everything live is on the stack or in a rooted environment.
+            lgc_safepoint();
+            list = stack[base - 1];
+            lvm_reserve(list->count);
+
+        }
+
+        if(pc >= 0 && pc < list->count) {
+
+            lval* y = lval_index(list, pc++);
+
+            // The branch of if not chosen is left as it is.
+            if(pc >= 3 && list->count == 4 && lval_type(stack[base]) == LVAL_FUN
+                    && stack[base]->builtin == builtin_if) {
+                lval* cond = stack[base + 1];
+                int chosen = lval_type(cond) == LVAL_BOOL ? (cond->val ? 3 : 4) : 0;
+                if(pc != chosen) {
+                    stack[height++] = lval_copy(y);
+                    continue;
+                }
+            }
+
+            switch(lval_type(y)) {
+
+                case LVAL_SYM:
+                    x = lenv_get(env, y);
+                    continue;
+
+                // A frame of its own, whose value comes back as x.
+                case LVAL_SEXPR:
+                    if(lvm_bytes() + sizeof(struct lvm_frame) + sizeof(lval*) > limit) {
+                        x = lvm_overflow(0);
+                        goto finish;
+                    }
+                    calls[call_count - 1] = (struct lvm_frame){ NULL, pc, base, env, frames };
+                    stack[height++] = lval_copy(y);
+                    lvm_push_call((struct lvm_frame){ NULL, 0, height, env, 0 });
+                    pc = 0;
+                    base = height;
+                    frames = 0;
+                    continue;
+
+                default:
+                    stack[height++] = lval_copy(y);
+                    continue;
+            }
+
+        }
+
+        // Call the first element's value with the others'.
+        int n = height - base - 1;
+        lval* f = stack[base];
+        pc = LVM_WALK_CALL;
+
+        if(lval_type(f) != LVAL_FUN) {
+            x = lvm_invoke(env, n);
+            goto finish;
+        }
+
+        if(f->builtin) {
+            lval* body = lvm_unfold(n);
+            if(!body) {
+                x = lvm_invoke(env, n);
+                goto finish;
+            }
+            lval_del(stack[base - 1]);
+            stack[base - 1] = body;
+            pc = 0;
+            continue;
+        }
+
+        // A partial application calls its lambda with the arguments it
+        // holds in front of those given.
+        int held = 0;
+        if(lval_is_partial(f)) {
+            held = f->bound->count;
+            n = lvm_spread(n);
+            f = stack[base];
+        }
+
+        if(lvm_can_call(f, n)) {
+            if((x = lvm_rebind(base, &env, &frames, n))) {
+                goto finish;
+            }
+            calls[call_count - 1] = (struct lvm_frame){ stack[base - 1]->code, 0, base, env, frames };
+            return NULL;
+        }
+
+        // Otherwise the body runs here in a new environment, in which the
+        // running one is kept unless the new one hides everything in it.
+        if(lvm_bytes() + LVM_ENV_BYTES > limit) {
+            x = lvm_overflow(n + 1);
+            goto finish;
+        }
+
+        lenv* frame;
+        if((x = lval_bind(env, f, lvm_args(n), held, &frame))) {
+            lval_del(stack[--height]);
+            goto finish;
+        }
+
+        bool hidden = frames > 0;
+        for(int i = 0; hidden && i < env->count; ++i) {
+            hidden = lenv_slot(frame, env->syms[i]) != -1;
+        }
+
+        if(hidden) {
+            frame->parent = env->parent;
+            lgc_pop_env(2);
+            lgc_push_env(frame);
+            lenv_del_frame(env);
+        } else {
+            frames++;
+            envs++;
+        }
+        env = frame;
+
+        f = stack[--height];
+        lval_del(stack[base - 1]);
+        stack[base - 1] = lval_copy(f->body);
+        lval_del(f);
+        pc = 0;
+        continue;
+
+        // The list has value x. A frame below that is the tree walker's
+        // takes it as the value of its element.
+    finish:
+        while(height > base) {
+            lvm_drop(stack[--height]);
+        }
+        lvm_leave(env, frames);
+        if(--call_count == bottom || calls[call_count - 1].code) {
+            return x;
+        }
+
+        lval_del(stack[--height]);
+        pc = calls[call_count - 1].pc;
+        base = calls[call_count - 1].base;
+        env = calls[call_count - 1].env;
+        frames = calls[call_count - 1].frames;
+
+    }
+
+}
+
+// Arguments of the call and error that native code last exited with.
+static int exit_args = 0;
+static lval* exit_error = NULL;
+
+// Runs of compiled functions nested in native code's calls of them, and
+// how deep they may go before calls are left to the instruction loop.
+static int nested = 0;
+#define LVM_NESTING 256
+
+lval*** const lvm_stack = &stack;
+int* const lvm_height = &height;
+
+// GLOBAL
+int lvm_do_global(lenv* env, char* sym) {
+
+    lval* x = lvm_lookup(env, sym);
+
+    if(!x) {
+        exit_error = lval_err("Unbound symbol: '%s'", sym);
+        return LVM_EXIT_ERROR;
+    }
+
+    stack[height++] = lval_copy(x);
+    return LVM_EXIT_NONE;
+
+}
+
+// IF
+int lvm_do_if(lenv* env, char* sym) {
+
+    lval* x = lvm_lookup(env, sym);
+
+    if(x && lval_type(x) == LVAL_FUN && x->builtin == builtin_if) {
+        return LVM_EXIT_NONE;
+    } else if(!x) {
+        exit_error = lval_err("Unbound symbol: '%s'", sym);
+        return LVM_EXIT_ERROR;
+    }
+
+    stack[height++] = lval_copy(x);
+    return -1;
+
+}
+
+// BRANCH
+int lvm_do_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = stack[height - 1];
+
+    if(lval_type(cond) == LVAL_BOOL) {
+        bool val = cond->val;
+        lval_del(stack[--height]);
+        return val ? LVM_EXIT_NONE : -1;
+    }
+
+    // The builtin reports the error.
+    lval* a = lvm_args(1);
+    lval_add(a, lval_copy(*then));
+    lval_add(a, lval_copy(*otherwise));
+    exit_error = builtin_if(env, a);
+    return LVM_EXIT_ERROR;
+
+}
+
+// CALL: compiled functions are run by a nested run of the instruction loop, which
+// goes into their native code in turn, while the C stack has room; deeper
+// calls, and those of the tree walker, are left to the loop, which does not
+// nest.
+int lvm_do_call(lenv* env, int n) {
+
+    lval* f = stack[height - n - 1];
+
+    if(lval_type(f) == LVAL_FUN && lval_is_partial(f)
+            && lvm_can_call(f->target, f->bound->count + n)) {
+        n = lvm_spread(n);
+        f = stack[height - n - 1];
+    }
+
+    lval* x;
+
+    if(lval_type(f) == LVAL_FUN && !f->builtin && lvm_can_call(f, n)) {
+        if(nested == LVM_NESTING || lvm_native_exhausted()) {
+            exit_args = n;
+            return LVM_EXIT_CALL;
+        }
+        nested++;
+        x = lvm_enter(env, n);
+        nested--;
+        lval_del(stack[--height]);
+    } else if(lvm_walks(n)) {
+        exit_args = n;
+        return LVM_EXIT_CALL;
+    } else {
+        x = lvm_invoke(env, n);
+    }
+
+    if(lval_type(x) == LVAL_ERR) {
+        exit_error = x;
+        return LVM_EXIT_ERROR;
+    }
+
+    stack[height++] = x;
+    return LVM_EXIT_NONE;
+
+}
+
+// Arithmetic and comparison whose operator f, named sym, is not the
+// builtin or not given numbers it works on.
+static int lvm_do_operator(lenv* env, lval* f, char* sym) {
+
+    if(!f) {
+        exit_error = lval_err("Unbound symbol: '%s'", sym);
+        return LVM_EXIT_ERROR;
+    }
+
+    lvm_operator(f);
+    return lvm_do_call(env, 2);
+
+}
+
+// ADD to NE, one function each for lvm_typed to be specialized.
+#define LVM_DO_TYPED(op) \
+    static int lvm_do_##op(lenv* env, char* sym, int box) { \
+        lval* f = lvm_lookup(env, sym); \
+        return lvm_typed(op, f, box) ? LVM_EXIT_NONE : lvm_do_operator(env, f, sym); \
+    }
+
+LVM_DO_TYPED(LVM_ADD)
+LVM_DO_TYPED(LVM_SUB)
+LVM_DO_TYPED(LVM_MUL)
+LVM_DO_TYPED(LVM_DIV)
+LVM_DO_TYPED(LVM_LT)
+LVM_DO_TYPED(LVM_GT)
+LVM_DO_TYPED(LVM_LE)
+LVM_DO_TYPED(LVM_GE)
+LVM_DO_TYPED(LVM_EQ)
+LVM_DO_TYPED(LVM_NE)
+
+int (*const lvm_do_typed[])(lenv*, char*, int) = {
+    lvm_do_LVM_ADD, lvm_do_LVM_SUB, lvm_do_LVM_MUL, lvm_do_LVM_DIV, lvm_do_LVM_LT,
+    lvm_do_LVM_GT, lvm_do_LVM_LE, lvm_do_LVM_GE, lvm_do_LVM_EQ, lvm_do_LVM_NE
+};
+
+#ifdef LVM_JIT
+
+// Emit a call of helper fn with the environment, held in RBX, as its first
+// argument if env is true, then the words given.
+static void lvm_jit_emit_call(ljit_buf* b, void (*fn)(void), bool env, int count, ...) {
+
+    static const enum ljit_reg args[] = { LJIT_RDI, LJIT_RSI, LJIT_RDX, LJIT_RCX };
+    int i = 0;
+
+    if(env) {
+        ljit_mov(b, args[i++], LJIT_RBX);
+    }
+
+    va_list words;
+    va_start(words, count);
+    while(count--) {
+        ljit_mov_imm(b, args[i++], va_arg(words, uint64_t));
+    }
+    va_end(words);
+
+    ljit_call(b, fn);
+
+}
+
+// Emit code leaving to the instruction loop at pc with the exit a helper
+// returned, if it is not LVM_EXIT_NONE, through the code at leave.
+static void lvm_jit_emit_exit(ljit_buf* b, int pc, int leave) {
+
+    ljit_test32(b, LJIT_RAX, LJIT_RAX);
+    int skip = ljit_jcc(b, LJIT_ZERO, -1);
+    ljit_or32_imm(b, LJIT_RAX, pc << LVM_EXIT_BITS);
+    ljit_jmp(b, leave);
+    ljit_patch(b, skip, ljit_here(b));
+
+}
+
+// Emit code pushing the value in RAX, taking a reference to it unless it is
+// an immediate. R13 and R14 hold the addresses of height and stack.
+static void lvm_jit_emit_push(ljit_buf* b) {
+
+#ifdef LVAL_IMMEDIATE
+    ljit_mov(b, LJIT_RCX, LJIT_RAX);
+    ljit_shr_imm(b, LJIT_RCX, 48);
+    int immediate = ljit_jcc(b, LJIT_NONZERO, -1);
+    ljit_inc32_mem(b, LJIT_RAX, offsetof(lval, refs));
+    ljit_patch(b, immediate, ljit_here(b));
+#else
+    ljit_inc32_mem(b, LJIT_RAX, offsetof(lval, refs));
+#endif
+    ljit_load(b, LJIT_RCX, LJIT_R14, 0);
+    ljit_load32s(b, LJIT_RDX, LJIT_R13, 0);
+    ljit_store_index(b, LJIT_RCX, LJIT_RDX, 0, LJIT_RAX);
+    ljit_inc32_mem(b, LJIT_R13, 0);
+
+}
+
+#define LVM_FN(fn) ((void (*)(void))(fn))
+#define LVM_WORD(x) ((uint64_t)(uintptr_t)(x))
+
+// Compile code to machine code, a template of calls to the helpers above
+// for each instruction. Jumps between instructions are native, and a table
+// of where each starts lets the instruction loop enter at any of them.
+static void lvm_jit(lcode* code) {
+
+    ljit_buf b;
+    ljit_init(&b);
+
+    int* ops = code->ops;
+    int* starts = malloc(sizeof(int) * code->op_count);
+    int* jumps = malloc(sizeof(int) * 2 * code->op_count); // Where and to which pc
+    int jump_count = 0;
+
+    // The Booleans, which are never freed.
+    lval* yes = lval_bool(true);
+    lval* no = lval_bool(false);
+    lval_del(yes);
+    lval_del(no);
+
+    // The table of entries, by pc.
+    for(int pc = 0; pc < code->op_count; ++pc) {
+        ljit_u64(&b, 0);
+    }
+
+    // int native(lcode* code, int pc, lenv* env), with env kept in RBX, the count of
+    // instructions run in R12, and the addresses of height and stack in
+    // R13 and R14. R15 is saved only to keep the stack aligned for calls.
+    int entry = ljit_here(&b);
+    ljit_push(&b, LJIT_RBX);
+    ljit_push(&b, LJIT_R12);
+    ljit_push(&b, LJIT_R13);
+    ljit_push(&b, LJIT_R14);
+    ljit_push(&b, LJIT_R15);
+    ljit_mov(&b, LJIT_RBX, LJIT_RDX);
+    ljit_xor32(&b, LJIT_R12, LJIT_R12);
+    ljit_mov_imm(&b, LJIT_R13, LVM_WORD(&height));
+    ljit_mov_imm(&b, LJIT_R14, LVM_WORD(&stack));
+    ljit_mov32(&b, LJIT_RAX, LJIT_RSI);
+    ljit_mov_addr(&b, LJIT_RCX, 0);
+    ljit_jmp_table(&b, LJIT_RCX, LJIT_RAX);
+
+    // Return the exit word in EAX, adding up the instructions run.
+    int leave = ljit_here(&b);
+    ljit_mov_imm(&b, LJIT_RCX, LVM_WORD(&steps));
+    ljit_add_to_mem(&b, LJIT_RCX, LJIT_R12);
+    ljit_pop(&b, LJIT_R15);
+    ljit_pop(&b, LJIT_R14);
+    ljit_pop(&b, LJIT_R13);
+    ljit_pop(&b, LJIT_R12);
+    ljit_pop(&b, LJIT_RBX);
+    ljit_ret(&b);
+
+    for(int pc = 0; pc < code->op_count; pc += lvm_op_size[ops[pc]]) {
+
+        int op = ops[pc];
+        int next = pc + lvm_op_size[op];
+        starts[pc] = ljit_here(&b);
+        ljit_addr(&b, pc * 8, starts[pc]);
+
+        ljit_inc(&b, LJIT_R12);
+
+        // The first half of a superinstruction. Constants and arguments are
+        // pushed inline.
+        switch(op) {
+            case LVM_CONST:
+            case LVM_CONST_CALL:
+                ljit_mov_imm(&b, LJIT_RAX, LVM_WORD(&code->consts[ops[pc + 1]]));
+                ljit_load(&b, LJIT_RAX, LJIT_RAX, 0);
+                lvm_jit_emit_push(&b);
+                break;
+            case LVM_LOCAL:
+            case LVM_LOCAL_LOCAL:
+            case LVM_LOCAL_CONST:
+            case LVM_LOCAL_CALL:
+                ljit_load(&b, LJIT_RAX, LJIT_RBX, offsetof(lenv, vals));
+                ljit_load(&b, LJIT_RAX, LJIT_RAX, sizeof(lval*) * ops[pc + 1]);
+                lvm_jit_emit_push(&b);
+                break;
+            case LVM_GLOBAL:
+            case LVM_GLOBAL_LOCAL:
+            case LVM_GLOBAL_GLOBAL:
+                lvm_jit_emit_call(&b, LVM_FN(lvm_do_global), true, 1, LVM_WORD(code->names[ops[pc + 1]]));
+                lvm_jit_emit_exit(&b, next, leave);
+                break;
+        }
+
+        switch(op) {
+
+            // Done above.
+            case LVM_CONST:
+            case LVM_LOCAL:
+            case LVM_GLOBAL:
+                break;
+
+            case LVM_GLOBAL_LOCAL:
+            case LVM_LOCAL_LOCAL:
+                ljit_load(&b, LJIT_RAX, LJIT_RBX, offsetof(lenv, vals));
+                ljit_load(&b, LJIT_RAX, LJIT_RAX, sizeof(lval*) * ops[pc + 2]);
+                lvm_jit_emit_push(&b);
+                break;
+
+            case LVM_GLOBAL_GLOBAL:
+                lvm_jit_emit_call(&b, LVM_FN(lvm_do_global), true, 1, LVM_WORD(code->names[ops[pc + 2]]));
+                lvm_jit_emit_exit(&b, next, leave);
+                break;
+
+            case LVM_LOCAL_CONST:
+                ljit_mov_imm(&b, LJIT_RAX, LVM_WORD(&code->consts[ops[pc + 2]]));
+                ljit_load(&b, LJIT_RAX, LJIT_RAX, 0);
+                lvm_jit_emit_push(&b);
+                break;
+
+            case LVM_CALL:
+            case LVM_LOCAL_CALL:
+            case LVM_CONST_CALL:
+                lvm_jit_emit_call(&b, LVM_FN(lvm_do_call), true, 1, (uint64_t)ops[next - 1]);
+                lvm_jit_emit_exit(&b, next, leave);
+                break;
+
+            case LVM_IF:
+                lvm_jit_emit_call(&b, LVM_FN(lvm_do_if), true, 1, LVM_WORD(code->names[ops[pc + 1]]));
+                ljit_test32(&b, LJIT_RAX, LJIT_RAX);
+                jumps[2 * jump_count] = ljit_jcc(&b, LJIT_SIGN, -1);
+                jumps[2 * jump_count++ + 1] = ops[pc + 2];
+                lvm_jit_emit_exit(&b, next, leave);
+                break;
+
+            // A Boolean is popped and tested inline, anything else left to
+            // the helper.
+            case LVM_BRANCH: {
+                ljit_load(&b, LJIT_RCX, LJIT_R14, 0);
+                ljit_load32s(&b, LJIT_RDX, LJIT_R13, 0);
+                ljit_load_index(&b, LJIT_RAX, LJIT_RCX, LJIT_RDX, -(int)sizeof(lval*));
+                ljit_mov_imm(&b, LJIT_RSI, LVM_WORD(yes));
+                ljit_cmp(&b, LJIT_RAX, LJIT_RSI);
+                int then = ljit_jcc(&b, LJIT_ZERO, -1);
+                ljit_mov_imm(&b, LJIT_RSI, LVM_WORD(no));
+                ljit_cmp(&b, LJIT_RAX, LJIT_RSI);
+                int other = ljit_jcc(&b, LJIT_NONZERO, -1);
+                ljit_dec32_mem(&b, LJIT_RAX, offsetof(lval, refs));
+                ljit_dec32_mem(&b, LJIT_R13, 0);
+                jumps[2 * jump_count] = ljit_jmp(&b, -1);
+                jumps[2 * jump_count++ + 1] = ops[pc + 3];
+
+                ljit_patch(&b, other, ljit_here(&b));
+                lvm_jit_emit_call(&b, LVM_FN(lvm_do_branch), true, 2,
+                                  LVM_WORD(&code->consts[ops[pc + 1]]),
+                                  LVM_WORD(&code->consts[ops[pc + 2]]));
+                ljit_test32(&b, LJIT_RAX, LJIT_RAX);
+                jumps[2 * jump_count] = ljit_jcc(&b, LJIT_SIGN, -1);
+                jumps[2 * jump_count++ + 1] = ops[pc + 3];
+                lvm_jit_emit_exit(&b, next, leave);
+                int done = ljit_jmp(&b, -1);
+
+                ljit_patch(&b, then, ljit_here(&b));
+                ljit_dec32_mem(&b, LJIT_RAX, offsetof(lval, refs));
+                ljit_dec32_mem(&b, LJIT_R13, 0);
+                ljit_patch(&b, done, ljit_here(&b));
+                break;
+            }
+
+            case LVM_JUMP:
+                jumps[2 * jump_count] = ljit_jmp(&b, -1);
+                jumps[2 * jump_count++ + 1] = ops[pc + 1];
+                break;
+
+            case LVM_TAILCALL:
+            case LVM_RETURN:
+                ljit_mov_imm(&b, LJIT_RAX, (pc << LVM_EXIT_BITS)
+                             | (op == LVM_RETURN ? LVM_EXIT_RETURN : LVM_EXIT_TAILCALL));
+                ljit_jmp(&b, leave);
+                break;
+
+            // Arithmetic and comparison.
+            default:
+                lvm_jit_emit_call(&b, LVM_FN(lvm_do_typed[op - LVM_ADD]), true, 2,
+                                  LVM_WORD(code->names[ops[pc + 1]]), (uint64_t)ops[pc + 2]);
+                lvm_jit_emit_exit(&b, next, leave);
+                break;
+        }
+
+    }
+
+    for(int i = 0; i < jump_count; ++i) {
+        ljit_patch(&b, jumps[2 * i], starts[jumps[2 * i + 1]]);
+    }
+
+    // Named for perf by the function's formals.
+    char name[256];
+    int length = snprintf(name, sizeof(name), "blisp lambda {");
+    for(int i = 0; i < code->arity && length < (int)sizeof(name) - 1; ++i) {
+        bool rest = code->variadic && i == code->arity - 1;
+        length += snprintf(name + length, sizeof(name) - length, i ? " %s%s" : "%s%s",
+                           rest ? "& " : "", code->formals[i]);
+    }
+    if(length < (int)sizeof(name) - 1) {
+        snprintf(name + length, sizeof(name) - length, "}");
+    }
+
+    code->jit = ljit_place(&b, entry, name);
+    if(code->jit) {
+        code->native = (lvm_native)(uintptr_t)((char*)code->jit + entry);
+    }
+
+    ljit_done(&b);
+    free(starts);
+    free(jumps);
+
+}
+#else
+// Machine code is not supported here, so code stays on the loop.
+static void lvm_jit(lcode* code) {
+}
+#endif
+
+// Count each instruction as it is dispatched.
+#ifdef LVM_PROFILE
+#define LVM_STEP() (count++, lvm_profile(code, pc))
+#else
+#define LVM_STEP() count++
+#endif
+
+// Label the code for opcode op, and go on to the instruction at pc, which
+// with threading jumps there directly instead of through the switch.
+#ifdef LVM_THREADED
+#define LVM_OP(op) case op: op_##op
+#define LVM_NEXT() do { LVM_STEP(); goto *targets[ops[pc]]; } while(0)
+#else
+#define LVM_OP(op) case op
+#define LVM_NEXT() continue
+#endif
+
+// Go on at pc in code, which may have just been entered, in its machine
+// code if it has been compiled to it.
+#define LVM_ENTER() \
+    if(code->native) { \
+        goto native; \
+    } \
+    LVM_NEXT()
+
+// Run arithmetic or comparison instruction op, written out for each so
+// that the compiler can specialize it, or call the function instead. Not
+// wrapped in a loop, where LVM_NEXT's continue would stop short.
+#define LVM_TYPED(op) \
+    x = lvm_lookup(env, code->names[ops[pc + 1]]); \
+    if(lvm_typed(op, x, ops[pc + 2])) { \
+        pc += 3; \
+        LVM_NEXT(); \
+    } \
+    goto typed_call
+
+// Run the compiled function whose frame is on top of the stack, and the
+// compiled functions it calls, until one of them finishes with a frame of
+// the tree walker or frame bottom below, returning its value with the
+// function left on the stack, or starts the tree walker, returning NULL.
+// x is the value of the call the function made last, or NULL to start it
+// or carry on from where it was left.
+static lval* lvm_run(int bottom, lval* x) {
+
+    // Compiled functions called from here get frames of their own instead
+    // of a nested run, so only the state of the innermost is kept in
+    // locals. Calls in tail position replace the function, and its
+    // environment too unless the new one still needs to see it. frames
+    // counts the environments owned, which are env and its first
+    // ancestors.
+    lcode* code = calls[call_count - 1].code;
+    int* ops = code->ops;
+    int pc = calls[call_count - 1].pc;
+    int base = calls[call_count - 1].base;
+    lenv* env = calls[call_count - 1].env;
+    int frames = calls[call_count - 1].frames;
+
+    // Instructions run, added to the total on the way out.
+    long count = 0;
+
+#ifdef LVM_THREADED
+    static void* targets[LVM_OP_COUNT] = {
+        [LVM_CONST] = &&op_LVM_CONST,
+        [LVM_LOCAL] = &&op_LVM_LOCAL,
+        [LVM_GLOBAL] = &&op_LVM_GLOBAL,
+        [LVM_IF] = &&op_LVM_IF,
+        [LVM_BRANCH] = &&op_LVM_BRANCH,
+        [LVM_JUMP] = &&op_LVM_JUMP,
+        [LVM_CALL] = &&op_LVM_CALL,
+        [LVM_TAILCALL] = &&op_LVM_TAILCALL,
+        [LVM_RETURN] = &&op_LVM_RETURN,
+        [LVM_ADD] = &&op_LVM_ADD,
+        [LVM_SUB] = &&op_LVM_SUB,
+        [LVM_MUL] = &&op_LVM_MUL,
+        [LVM_DIV] = &&op_LVM_DIV,
+        [LVM_LT] = &&op_LVM_LT,
+        [LVM_GT] = &&op_LVM_GT,
+        [LVM_LE] = &&op_LVM_LE,
+        [LVM_GE] = &&op_LVM_GE,
+        [LVM_EQ] = &&op_LVM_EQ,
+        [LVM_NE] = &&op_LVM_NE,
+        [LVM_GLOBAL_LOCAL] = &&op_LVM_GLOBAL_LOCAL,
+        [LVM_GLOBAL_GLOBAL] = &&op_LVM_GLOBAL_GLOBAL,
+        [LVM_LOCAL_LOCAL] = &&op_LVM_LOCAL_LOCAL,
+        [LVM_LOCAL_CONST] = &&op_LVM_LOCAL_CONST,
+        [LVM_LOCAL_CALL] = &&op_LVM_LOCAL_CALL,
+        [LVM_CONST_CALL] = &&op_LVM_CONST_CALL
+    };
+#endif
+
+    // Instructions that leave a value or finish the function break out of
+    // the switch to have it pushed or returned. The rest go straight on.
+    bool done = false;
+
+    // Arguments of the call being made.
+    int n;
+
+    if(x) {
+        goto value;
+    } else if(code->native) {
+        goto native;
+    }
+
+    while(true) {
+
+        LVM_STEP();
+        switch(ops[pc]) {
+
+            LVM_OP(LVM_CONST):
+                stack[height++] = lval_copy(code->consts[ops[pc + 1]]);
+                pc += 2;
+                LVM_NEXT();
+
+            LVM_OP(LVM_LOCAL):
+                stack[height++] = lval_copy(env->vals[ops[pc + 1]]);
+                pc += 2;
+                LVM_NEXT();
+
+            LVM_OP(LVM_GLOBAL): {
+                char* sym = code->names[ops[pc + 1]];
+                x = lvm_lookup(env, sym);
+                pc += 2;
+                if(x) {
+                    stack[height++] = lval_copy(x);
+                    LVM_NEXT();
+                }
+                x = lval_err("Unbound symbol: '%s'", sym);
+                break;
+            }
+
+            LVM_OP(LVM_GLOBAL_LOCAL): {
+                char* sym = code->names[ops[pc + 1]];
+                x = lvm_lookup(env, sym);
+                if(!x) {
+                    x = lval_err("Unbound symbol: '%s'", sym);
+                    pc += 3;
+                    break;
+                }
+                stack[height++] = lval_copy(x);
+                stack[height++] = lval_copy(env->vals[ops[pc + 2]]);
+                pc += 3;
+                LVM_NEXT();
+            }
+
+            LVM_OP(LVM_GLOBAL_GLOBAL): {
+                char* sym = code->names[ops[pc + 1]];
+                lval* y = lvm_lookup(env, code->names[ops[pc + 2]]);
+                x = lvm_lookup(env, sym);
+                if(!x || !y) {
+                    x = lval_err("Unbound symbol: '%s'", x ? code->names[ops[pc + 2]] : sym);
+                    pc += 3;
+                    break;
+                }
+                stack[height++] = lval_copy(x);
+                stack[height++] = lval_copy(y);
+                pc += 3;
+                LVM_NEXT();
+            }
+
+            LVM_OP(LVM_LOCAL_LOCAL):
+                stack[height++] = lval_copy(env->vals[ops[pc + 1]]);
+                stack[height++] = lval_copy(env->vals[ops[pc + 2]]);
+                pc += 3;
+                LVM_NEXT();
+
+            LVM_OP(LVM_LOCAL_CONST):
+                stack[height++] = lval_copy(env->vals[ops[pc + 1]]);
+                stack[height++] = lval_copy(code->consts[ops[pc + 2]]);
+                pc += 3;
+                LVM_NEXT();
+
+            // Push the value, then run the call from its operand on.
+            LVM_OP(LVM_LOCAL_CALL):
+                stack[height++] = lval_copy(env->vals[ops[pc + 1]]);
+                n = ops[pc + 2];
+                pc += 3;
+                goto call;
+
+            LVM_OP(LVM_CONST_CALL):
+                stack[height++] = lval_copy(code->consts[ops[pc + 1]]);
+                n = ops[pc + 2];
+                pc += 3;
+                goto call;
+
+            LVM_OP(LVM_IF): {
+                char* sym = code->names[ops[pc + 1]];
+                x = lvm_lookup(env, sym);
+                if(x && lval_type(x) == LVAL_FUN && x->builtin == builtin_if) {
+                    pc += 3;
+                    LVM_NEXT();
+                }
+                x = x ? lval_copy(x) : lval_err("Unbound symbol: '%s'", sym);
+                pc = ops[pc + 2];
+                break;
+            }
+
+            LVM_OP(LVM_BRANCH): {
+                lval* cond = stack[height - 1];
+                if(lval_type(cond) == LVAL_BOOL) {
+                    pc = cond->val ? pc + 4 : ops[pc + 3];
+                    lval_del(stack[--height]);
+                    LVM_NEXT();
+                }
+
+                // The builtin reports the error.
+                lval* a = lvm_args(1);
+                lval_add(a, lval_copy(code->consts[ops[pc + 1]]));
+                lval_add(a, lval_copy(code->consts[ops[pc + 2]]));
+                x = builtin_if(env, a);
+                break;
+            }
+
+            LVM_OP(LVM_JUMP):
+                pc = ops[pc + 1];
+                LVM_NEXT();
+
+            LVM_OP(LVM_CALL):
+                n = ops[pc + 1];
+                pc += 2;
+            call: {
+                lval* f = stack[height - n - 1];
+
+                if(lval_type(f) == LVAL_FUN && lval_is_partial(f)
+                        && lvm_can_call(f->target, f->bound->count + n)) {
+                    n = lvm_spread(n);
+                    f = stack[height - n - 1];
+                }
+
+                if(lval_type(f) != LVAL_FUN || f->builtin || !lvm_can_call(f, n)) {
+                    if(!lvm_walks(n)) {
+                        x = lvm_invoke(env, n);
+                        break;
+                    }
+
+                    // The tree walker runs the call, then this carries on.
+                    calls[call_count - 1] = (struct lvm_frame){ code, pc, base, env, frames };
+                    if((x = lvm_push_walk(env, n))) {
+                        break;
+                    }
+                    steps += count;
+                    return NULL;
+                }
+
+                // Save where to carry on, then start the callee.
+                calls[call_count - 1] = (struct lvm_frame){ code, pc, base, env, frames };
+                if(!lvm_push_frame(env, n)) {
+                    x = lvm_overflow(n + 1);
+                    break;
+                }
+                code = calls[call_count - 1].code;
+                ops = code->ops;
+                pc = 0;
+                base = height;
+                env = calls[call_count - 1].env;
+                frames = 1;
+                LVM_ENTER();
+            }
+
+            LVM_OP(LVM_TAILCALL):
+            tailcall: {
+                n = ops[pc + 1];
+                lval* f = stack[height - n - 1];
+
+                // Most builtins are simply called.
+                if(lval_type(f) == LVAL_FUN && f->builtin
+                        && f->builtin != builtin_eval && f->builtin != builtin_if) {
+                    x = lvm_invoke(env, n);
+                    pc += 2;
+                    break;
+                }
+
+                // The tree walker runs the body given to eval or if, and
+                // functions that cannot run compiled, in place of this.
+                lval* body = lvm_unfold(n);
+                if(body) {
+                    lval_del(stack[base - 1]);
+                    stack[base - 1] = body;
+                    calls[call_count - 1] = (struct lvm_frame){ NULL, 0, base, env, frames };
+                    steps += count;
+                    return NULL;
+                }
+
+                if(lval_type(f) == LVAL_FUN && lval_is_partial(f)
+                        && lvm_can_call(f->target, f->bound->count + n)) {
+                    n = lvm_spread(n);
+                    f = stack[height - n - 1];
+                }
+                if(lval_type(f) != LVAL_FUN || f->builtin || !lvm_can_call(f, n)) {
+                    if(!lvm_walks(n)) {
+                        x = lvm_invoke(env, n);
+                        pc += 2;
+                        break;
+                    }
+                    calls[call_count - 1] = (struct lvm_frame){ NULL, LVM_WALK_CALL, base, env, frames };
+                    steps += count;
+                    return NULL;
+                }
+
+                if((x = lvm_rebind(base, &env, &frames, n))) {
+                    pc += 2;
+                    break;
+                }
+                code = stack[base - 1]->code;
+                ops = code->ops;
+                pc = 0;
+                LVM_ENTER();
+            }
+
+            // Numbers are worked on as machine numbers while the operator
+            // is the builtin; anything else is a call.
+            LVM_OP(LVM_ADD):
+                LVM_TYPED(LVM_ADD);
+            LVM_OP(LVM_SUB):
+                LVM_TYPED(LVM_SUB);
+            LVM_OP(LVM_MUL):
+                LVM_TYPED(LVM_MUL);
+            LVM_OP(LVM_DIV):
+                LVM_TYPED(LVM_DIV);
+            LVM_OP(LVM_LT):
+                LVM_TYPED(LVM_LT);
+            LVM_OP(LVM_GT):
+                LVM_TYPED(LVM_GT);
+            LVM_OP(LVM_LE):
+                LVM_TYPED(LVM_LE);
+            LVM_OP(LVM_GE):
+                LVM_TYPED(LVM_GE);
+            LVM_OP(LVM_EQ):
+                LVM_TYPED(LVM_EQ);
+            LVM_OP(LVM_NE):
+                LVM_TYPED(LVM_NE);
+
+            // The operator x goes below the operands to be called.
+            typed_call:
+                if(!x) {
+                    x = lval_err("Unbound symbol: '%s'", code->names[ops[pc + 1]]);
+                    pc += 3;
+                    break;
+                }
+                lvm_operator(x);
+                n = 2;
+                pc += 3;
+                goto call;
+
+            LVM_OP(LVM_RETURN):
+            default:
+                x = stack[--height];
+                done = true;
+                break;
+        }
+
+        // An error ends every expression around it, so the whole body.
+    value:
+        if(lval_type(x) == LVAL_ERR) {
+            while(height > base) {
+                lvm_drop(stack[--height]);
+            }
+            done = true;
+        }
+
+        // A finished function hands its result to its caller, which an
+        // error finishes in turn.
+        while(done) {
+            lvm_leave(env, frames);
+            if(--call_count == bottom || !calls[call_count - 1].code) {
+                steps += count;
+                return x;
+            }
+
+            code = calls[call_count - 1].code;
+            ops = code->ops;
+            pc = calls[call_count - 1].pc;
+            base = calls[call_count - 1].base;
+            env = calls[call_count - 1].env;
+            frames = calls[call_count - 1].frames;
+            lval_del(stack[--height]);
+
+            done = lval_type(x) == LVAL_ERR;
+            while(done && height > base) {
+                lvm_drop(stack[--height]);
+            }
+        }
+
+        stack[height++] = x;
+        LVM_ENTER();
+
+        // Machine code runs from pc until the function returns, or makes a
+        // call that changes the frame, or fails. It has counted what it ran.
+    native: {
+            int word = code->native(code, pc, env);
+            pc = word >> LVM_EXIT_BITS;
+            switch(word & ((1 << LVM_EXIT_BITS) - 1)) {
+                case LVM_EXIT_CALL:
+                    n = exit_args;
+                    goto call;
+                case LVM_EXIT_ERROR:
+                    x = exit_error;
+                    goto value;
+                case LVM_EXIT_TAILCALL:
+                    goto tailcall;
+                default:
+                    x = stack[--height];
+                    done = true;
+                    goto value;
+            }
+        }
+
+    }
+
+}
+
+// Run the frame on top of the stack, and everything it calls, until it
+// returns, handing control between compiled code and the tree walker
+// without nesting either in C. Returns the value of the frame above frame
+// bottom, whose slot stays on the stack.
+LVM_INLINE lval* lvm_drive(int bottom) {
+
+    lval* x = NULL;
+
+    while(true) {
+
+        x = calls[call_count - 1].code ? lvm_run(bottom, x) : lvm_walk(bottom, x);
+
+        // A frame finished, with x for the one below.
+        if(x) {
+            if(call_count == bottom) {
+                return x;
+            }
+            lval_del(stack[--height]);
+        }
+
+    }
+
+}
+
+// Evaluate list v as an S-Expression in environment e, on the tree walker.
+// Consumes v.
+lval* lvm_eval(lenv* e, lval* v) {
+
+    // Builtins calling back in nest in C here, so stop before the C stack
+    // runs out.
+    if(lvm_native_exhausted()) {
+        lval_del(v);
+        return lval_err("Recursion too deep for the native stack");
+    }
+
+    if(lvm_bytes() + sizeof(struct lvm_frame) + sizeof(lval*) > limit) {
+        lval_del(v);
+        return lvm_overflow(0);
+    }
+
+    lvm_reserve(1);
+    stack[height++] = v;
+    lvm_push_call((struct lvm_frame){ NULL, 0, height, e, 0 });
+
+    lval* x = lvm_drive(call_count - 1);
+    lval_del(stack[--height]);
+    return x;
+
+}
+
+// Call user-defined function f with the arguments in a from environment
+// e. Consumes a.
+lval* lvm_apply(lenv* e, lval* f, lval* a) {
+
+    int n = a->count;
+
+    if(lvm_native_exhausted()) {
+        lval_del(a);
+        return lval_err("Recursion too deep for the native stack");
+    }
+
+    if(lvm_bytes() + sizeof(struct lvm_frame) + sizeof(lval*) * (n + 2) > limit) {
+        lval_del(a);
+        return lvm_overflow(0);
+    }
+
+    lvm_reserve(n + 2);
+    stack[height++] = lval_copy(f);
+    stack[height++] = lval_copy(f);
+    for(int i = 0; i < n; ++i) {
+        stack[height++] = lval_copy(lval_index(a, i));
+    }
+    lval_del(a);
+    lvm_push_call((struct lvm_frame){ NULL, LVM_WALK_CALL, height - n - 1, e, 0 });
+
+    lval* x = lvm_drive(call_count - 1);
+    lval_del(stack[--height]);
+    return x;
+
+}
+
+// Free compiled code, releasing its constants.
+void lvm_release(lcode* c) {
+
+    for(int i = 0; i < c->const_count; ++i) {
+        lval_del(c->consts[i]);
+    }
+
+    lvm_free(c);
+
+}
+
+// Free compiled code without touching its constants.
+void lvm_free(lcode* c) {
+
+    if(c->jit) {
+        ljit_release(c->jit);
+    }
+    free(c->formals);
+    free(c->ops);
+    free(c->consts);
+    free(c->names);
+    free(c);
+
+}
@@ -0,0 +1,226 @@
+#ifndef LVM_H
+#define LVM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "lbuiltin.h"
+
+typedef struct lcode lcode;
+
+// Default limit on the memory that the frames and values of running
+// compiled functions may take, which bounds the depth of recursion.
+#ifndef LVM_STACK_LIMIT
+#define LVM_STACK_LIMIT ((size_t)256 << 20)
+#endif
+
+// Size assumed for the C stack where it cannot be asked for.
+#ifndef LVM_NATIVE_STACK
+#define LVM_NATIVE_STACK ((size_t)1 << 20)
+#endif
+
+// Instructions of a compiled function body. Each opcode is followed in the
+// instruction array by the operands listed.
+enum lvm_op {
+    LVM_CONST, // k: push constant k
+    LVM_LOCAL, // i: push argument i
+    LVM_GLOBAL, // g: push the value of free symbol g
+    LVM_IF, // g, target: go on if symbol g is the builtin if, otherwise
+            // push its value and jump to target
+    LVM_BRANCH, // then, else, target: pop a Boolean and jump to target if
+                // false; constants then and else are the branches
+    LVM_JUMP, // target
+    LVM_CALL, // n: call the function below the top n values with them
+    LVM_TAILCALL, // n: as LVM_CALL, where the result is the function's own
+    LVM_RETURN, // return the top value
+
+    // Arithmetic and comparison of the top two values by the value of free
+    // symbol g, worked out directly when it is the builtin named and
+    // otherwise called with them. If box is 0 the result is an operand of
+    // another of these, and a number is left unboxed for it.
+    LVM_ADD, // g, box: +
+    LVM_SUB, // g, box: -
+    LVM_MUL, // g, box: *
+    LVM_DIV, // g, box: /
+    LVM_LT, // g, box: <
+    LVM_GT, // g, box: >
+    LVM_LE, // g, box: <=
+    LVM_GE, // g, box: >=
+    LVM_EQ, // g, box: ==
+    LVM_NE, // g, box: !=
+
+    // Superinstructions: pairs of the above run one after the other most
+    // often by the bench programs, merged to be dispatched once. Operands
+    // are those of the first, then of the second.
+    LVM_GLOBAL_LOCAL, // g, i
+    LVM_GLOBAL_GLOBAL, // g, h
+    LVM_LOCAL_LOCAL, // i, j
+    LVM_LOCAL_CONST, // i, k
+    LVM_LOCAL_CALL, // i, n
+    LVM_CONST_CALL, // k, n
+
+    LVM_OP_COUNT
+};
+
+// Words taken by each instruction, its opcode included.
+extern const int lvm_op_size[LVM_OP_COUNT];
+
+// Instructions are dispatched by jumping straight from each one to the code
+// for the next through a table of label addresses, where the compiler
+// supports it (GCC and Clang), and through a switch otherwise. Define
+// LVM_SWITCH to use the switch anyway, and LVM_NO_SUPER to compile without
+// superinstructions. Define LVM_PROFILE to count the instructions run, and
+// the pairs of them run one after the other, and print the most common at
+// exit.
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(LVM_SWITCH)
+#define LVM_THREADED
+#endif
+
+// Calls after which a function's code is compiled on to x86-64 machine
+// code, where supported (see ljit.h) and turned on by lvm_set_jit. Define
+// LJIT_NONE to never do so.
+#ifndef LVM_JIT_THRESHOLD
+#define LVM_JIT_THRESHOLD 1000
+#endif
+
+// Native code for a function's instructions, generated at run time or
+// compiled from C ahead of time. Runs code's instructions from pc in
+// environment env until one of them must be left to the instruction loop,
+// and returns the pc to carry on from, shifted left by LVM_EXIT_BITS, with
+// one of these below it.
+typedef int (*lvm_native)(lcode* code, int pc, lenv* env);
+
+enum lvm_exit {
+    LVM_EXIT_NONE, // Go on (returned only by the functions below)
+    LVM_EXIT_CALL, // Call the function below the top values, as many as
+                   // the last call that exited said
+    LVM_EXIT_ERROR, // Unwind with the error the exiting call made
+    LVM_EXIT_TAILCALL, // Run the TAILCALL at pc
+    LVM_EXIT_RETURN // Return the top value
+};
+#define LVM_EXIT_BITS 3
+
+// Bytecode compiled from a lambda's formals and body. Arguments live in
+// the first slots of the function's environment and are read by position.
+// Other symbols are free: scope is dynamic, so they are looked up by name
+// at run time, but one bound only globally is read straight from its
+// global entry. A function that cannot be compiled gets code with arity -1.
+//
+// Calls do not nest on the C stack: each gets a frame on a growable stack
+// of its own, so recursion is limited only by the memory allowed for it.
+// The tree walker, which evaluates what cannot be compiled, keeps its
+// frames there too, one for each list being evaluated, and the bodies
+// given to eval and if run in place of the call. Only builtins that run
+// Lisp themselves, such as load, nest in C, and stop with an error before
+// the C stack runs out.
+//
+// Slots of the stack serve as registers, which can hold an Integer or a
+// Number unboxed. Arithmetic and comparison of two values compile to
+// instructions for the operator, which work on machine integers and
+// doubles directly, so intermediate results of nested arithmetic are never
+// allocated. Results are boxed only where they go anywhere else: into a
+// call, an environment or the function's result.
+//
+// Calls in tail position, including through the branches of if and the
+// body given to eval, replace the running function instead of adding a
+// frame, so loops written as recursion run in constant space. The caller's
+// environment is dropped too when the callee's arguments hide all of it;
+// otherwise it is kept for dynamic scope, which costs memory but no frame.
+//
+// Code called often, once lvm_set_jit turns it on, is compiled on to machine
+// code, which pushes constants and arguments and tests Booleans itself,
+// calls a function of the VM for each other instruction, and jumps
+// directly, so that dispatch between instructions goes. Calls of compiled functions from it run nested, up to
+// a limit; returns, errors and deeper calls go through the instruction
+// loop. Code the same as some compiled to C ahead of time (see laot.h) runs
+// that instead from the start.
+struct lcode {
+    int arity;
+    char** formals; // Without '&', so the last takes the rest if variadic
+    bool variadic;
+    int* ops;
+    int op_count;
+    lval** consts;
+    int const_count;
+    char** names; // Free symbols
+    int name_count;
+    int depth; // Stack slots needed
+    int calls; // Calls so far, up to LVM_JIT_THRESHOLD
+    void* jit; // Machine code block, or NULL
+    lvm_native native; // Its entry
+};
+
+// Stack usage of running compiled functions.
+struct lvm_stats {
+    int depth; // Calls running
+    int peak_depth;
+    size_t bytes; // Memory used by their frames, values and environments
+    size_t peak_bytes;
+    size_t limit;
+};
+
+// Prepare the VM to run below global environment e. Call from main, so
+// that the C stack can be measured from here.
+void lvm_init(lenv* e);
+
+// Limit the stack memory that compiled functions may use to n bytes.
+// Calls that would go over it fail with an error.
+void lvm_set_limit(size_t n);
+
+// Compile functions called often on to machine code if on is true. Off by
+// default: on the benchmarks it runs no faster than the VM.
+void lvm_set_jit(bool on);
+
+// True if the C stack is nearly used up, so evaluation must not nest any
+// deeper.
+bool lvm_native_exhausted(void);
+
+// Stack usage counters. If reset is true, the peaks start again from the
+// current usage afterwards.
+struct lvm_stats lvm_get_stats(bool reset);
+
+// Number of instructions run so far.
+long lvm_steps(void);
+
+// Compile user-defined function f, if not done already. Returns true if
+// calls with n arguments can run on the VM. Define LVM_TREE_WALK to run
+// every function on the tree walker instead.
+bool lvm_can_call(lval* f, int n);
+
+// Evaluate list v as an S-Expression in environment e, on the tree walker.
+// Consumes v.
+lval* lvm_eval(lenv* e, lval* v);
+
+// Call user-defined function f with the arguments in a from environment
+// e. Consumes a.
+lval* lvm_apply(lenv* e, lval* f, lval* a);
+
+// The stack of values of running compiled functions and its height, for
+// native code to push and pop. The stack moves when it grows, which only
+// the functions below and calls do.
+extern lval*** const lvm_stack;
+extern int* const lvm_height;
+
+// What native code calls for instructions it does not do itself, each
+// doing the instruction of the same name. They return LVM_EXIT_NONE to go
+// on, or the exit to leave with. lvm_do_if and lvm_do_branch return -1 to
+// take the instruction's jump instead.
+int lvm_do_global(lenv* env, char* sym);
+int lvm_do_if(lenv* env, char* sym);
+int lvm_do_branch(lenv* env, lval** then, lval** otherwise);
+int lvm_do_call(lenv* env, int n);
+
+// The same for arithmetic and comparison, indexed by opcode from LVM_ADD.
+extern int (*const lvm_do_typed[])(lenv* env, char* sym, int box);
+
+// Run code whose instructions and free symbols are ops and names on native
+// function fn, from when it is compiled. Neither array is copied.
+void lvm_register(const int* ops, int op_count, char* const* names, int name_count,
+                  lvm_native fn);
+
+// Free compiled code, releasing its constants.
+void lvm_release(lcode* c);
+
+// Free compiled code without touching its constants.
+void lvm_free(lcode* c);
+
+#endif
@@ -0,0 +1,299 @@
+// Generated by blisp --emit-c from test/bignum.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {fact n}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l33, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l45;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 23:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 26);
+    case 26:
+        BLISP_DO(lvm_do_call(env, 1), 28);
+    case 28:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 1), 31);
+    case 31:
+        goto l45;
+    case 33:
+    l33:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 36:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 39);
+    case 39:
+        blisp_push(lval_copy(code->consts[1]));
+    case 41:
+        blisp_push(lval_copy(code->consts[2]));
+    case 43:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 43);
+    case 45:
+    l45:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 45);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 3, 0, 33, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 0, 3, 5, 45, 21, 1, 0, 22, 1, 4, 10, 2, 1, 6, 1, 11, 3, 1, 5, 45, 22, 1, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_2[] = { "if", "==", "-", "*" };
+
+// \ {n}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l34, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l46;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 22);
+        blisp_push(lval_copy(env->vals[0]));
+    case 22:
+        blisp_push(lval_copy(code->consts[4]));
+    case 24:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 27);
+    case 27:
+        BLISP_DO(lvm_do_call(env, 1), 29);
+    case 29:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 1), 32);
+    case 32:
+        goto l46;
+    case 34:
+    l34:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 37:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 40);
+    case 40:
+        blisp_push(lval_copy(code->consts[1]));
+    case 42:
+        blisp_push(lval_copy(code->consts[2]));
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 44);
+    case 46:
+    l46:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 46);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 34, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 0, 3, 5, 46, 1, 0, 19, 2, 0, 0, 4, 10, 3, 1, 6, 1, 11, 4, 1, 5, 46, 22, 0, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "==", "fact", "-", "*" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_int(INT64_C(9223372036854775807)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_int(INT64_MIN), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_int(INT64_C(4294967296)), lval_int(INT64_C(4294967296)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("-"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_int(INT64_C(9223372036854775807)), lval_int(INT64_C(1))), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_int(INT64_MIN), lval_int(INT64_C(-1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(200))), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(-3)), lval_int(INT64_C(101)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("/"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(10)), lval_int(INT64_C(40))), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(10)), lval_int(INT64_C(20)))), blisp_list(lval_sexpr(), 3, lval_sym("%"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(10)), lval_int(INT64_C(40))), lval_int(INT64_C(97))), blisp_list(lval_sexpr(), 3, lval_sym("%"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_int(INT64_C(0)), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(10)), lval_int(INT64_C(40)))), lval_int(INT64_C(97)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("/"), blisp_list(lval_sexpr(), 3, lval_sym("+"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(100))), lval_int(INT64_C(1))), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(64))), lval_big(lbig_read("18446744073709551616"))), blisp_list(lval_sexpr(), 3, lval_sym("<"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(64))), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(65)))), blisp_list(lval_sexpr(), 3, lval_sym(">"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_int(INT64_C(0)), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(64)))), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(63))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("fact"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(1))), blisp_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("n"), blisp_list(lval_sexpr(), 2, lval_sym("fact"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("fact"), lval_int(INT64_C(60)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("%"), blisp_list(lval_sexpr(), 2, lval_sym("fact"), lval_int(INT64_C(300))), lval_int(INT64_C(1000000007))), blisp_list(lval_sexpr(), 3, lval_sym("/"), blisp_list(lval_sexpr(), 2, lval_sym("fact"), lval_int(INT64_C(300))), blisp_list(lval_sexpr(), 2, lval_sym("fact"), lval_int(INT64_C(298))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("*"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(3)), lval_int(INT64_C(1000))), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(7)), lval_int(INT64_C(900))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("pow-mod"), lval_int(INT64_C(2)), lval_int(INT64_C(1000)), lval_int(INT64_C(1000000007))), blisp_list(lval_sexpr(), 4, lval_sym("pow-mod"), lval_int(INT64_C(3)), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(10)), lval_int(INT64_C(30))), blisp_list(lval_sexpr(), 3, lval_sym("+"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(89))), lval_int(INT64_C(-1))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("pow-mod"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(12345)), lval_int(INT64_C(20))), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(70))), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(10)), lval_int(INT64_C(25))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 46, blisp_names_2, 4, blisp_code_2);
+    lvm_register(blisp_ops_3, 47, blisp_names_3, 5, blisp_code_3);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,288 @@
+// Generated by blisp --emit-c from test/compare.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {order x y}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+    case 5:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 11:
+        BLISP_DO(lvm_do_typed[4](env, code->names[2], 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 17:
+        BLISP_DO(lvm_do_typed[5](env, code->names[3], 1), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 23:
+        BLISP_DO(lvm_do_typed[6](env, code->names[4], 1), 26);
+    case 26:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 29:
+        BLISP_DO(lvm_do_typed[7](env, code->names[5], 1), 32);
+    case 32:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 32);
+    case 34:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 34);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 19, 0, 1, 1, 2, 17, 1, 1, 21, 1, 2, 13, 2, 1, 21, 1, 2, 14, 3, 1, 21, 1, 2, 15, 4, 1, 21, 1, 2, 16, 5, 1, 7, 5, 8 };
+static char* const blisp_names_2[] = { "list", "==", "<", ">", "<=", ">=" };
+
+// \ {x y}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+    case 5:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 11:
+        BLISP_DO(lvm_do_typed[4](env, code->names[2], 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 17:
+        BLISP_DO(lvm_do_typed[5](env, code->names[3], 1), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 23:
+        BLISP_DO(lvm_do_typed[6](env, code->names[4], 1), 26);
+    case 26:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 29:
+        BLISP_DO(lvm_do_typed[7](env, code->names[5], 1), 32);
+    case 32:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 32);
+    case 34:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 34);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 19, 0, 0, 1, 1, 17, 1, 1, 21, 0, 1, 13, 2, 1, 21, 0, 1, 14, 3, 1, 21, 0, 1, 15, 4, 1, 21, 0, 1, 16, 5, 1, 7, 5, 8 };
+static char* const blisp_names_3[] = { "list", "==", "<", ">", "<=", ">=" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("a")), lval_int(INT64_C(9007199254740993))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("b")), lval_num(0x1p+53)));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("a"), lval_sym("b")), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("a"), lval_sym("b")), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_sym("a"), lval_sym("b")), blisp_list(lval_sexpr(), 3, lval_sym("<="), lval_sym("a"), lval_sym("b")), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_sym("a"), lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("b"), lval_sym("a")), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_sym("b"), lval_sym("a")), blisp_list(lval_sexpr(), 3, lval_sym("<="), lval_sym("b"), lval_sym("a")), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_sym("b"), lval_sym("a"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_int(INT64_C(9007199254740992)), lval_sym("b")), blisp_list(lval_sexpr(), 3, lval_sym("<="), lval_int(INT64_C(9007199254740992)), lval_sym("b")), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_int(INT64_C(9007199254740992)), lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_int(INT64_C(9007199254740991)), lval_sym("b")), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_num(0x1p+53), lval_int(INT64_C(9007199254740991)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_int(INT64_C(3)), lval_num(0x1.cp+1)), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_int(INT64_C(3)), lval_num(0x1.cp+1)), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_int(INT64_C(-3)), lval_num(-0x1.4p+1)), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_int(INT64_C(-3)), lval_num(-0x1.cp+1)), blisp_list(lval_sexpr(), 3, lval_sym("<="), lval_int(INT64_C(4)), lval_num(0x1p+2)), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_num(0x1p+2), lval_int(INT64_C(4)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_int(INT64_C(9223372036854775807)), lval_num(0x1p+63)), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_int(INT64_MIN), lval_num(-0x1p+63))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_big(lbig_read("18446744073709551617")), lval_num(0x1p+64)), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_big(lbig_read("18446744073709551617")), lval_num(0x1p+64))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_big(lbig_read("18446744073709551616")), lval_num(0x1p+64)), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_big(lbig_read("-18446744073709551617")), lval_num(-0x1p+64))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("inf")), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_num(0x1.4p+3), lval_int(INT64_C(400)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("nan")), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("inf"), lval_sym("inf"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_int(INT64_C(9223372036854775807)), lval_sym("inf")), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_int(INT64_MIN), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_int(INT64_C(0)), lval_sym("inf"))), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_big(lbig_read("18446744073709551617")), lval_sym("inf"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_int(INT64_C(1)), lval_sym("nan")), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_int(INT64_C(1)), lval_sym("nan")), blisp_list(lval_sexpr(), 3, lval_sym("<="), lval_int(INT64_C(1)), lval_sym("nan")), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_sym("nan"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_big(lbig_read("18446744073709551617")), lval_sym("nan"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("order"), lval_sym("x"), lval_sym("y")), blisp_list(lval_qexpr(), 6, lval_sym("list"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("<="), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_sym("x"), lval_sym("y")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_sym("a"), lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_sym("b"), lval_sym("a"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_int(INT64_C(9007199254740991)), lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_int(INT64_C(3)), lval_num(0x1.cp+1))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_int(INT64_C(-3)), lval_num(-0x1.cp+1))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_int(INT64_C(9223372036854775807)), lval_num(0x1p+63))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_int(INT64_MIN), lval_num(-0x1p+63))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_big(lbig_read("18446744073709551617")), lval_num(0x1p+64))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_int(INT64_C(1)), lval_sym("inf"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_int(INT64_C(1)), lval_sym("nan"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_sym("nan"), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 35, blisp_names_2, 6, blisp_code_2);
+    lvm_register(blisp_ops_3, 35, blisp_names_3, 6, blisp_code_3);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,1435 @@
+// Generated by blisp --emit-c from test/compile.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {fib n}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l42, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[4](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l54;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_call(env, 1), 27);
+    case 27:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 30:
+        blisp_push(lval_copy(code->consts[4]));
+    case 32:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 1), 37);
+    case 37:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 40);
+    case 40:
+        goto l54;
+    case 42:
+    l42:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 45:
+        BLISP_DO(lvm_do_typed[4](env, code->names[1], 1), 48);
+    case 48:
+        blisp_push(lval_copy(code->consts[1]));
+    case 50:
+        blisp_push(lval_copy(code->consts[2]));
+    case 52:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 52);
+    case 54:
+    l54:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 54);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 3, 0, 42, 22, 1, 0, 13, 1, 1, 4, 1, 2, 17, 1, 1, 5, 54, 21, 0, 1, 0, 3, 10, 2, 1, 6, 1, 21, 0, 1, 0, 4, 10, 2, 1, 6, 1, 9, 3, 1, 5, 54, 22, 1, 5, 13, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_2[] = { "if", "<", "-", "+" };
+
+// \ {n}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l42, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[4](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[0]));
+    case 15:
+        goto l54;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_call(env, 1), 27);
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 30);
+        blisp_push(lval_copy(env->vals[0]));
+    case 30:
+        blisp_push(lval_copy(code->consts[4]));
+    case 32:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 1), 37);
+    case 37:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 40);
+    case 40:
+        goto l54;
+    case 42:
+    l42:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 45:
+        BLISP_DO(lvm_do_typed[4](env, code->names[1], 1), 48);
+    case 48:
+        blisp_push(lval_copy(code->consts[1]));
+    case 50:
+        blisp_push(lval_copy(code->consts[2]));
+    case 52:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 52);
+    case 54:
+    l54:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 54);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 42, 22, 0, 0, 13, 1, 1, 4, 1, 2, 17, 1, 0, 5, 54, 19, 2, 0, 0, 3, 10, 3, 1, 6, 1, 19, 2, 0, 0, 4, 10, 3, 1, 6, 1, 9, 4, 1, 5, 54, 22, 0, 5, 13, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "<", "fib", "-", "+" };
+
+// \ {n}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[1], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_call(env, 1), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 13);
+        blisp_push(lval_copy(env->vals[0]));
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+    case 15:
+        BLISP_DO(lvm_do_typed[1](env, code->names[1], 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 23);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 23);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 19, 0, 0, 0, 0, 10, 1, 1, 6, 1, 19, 0, 0, 0, 1, 10, 1, 1, 6, 1, 9, 2, 1, 8 };
+static char* const blisp_names_4[] = { "fib", "-", "+" };
+
+// \ {}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_call(env, 1), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+    case 15:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 23);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 23);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 0, 0, 10, 2, 1, 6, 1, 20, 0, 1, 0, 1, 10, 2, 1, 6, 1, 9, 3, 1, 8 };
+static char* const blisp_names_5[] = { "fib", "n", "-", "+" };
+
+// \ {step x v n acc}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l61, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[4]));
+    case 15:
+        goto l73;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 23:
+        BLISP_DO(lvm_do_typed[2](env, code->names[2], 0), 26);
+    case 26:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 29);
+    case 29:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 32:
+        blisp_push(lval_copy(code->consts[4]));
+    case 34:
+        BLISP_DO(lvm_do_typed[2](env, code->names[2], 0), 37);
+    case 37:
+        BLISP_DO(lvm_do_typed[1](env, code->names[4], 1), 40);
+    case 40:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 43:
+        BLISP_DO(lvm_do_typed[1](env, code->names[4], 1), 46);
+    case 46:
+        blisp_push(lval_copy(env->vals[4]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 49:
+        blisp_push(lval_copy(env->vals[1]));
+    case 51:
+        BLISP_DO(lvm_do_typed[2](env, code->names[2], 0), 54);
+    case 54:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 57);
+    case 57:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 57);
+    case 59:
+        goto l73;
+    case 61:
+    l61:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 64:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 67);
+    case 67:
+        blisp_push(lval_copy(code->consts[1]));
+    case 69:
+        blisp_push(lval_copy(code->consts[2]));
+    case 71:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 71);
+    case 73:
+    l73:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 73);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 3, 0, 61, 22, 3, 0, 17, 1, 1, 4, 1, 2, 17, 1, 4, 5, 73, 21, 0, 1, 22, 2, 3, 11, 2, 0, 9, 3, 1, 21, 2, 1, 0, 4, 11, 2, 0, 10, 4, 1, 22, 3, 5, 10, 4, 1, 21, 4, 1, 1, 1, 11, 2, 0, 9, 3, 1, 7, 4, 5, 73, 22, 3, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_6[] = { "if", "==", "*", "+", "-" };
+
+// \ {x v n acc}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l61, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[3]));
+    case 15:
+        goto l73;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 23:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 26);
+    case 26:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 29);
+    case 29:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 32:
+        blisp_push(lval_copy(code->consts[4]));
+    case 34:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 37);
+    case 37:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 40);
+    case 40:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 43:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 46);
+    case 46:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 49:
+        blisp_push(lval_copy(env->vals[0]));
+    case 51:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 54);
+    case 54:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 57);
+    case 57:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 57);
+    case 59:
+        goto l73;
+    case 61:
+    l61:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 64:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 67);
+    case 67:
+        blisp_push(lval_copy(code->consts[1]));
+    case 69:
+        blisp_push(lval_copy(code->consts[2]));
+    case 71:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 71);
+    case 73:
+    l73:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 73);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 3, 0, 61, 22, 2, 0, 17, 1, 1, 4, 1, 2, 17, 1, 3, 5, 73, 19, 2, 0, 22, 1, 3, 11, 3, 0, 9, 4, 1, 21, 1, 0, 0, 4, 11, 3, 0, 10, 5, 1, 22, 2, 5, 10, 5, 1, 21, 3, 0, 1, 0, 11, 3, 0, 9, 4, 1, 7, 4, 5, 73, 22, 2, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_7[] = { "if", "==", "step", "*", "+", "-" };
+
+// \ {acc}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        blisp_push(lval_copy(code->consts[0]));
+    case 7:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 10);
+    case 10:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        blisp_push(lval_copy(code->consts[1]));
+    case 18:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 21);
+    case 21:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 24);
+    case 24:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 26);
+    case 26:
+        blisp_push(lval_copy(code->consts[2]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 31);
+    case 31:
+        blisp_push(lval_copy(env->vals[0]));
+    case 33:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 36);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 36);
+    case 36:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 39);
+    case 39:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 42);
+    case 42:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 42);
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 44);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 20, 0, 1, 2, 2, 0, 0, 11, 3, 0, 9, 4, 1, 20, 2, 1, 0, 1, 11, 3, 0, 10, 5, 1, 2, 6, 0, 2, 10, 5, 1, 1, 0, 20, 1, 1, 11, 3, 0, 9, 4, 1, 7, 4, 8 };
+static char* const blisp_names_8[] = { "step", "x", "v", "*", "+", "-", "n" };
+
+// \ {}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        blisp_push(lval_copy(code->consts[0]));
+    case 7:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 10);
+    case 10:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        blisp_push(lval_copy(code->consts[1]));
+    case 18:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 21);
+    case 21:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 24);
+    case 24:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 26);
+    case 26:
+        blisp_push(lval_copy(code->consts[2]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 34);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 34);
+    case 34:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 36);
+    case 36:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 39);
+    case 39:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 42);
+    case 42:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 42);
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 44);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 20, 0, 1, 2, 2, 0, 0, 11, 3, 0, 9, 4, 1, 20, 2, 1, 0, 1, 11, 3, 0, 10, 5, 1, 2, 6, 0, 2, 10, 5, 1, 20, 7, 1, 2, 1, 11, 3, 0, 9, 4, 1, 7, 4, 8 };
+static char* const blisp_names_9[] = { "step", "x", "v", "*", "+", "-", "n", "acc" };
+
+// \ {fact n}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l33, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l45;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 23:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 26);
+    case 26:
+        BLISP_DO(lvm_do_call(env, 1), 28);
+    case 28:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 1), 31);
+    case 31:
+        goto l45;
+    case 33:
+    l33:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 36:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 39);
+    case 39:
+        blisp_push(lval_copy(code->consts[1]));
+    case 41:
+        blisp_push(lval_copy(code->consts[2]));
+    case 43:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 43);
+    case 45:
+    l45:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 45);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 3, 0, 33, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 0, 3, 5, 45, 21, 1, 0, 22, 1, 4, 10, 2, 1, 6, 1, 11, 3, 1, 5, 45, 22, 1, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_10[] = { "if", "==", "-", "*" };
+
+// \ {n}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l34, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l46;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 22);
+        blisp_push(lval_copy(env->vals[0]));
+    case 22:
+        blisp_push(lval_copy(code->consts[4]));
+    case 24:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 27);
+    case 27:
+        BLISP_DO(lvm_do_call(env, 1), 29);
+    case 29:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 1), 32);
+    case 32:
+        goto l46;
+    case 34:
+    l34:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 37:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 40);
+    case 40:
+        blisp_push(lval_copy(code->consts[1]));
+    case 42:
+        blisp_push(lval_copy(code->consts[2]));
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 44);
+    case 46:
+    l46:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 46);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 3, 0, 34, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 0, 3, 5, 46, 1, 0, 19, 2, 0, 0, 4, 10, 3, 1, 6, 1, 11, 4, 1, 5, 46, 22, 0, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_11[] = { "if", "==", "fact", "-", "*" };
+
+// \ {collect n acc}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l41, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l53;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+    case 28:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 31:
+        blisp_push(lval_copy(code->consts[5]));
+        BLISP_DO(lvm_do_call(env, 3), 34);
+    case 34:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 37);
+    case 39:
+        goto l53;
+    case 41:
+    l41:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 44:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 47);
+    case 47:
+        blisp_push(lval_copy(code->consts[1]));
+    case 49:
+        blisp_push(lval_copy(code->consts[2]));
+    case 51:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 51);
+    case 53:
+    l53:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 53);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 3, 0, 41, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 53, 21, 0, 1, 0, 3, 10, 2, 1, 20, 3, 4, 22, 1, 4, 24, 5, 3, 23, 2, 2, 7, 2, 5, 53, 22, 1, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_12[] = { "if", "==", "-", "join", "list" };
+
+// \ {n acc}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l41, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l53;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 28);
+    case 28:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 31:
+        blisp_push(lval_copy(code->consts[5]));
+        BLISP_DO(lvm_do_call(env, 3), 34);
+    case 34:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 37);
+    case 39:
+        goto l53;
+    case 41:
+    l41:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 44:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 47);
+    case 47:
+        blisp_push(lval_copy(code->consts[1]));
+    case 49:
+        blisp_push(lval_copy(code->consts[2]));
+    case 51:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 51);
+    case 53:
+    l53:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 53);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 3, 0, 41, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 53, 19, 2, 0, 0, 3, 10, 3, 1, 20, 4, 5, 22, 0, 4, 24, 5, 3, 23, 1, 2, 7, 2, 5, 53, 22, 0, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_13[] = { "if", "==", "collect", "-", "join", "list" };
+
+// \ {acc}
+static int blisp_code_14(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+    case 15:
+        blisp_push(lval_copy(code->consts[2]));
+        BLISP_DO(lvm_do_call(env, 3), 18);
+    case 18:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 21);
+    case 21:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 21);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 23);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_14[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 2, 1, 0, 1, 24, 2, 3, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_14[] = { "collect", "n", "-", "join", "list" };
+
+// \ {}
+static int blisp_code_15(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+    case 15:
+        blisp_push(lval_copy(code->consts[2]));
+        BLISP_DO(lvm_do_call(env, 3), 18);
+    case 18:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 2), 22);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 22);
+    case 24:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 24);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_15[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 2, 1, 0, 1, 24, 2, 3, 2, 5, 6, 2, 7, 2, 8 };
+static char* const blisp_names_15[] = { "collect", "n", "-", "join", "list", "acc" };
+
+// \ {scale k x}
+static int blisp_code_16(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 3:
+        BLISP_DO(lvm_do_typed[2](env, code->names[0], 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_16[] = { 21, 1, 2, 11, 0, 1, 8 };
+static char* const blisp_names_16[] = { "*" };
+
+// \ {k x}
+static int blisp_code_17(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        BLISP_DO(lvm_do_typed[2](env, code->names[0], 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_17[] = { 21, 0, 1, 11, 0, 1, 8 };
+static char* const blisp_names_17[] = { "*" };
+
+// \ {safe-div a b}
+static int blisp_code_18(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l29, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 15);
+    case 15:
+        blisp_push(lval_copy(code->consts[3]));
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        goto l41;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 24:
+        BLISP_DO(lvm_do_typed[3](env, code->names[3], 1), 27);
+    case 27:
+        goto l41;
+    case 29:
+    l29:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 32:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 35);
+    case 35:
+        blisp_push(lval_copy(code->consts[1]));
+    case 37:
+        blisp_push(lval_copy(code->consts[2]));
+    case 39:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 39);
+    case 41:
+    l41:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 41);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_18[] = { 3, 0, 29, 22, 2, 0, 17, 1, 1, 4, 1, 2, 21, 2, 2, 0, 3, 7, 1, 5, 41, 21, 1, 2, 12, 3, 1, 5, 41, 22, 2, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_18[] = { "if", "==", "error", "/" };
+
+// \ {a b}
+static int blisp_code_19(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l29, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 15);
+    case 15:
+        blisp_push(lval_copy(code->consts[3]));
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        goto l41;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 24:
+        BLISP_DO(lvm_do_typed[3](env, code->names[3], 1), 27);
+    case 27:
+        goto l41;
+    case 29:
+    l29:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 32:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 35);
+    case 35:
+        blisp_push(lval_copy(code->consts[1]));
+    case 37:
+        blisp_push(lval_copy(code->consts[2]));
+    case 39:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 39);
+    case 41:
+    l41:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 41);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_19[] = { 3, 0, 29, 22, 1, 0, 17, 1, 1, 4, 1, 2, 21, 2, 2, 0, 3, 7, 1, 5, 41, 21, 0, 1, 12, 3, 1, 5, 41, 22, 1, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_19[] = { "if", "==", "error", "/" };
+
+// \ {scaled x}
+static int blisp_code_20(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 8);
+    case 8:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 11);
+    case 11:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 11);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_20[] = { 19, 0, 1, 24, 0, 2, 2, 1, 9, 2, 1, 8 };
+static char* const blisp_names_20[] = { "scale", "offset", "+" };
+
+// \ {x}
+static int blisp_code_21(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 8);
+    case 8:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 11);
+    case 11:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 11);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_21[] = { 19, 0, 0, 24, 0, 2, 2, 1, 9, 2, 1, 8 };
+static char* const blisp_names_21[] = { "scale", "offset", "+" };
+
+// \ {tally n & xs}
+static int blisp_code_22(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l36, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l48;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 30);
+        blisp_push(lval_copy(env->vals[2]));
+    case 30:
+        BLISP_DO(lvm_do_call(env, 1), 32);
+    case 32:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 32);
+    case 34:
+        goto l48;
+    case 36:
+    l36:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 39:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 42);
+    case 42:
+        blisp_push(lval_copy(code->consts[1]));
+    case 44:
+        blisp_push(lval_copy(code->consts[2]));
+    case 46:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 46);
+    case 48:
+    l48:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 48);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_22[] = { 3, 0, 36, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 48, 21, 0, 1, 0, 3, 10, 2, 1, 1, 1, 19, 3, 2, 6, 1, 7, 3, 5, 48, 22, 1, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_22[] = { "if", "==", "-", "len" };
+
+// \ {n & xs}
+static int blisp_code_23(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l36, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l48;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[0]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 30);
+        blisp_push(lval_copy(env->vals[1]));
+    case 30:
+        BLISP_DO(lvm_do_call(env, 1), 32);
+    case 32:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 32);
+    case 34:
+        goto l48;
+    case 36:
+    l36:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 39:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 42);
+    case 42:
+        blisp_push(lval_copy(code->consts[1]));
+    case 44:
+        blisp_push(lval_copy(code->consts[2]));
+    case 46:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 46);
+    case 48:
+    l48:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 48);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_23[] = { 3, 0, 36, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 48, 19, 2, 0, 0, 3, 10, 3, 1, 1, 0, 19, 4, 1, 6, 1, 7, 3, 5, 48, 22, 0, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_23[] = { "if", "==", "tally", "-", "len" };
+
+// \ {xs}
+static int blisp_code_24(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+    case 11:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 14);
+    case 16:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 16);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_24[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 1, 3, 23, 0, 1, 7, 3, 8 };
+static char* const blisp_names_24[] = { "tally", "n", "-", "len" };
+
+// \ {}
+static int blisp_code_25(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 13);
+    case 13:
+        BLISP_DO(lvm_do_call(env, 1), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_25[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 1, 3, 2, 4, 6, 1, 7, 3, 8 };
+static char* const blisp_names_25[] = { "tally", "n", "-", "len", "xs" };
+
+// \ {xs ys}
+static int blisp_code_26(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_26[] = { 1, 0, 8 };
+static char* const blisp_names_26[] = { NULL };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("fib"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("n"), lval_int(INT64_C(2))), blisp_list(lval_qexpr(), 1, lval_sym("n")), blisp_list(lval_qexpr(), 3, lval_sym("+"), blisp_list(lval_sexpr(), 2, lval_sym("fib"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1)))), blisp_list(lval_sexpr(), 2, lval_sym("fib"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(2))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 5, lval_sym("step"), lval_sym("x"), lval_sym("v"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 5, lval_sym("step"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("x"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("v"), lval_num(0x1.0624dd2f1a9fcp-10))), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("v"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("x"), lval_num(0x1.0624dd2f1a9fcp-10))), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("x"), lval_sym("x")))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("fact"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(1))), blisp_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("n"), blisp_list(lval_sexpr(), 2, lval_sym("fact"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("collect"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("collect"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_sexpr(), 4, lval_sym("list"), lval_sym("n"), lval_str("x"), blisp_list(lval_qexpr(), 1, lval_sym("q"))), lval_sym("acc"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("scale"), lval_sym("k"), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("k"), lval_sym("x"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("safe-div"), lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("b"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 2, lval_sym("error"), lval_str("divide by zero")), blisp_list(lval_qexpr(), 3, lval_sym("/"), lval_sym("a"), lval_sym("b")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("scaled"), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("+"), blisp_list(lval_sexpr(), 3, lval_sym("scale"), lval_sym("x"), lval_int(INT64_C(2))), lval_sym("offset"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("tally"), lval_sym("n"), lval_sym("&"), lval_sym("xs")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_qexpr(), 4, lval_sym("tally"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), lval_sym("n"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("xs"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("offset")), lval_int(INT64_C(100))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("before")), blisp_list(lval_sexpr(), 8, lval_sym("list"), blisp_list(lval_sexpr(), 2, lval_sym("fib"), lval_int(INT64_C(20))), blisp_list(lval_sexpr(), 5, lval_sym("step"), lval_num(0x1p+0), lval_num(0x0p+0), lval_int(INT64_C(10000)), lval_num(0x0p+0)), blisp_list(lval_sexpr(), 2, lval_sym("fact"), lval_int(INT64_C(30))), blisp_list(lval_sexpr(), 3, lval_sym("collect"), lval_int(INT64_C(3)), lval_qexpr()), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(3))), lval_int(INT64_C(7))), blisp_list(lval_sexpr(), 2, lval_sym("scaled"), lval_int(INT64_C(5))), blisp_list(lval_sexpr(), 2, lval_sym("tally"), lval_int(INT64_C(5))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("before")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("compile"), lval_sym("fib")), blisp_list(lval_sexpr(), 2, lval_sym("compile"), lval_sym("step")), blisp_list(lval_sexpr(), 2, lval_sym("compile"), lval_sym("fact")), blisp_list(lval_sexpr(), 2, lval_sym("compile"), lval_sym("collect")), blisp_list(lval_sexpr(), 2, lval_sym("compile"), lval_sym("scaled"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("compile"), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(3)))), blisp_list(lval_sexpr(), 2, lval_sym("compile"), lval_sym("safe-div")), blisp_list(lval_sexpr(), 2, lval_sym("compile"), lval_sym("tally"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("after")), blisp_list(lval_sexpr(), 8, lval_sym("list"), blisp_list(lval_sexpr(), 2, lval_sym("fib"), lval_int(INT64_C(20))), blisp_list(lval_sexpr(), 5, lval_sym("step"), lval_num(0x1p+0), lval_num(0x0p+0), lval_int(INT64_C(10000)), lval_num(0x0p+0)), blisp_list(lval_sexpr(), 2, lval_sym("fact"), lval_int(INT64_C(30))), blisp_list(lval_sexpr(), 3, lval_sym("collect"), lval_int(INT64_C(3)), lval_qexpr()), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(3))), lval_int(INT64_C(7))), blisp_list(lval_sexpr(), 2, lval_sym("scaled"), lval_int(INT64_C(5))), blisp_list(lval_sexpr(), 2, lval_sym("tally"), lval_int(INT64_C(5))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("after")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("before"), lval_sym("after")), blisp_list(lval_sexpr(), 3, lval_sym("safe-div"), lval_int(INT64_C(7)), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("safe-div"), lval_int(INT64_C(1)), lval_int(INT64_C(0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("offset")), lval_int(INT64_C(1))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("scaled"), lval_int(INT64_C(5)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("compile"), lval_sym("+")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("compile"), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 3, lval_sym("&"), lval_sym("xs"), lval_sym("ys")), blisp_list(lval_qexpr(), 1, lval_sym("xs")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("compile"), lval_int(INT64_C(1))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 55, blisp_names_2, 4, blisp_code_2);
+    lvm_register(blisp_ops_3, 55, blisp_names_3, 5, blisp_code_3);
+    lvm_register(blisp_ops_4, 24, blisp_names_4, 3, blisp_code_4);
+    lvm_register(blisp_ops_5, 24, blisp_names_5, 4, blisp_code_5);
+    lvm_register(blisp_ops_6, 74, blisp_names_6, 5, blisp_code_6);
+    lvm_register(blisp_ops_7, 74, blisp_names_7, 6, blisp_code_7);
+    lvm_register(blisp_ops_8, 45, blisp_names_8, 7, blisp_code_8);
+    lvm_register(blisp_ops_9, 45, blisp_names_9, 8, blisp_code_9);
+    lvm_register(blisp_ops_10, 46, blisp_names_10, 4, blisp_code_10);
+    lvm_register(blisp_ops_11, 47, blisp_names_11, 5, blisp_code_11);
+    lvm_register(blisp_ops_12, 54, blisp_names_12, 5, blisp_code_12);
+    lvm_register(blisp_ops_13, 54, blisp_names_13, 6, blisp_code_13);
+    lvm_register(blisp_ops_14, 24, blisp_names_14, 5, blisp_code_14);
+    lvm_register(blisp_ops_15, 25, blisp_names_15, 6, blisp_code_15);
+    lvm_register(blisp_ops_16, 7, blisp_names_16, 1, blisp_code_16);
+    lvm_register(blisp_ops_17, 7, blisp_names_17, 1, blisp_code_17);
+    lvm_register(blisp_ops_18, 42, blisp_names_18, 4, blisp_code_18);
+    lvm_register(blisp_ops_19, 42, blisp_names_19, 4, blisp_code_19);
+    lvm_register(blisp_ops_20, 12, blisp_names_20, 3, blisp_code_20);
+    lvm_register(blisp_ops_21, 12, blisp_names_21, 3, blisp_code_21);
+    lvm_register(blisp_ops_22, 49, blisp_names_22, 4, blisp_code_22);
+    lvm_register(blisp_ops_23, 49, blisp_names_23, 5, blisp_code_23);
+    lvm_register(blisp_ops_24, 17, blisp_names_24, 4, blisp_code_24);
+    lvm_register(blisp_ops_25, 18, blisp_names_25, 5, blisp_code_25);
+    lvm_register(blisp_ops_26, 3, blisp_names_26, 0, blisp_code_26);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,367 @@
+// Generated by blisp --emit-c from test/dispatch.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {names d}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 2), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 11);
+        blisp_push(lval_copy(env->vals[1]));
+    case 11:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 17);
+        blisp_push(lval_copy(env->vals[1]));
+    case 17:
+        blisp_push(lval_copy(code->consts[2]));
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 23);
+        blisp_push(lval_copy(env->vals[1]));
+    case 23:
+        blisp_push(lval_copy(code->consts[3]));
+        BLISP_DO(lvm_do_call(env, 2), 26);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 26);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 28);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 20, 0, 1, 22, 1, 0, 6, 2, 19, 1, 1, 24, 1, 2, 19, 1, 1, 24, 2, 2, 19, 1, 1, 24, 3, 2, 7, 4, 8 };
+static char* const blisp_names_2[] = { "list", "nth" };
+
+// \ {d}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 2), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 11);
+        blisp_push(lval_copy(env->vals[0]));
+    case 11:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 17);
+        blisp_push(lval_copy(env->vals[0]));
+    case 17:
+        blisp_push(lval_copy(code->consts[2]));
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 23);
+        blisp_push(lval_copy(env->vals[0]));
+    case 23:
+        blisp_push(lval_copy(code->consts[3]));
+        BLISP_DO(lvm_do_call(env, 2), 26);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 26);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 28);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 20, 0, 1, 22, 0, 0, 6, 2, 19, 1, 0, 24, 1, 2, 19, 1, 0, 24, 2, 2, 19, 1, 0, 24, 3, 2, 7, 4, 8 };
+static char* const blisp_names_3[] = { "list", "nth" };
+
+// \ {timed d}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        blisp_push(lval_copy(env->vals[1]));
+    case 9:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 12);
+    case 12:
+        blisp_push(lval_copy(code->consts[1]));
+    case 14:
+        BLISP_DO(lvm_do_typed[7](env, code->names[3], 1), 17);
+    case 17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[2]));
+        BLISP_DO(lvm_do_call(env, 2), 23);
+    case 23:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 26);
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        blisp_push(lval_copy(code->consts[3]));
+        BLISP_DO(lvm_do_call(env, 2), 29);
+    case 29:
+        BLISP_DO(lvm_do_typed[7](env, code->names[3], 1), 32);
+    case 32:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 32);
+    case 34:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 34);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 20, 0, 1, 23, 1, 1, 19, 2, 1, 24, 0, 2, 0, 1, 16, 3, 1, 19, 2, 1, 24, 2, 2, 19, 2, 1, 24, 3, 2, 16, 3, 1, 7, 3, 8 };
+static char* const blisp_names_4[] = { "list", "len", "nth", ">=" };
+
+// \ {d}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        blisp_push(lval_copy(env->vals[0]));
+    case 9:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 12);
+    case 12:
+        blisp_push(lval_copy(code->consts[1]));
+    case 14:
+        BLISP_DO(lvm_do_typed[7](env, code->names[3], 1), 17);
+    case 17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[2]));
+        BLISP_DO(lvm_do_call(env, 2), 23);
+    case 23:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 26);
+        blisp_push(lval_copy(env->vals[0]));
+    case 26:
+        blisp_push(lval_copy(code->consts[3]));
+        BLISP_DO(lvm_do_call(env, 2), 29);
+    case 29:
+        BLISP_DO(lvm_do_typed[7](env, code->names[3], 1), 32);
+    case 32:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 32);
+    case 34:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 34);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 23, 0, 1, 19, 2, 0, 24, 0, 2, 0, 1, 16, 3, 1, 19, 2, 0, 24, 2, 2, 19, 2, 0, 24, 3, 2, 16, 3, 1, 7, 3, 8 };
+static char* const blisp_names_5[] = { "list", "len", "nth", ">=" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("names"), lval_sym("d")), blisp_list(lval_qexpr(), 5, lval_sym("list"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("d"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("d"), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("d"), lval_int(INT64_C(4))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("d"), lval_int(INT64_C(6))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("timed"), lval_sym("d")), blisp_list(lval_qexpr(), 4, lval_sym("list"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("d")), blisp_list(lval_sexpr(), 3, lval_sym(">="), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("d"), lval_int(INT64_C(3))), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym(">="), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("d"), lval_int(INT64_C(7))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("d"), lval_int(INT64_C(5)))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("names"), blisp_list(lval_sexpr(), 2, lval_sym("dispatch"), lval_int(INT64_C(0)))), blisp_list(lval_sexpr(), 2, lval_sym("timed"), blisp_list(lval_sexpr(), 2, lval_sym("dispatch"), lval_int(INT64_C(0)))), blisp_list(lval_sexpr(), 2, lval_sym("timed"), blisp_list(lval_sexpr(), 2, lval_sym("dispatch"), lval_int(INT64_C(100000))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("dispatch"), lval_int(INT64_C(0))), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("dispatch"), lval_int(INT64_C(1))), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("dispatch"), lval_int(INT64_C(1000))), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("dispatch"), lval_int(INT64_C(100000))), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("dispatch"), lval_int(INT64_C(-1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("dispatch"), lval_num(0x1.8p+0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("dispatch"), lval_int(INT64_C(1)), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 29, blisp_names_2, 2, blisp_code_2);
+    lvm_register(blisp_ops_3, 29, blisp_names_3, 2, blisp_code_3);
+    lvm_register(blisp_ops_4, 35, blisp_names_4, 4, blisp_code_4);
+    lvm_register(blisp_ops_5, 35, blisp_names_5, 4, blisp_code_5);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,582 @@
+// Generated by blisp --emit-c from test/env.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {sum-squares n acc}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l40, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l52;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 28:
+        blisp_push(lval_copy(env->vals[1]));
+    case 30:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 33);
+    case 33:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 36);
+    case 36:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 36);
+    case 38:
+        goto l52;
+    case 40:
+    l40:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 43:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 46);
+    case 46:
+        blisp_push(lval_copy(code->consts[1]));
+    case 48:
+        blisp_push(lval_copy(code->consts[2]));
+    case 50:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 50);
+    case 52:
+    l52:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 52);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 3, 0, 40, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 52, 21, 0, 1, 0, 3, 9, 2, 1, 21, 2, 1, 1, 1, 11, 3, 0, 9, 2, 1, 7, 2, 5, 52, 22, 1, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_2[] = { "if", "==", "+", "*" };
+
+// \ {n acc}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l40, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l52;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 28:
+        blisp_push(lval_copy(env->vals[0]));
+    case 30:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 0), 33);
+    case 33:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 36);
+    case 36:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 36);
+    case 38:
+        goto l52;
+    case 40:
+    l40:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 43:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 46);
+    case 46:
+        blisp_push(lval_copy(code->consts[1]));
+    case 48:
+        blisp_push(lval_copy(code->consts[2]));
+    case 50:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 50);
+    case 52:
+    l52:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 52);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 40, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 52, 19, 2, 0, 0, 3, 9, 3, 1, 21, 1, 0, 1, 0, 11, 4, 0, 9, 3, 1, 7, 2, 5, 52, 22, 0, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "==", "sum-squares", "+", "*" };
+
+// \ {acc}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 16);
+    case 16:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 19);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 19);
+    case 21:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 21);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 20, 0, 1, 0, 0, 9, 2, 1, 1, 0, 20, 1, 1, 11, 3, 0, 9, 2, 1, 7, 2, 8 };
+static char* const blisp_names_4[] = { "sum-squares", "n", "+", "*" };
+
+// \ {}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 0), 16);
+    case 16:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 19);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 19);
+    case 21:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 21);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 0, 0, 9, 2, 1, 20, 3, 1, 2, 1, 11, 4, 0, 9, 2, 1, 7, 2, 8 };
+static char* const blisp_names_5[] = { "sum-squares", "n", "+", "acc", "*" };
+
+// \ {many a b c d e f g h i j k l}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        blisp_push(lval_copy(env->vals[11]));
+        blisp_push(lval_copy(code->consts[1]));
+    case 8:
+        BLISP_DO(lvm_do_typed[2](env, code->names[2], 1), 11);
+    case 11:
+        BLISP_DO(lvm_do_call(env, 2), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 16);
+        blisp_push(lval_copy(env->vals[1]));
+    case 16:
+        blisp_push(lval_copy(env->vals[12]));
+        blisp_push(lval_copy(env->vals[11]));
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 22);
+        blisp_push(lval_copy(env->vals[1]));
+    case 22:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 25:
+        blisp_push(lval_copy(env->vals[4]));
+        blisp_push(lval_copy(env->vals[5]));
+    case 28:
+        blisp_push(lval_copy(env->vals[6]));
+        blisp_push(lval_copy(env->vals[7]));
+    case 31:
+        blisp_push(lval_copy(env->vals[8]));
+        blisp_push(lval_copy(env->vals[9]));
+    case 34:
+        blisp_push(lval_copy(env->vals[10]));
+        blisp_push(lval_copy(env->vals[11]));
+    case 37:
+        blisp_push(lval_copy(env->vals[12]));
+        BLISP_DO(lvm_do_call(env, 12), 40);
+    case 40:
+        BLISP_DO(lvm_do_call(env, 4), 42);
+    case 42:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 42);
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 44);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 20, 0, 1, 0, 0, 22, 11, 1, 11, 2, 1, 6, 2, 19, 3, 1, 21, 12, 11, 19, 4, 1, 21, 2, 3, 21, 4, 5, 21, 6, 7, 21, 8, 9, 21, 10, 11, 23, 12, 12, 6, 4, 7, 2, 8 };
+static char* const blisp_names_6[] = { "do", "=", "*", "list", "+" };
+
+// \ {a b c d e f g h i j k l}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        blisp_push(lval_copy(env->vals[10]));
+        blisp_push(lval_copy(code->consts[1]));
+    case 8:
+        BLISP_DO(lvm_do_typed[2](env, code->names[2], 1), 11);
+    case 11:
+        BLISP_DO(lvm_do_call(env, 2), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 16);
+        blisp_push(lval_copy(env->vals[0]));
+    case 16:
+        blisp_push(lval_copy(env->vals[11]));
+        blisp_push(lval_copy(env->vals[10]));
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 22);
+        blisp_push(lval_copy(env->vals[0]));
+    case 22:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 25:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(env->vals[4]));
+    case 28:
+        blisp_push(lval_copy(env->vals[5]));
+        blisp_push(lval_copy(env->vals[6]));
+    case 31:
+        blisp_push(lval_copy(env->vals[7]));
+        blisp_push(lval_copy(env->vals[8]));
+    case 34:
+        blisp_push(lval_copy(env->vals[9]));
+        blisp_push(lval_copy(env->vals[10]));
+    case 37:
+        blisp_push(lval_copy(env->vals[11]));
+        BLISP_DO(lvm_do_call(env, 12), 40);
+    case 40:
+        BLISP_DO(lvm_do_call(env, 4), 42);
+    case 42:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 42);
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 44);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 20, 0, 1, 0, 0, 22, 10, 1, 11, 2, 1, 6, 2, 19, 3, 0, 21, 11, 10, 19, 4, 0, 21, 1, 2, 21, 3, 4, 21, 5, 6, 21, 7, 8, 21, 9, 10, 23, 11, 12, 6, 4, 7, 2, 8 };
+static char* const blisp_names_7[] = { "do", "=", "*", "list", "+" };
+
+// \ {do x y}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[2]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 1, 2, 8 };
+static char* const blisp_names_8[] = { NULL };
+
+// \ {x y}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 1, 1, 8 };
+static char* const blisp_names_9[] = { NULL };
+
+// \ {alpha}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 2, 0, 8 };
+static char* const blisp_names_10[] = { "beta" };
+
+// \ {alpha}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 2, 0, 8 };
+static char* const blisp_names_11[] = { "alphabet" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(blisp_list(lval_sexpr(), 64, lval_sym("def"), blisp_list(lval_qexpr(), 64, lval_sym("v0"), lval_sym("v1"), lval_sym("v2"), lval_sym("v3"), lval_sym("v4"), lval_sym("v5"), lval_sym("v6"), lval_sym("v7"), lval_sym("v8"), lval_sym("v9"), lval_sym("v10"), lval_sym("v11"), lval_sym("v12"), lval_sym("v13"), lval_sym("v14"), lval_sym("v15"), lval_sym("v16"), lval_sym("v17"), lval_sym("v18"), lval_sym("v19"), lval_sym("v20"), lval_sym("v21"), lval_sym("v22"), lval_sym("v23"), lval_sym("v24"), lval_sym("v25"), lval_sym("v26"), lval_sym("v27"), lval_sym("v28"), lval_sym("v29"), lval_sym("v30"), lval_sym("v31"), lval_sym("v32"), lval_sym("v33"), lval_sym("v34"), lval_sym("v35"), lval_sym("v36"), lval_sym("v37"), lval_sym("v38"), lval_sym("v39"), lval_sym("v40"), lval_sym("v41"), lval_sym("v42"), lval_sym("v43"), lval_sym("v44"), lval_sym("v45"), lval_sym("v46"), lval_sym("v47"), lval_sym("v48"), lval_sym("v49"), lval_sym("v50"), lval_sym("v51"), lval_sym("v52"), lval_sym("v53"), lval_sym("v54"), lval_sym("v55"), lval_sym("v56"), lval_sym("v57"), lval_sym("v58"), lval_sym("v59"), lval_sym("v60"), lval_sym("v61"), lval_sym("v62"), lval_sym("v63")), lval_int(INT64_C(0)), lval_int(INT64_C(1)), lval_int(INT64_C(4)), lval_int(INT64_C(9)), lval_int(INT64_C(16)), lval_int(INT64_C(25)), lval_int(INT64_C(36)), lval_int(INT64_C(49)), lval_int(INT64_C(64)), lval_int(INT64_C(81)), lval_int(INT64_C(100)), lval_int(INT64_C(121)), lval_int(INT64_C(144)), lval_int(INT64_C(169)), lval_int(INT64_C(196)), lval_int(INT64_C(225)), lval_int(INT64_C(256)), lval_int(INT64_C(289)), lval_int(INT64_C(324)), lval_int(INT64_C(361)), lval_int(INT64_C(400)), lval_int(INT64_C(441)), lval_int(INT64_C(484)), lval_int(INT64_C(529)), lval_int(INT64_C(576)), lval_int(INT64_C(625)), lval_int(INT64_C(676)), lval_int(INT64_C(729)), lval_int(INT64_C(784)), lval_int(INT64_C(841)), lval_int(INT64_C(900)), lval_int(INT64_C(961)), lval_int(INT64_C(1024)), lval_int(INT64_C(1089)), lval_int(INT64_C(1156)), lval_int(INT64_C(1225)), lval_int(INT64_C(1296)), lval_int(INT64_C(1369)), lval_int(INT64_C(1444)), lval_int(INT64_C(1521)), lval_int(INT64_C(1600)), lval_int(INT64_C(1681)), lval_int(INT64_C(1764)), lval_int(INT64_C(1849)), lval_int(INT64_C(1936)), lval_int(INT64_C(2025)), lval_int(INT64_C(2116)), lval_int(INT64_C(2209)), lval_int(INT64_C(2304)), lval_int(INT64_C(2401)), lval_int(INT64_C(2500)), lval_int(INT64_C(2601)), lval_int(INT64_C(2704)), lval_int(INT64_C(2809)), lval_int(INT64_C(2916)), lval_int(INT64_C(3025)), lval_int(INT64_C(3136)), lval_int(INT64_C(3249)), lval_int(INT64_C(3364)), lval_int(INT64_C(3481)), lval_int(INT64_C(3600)), lval_int(INT64_C(3721))), 2, lval_int(INT64_C(3844)), lval_int(INT64_C(3969))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), lval_sym("v0"), lval_sym("v1"), lval_sym("v31"), lval_sym("v63"), blisp_list(lval_sexpr(), 4, lval_sym("+"), lval_sym("v7"), lval_sym("v8"), lval_sym("v9"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("count")), lval_int(INT64_C(0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("count")), blisp_list(lval_sexpr(), 2, lval_sym("len"), blisp_list(lval_sexpr(), 2, lval_sym("values"), lval_int(INT64_C(-1))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("def"), blisp_list(lval_qexpr(), 2, lval_sym("v31"), lval_sym("v32")), lval_str("thirty-one"), lval_str("thirty-two")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), lval_sym("v31"), lval_sym("v32"), lval_sym("v33"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("count"), blisp_list(lval_sexpr(), 2, lval_sym("len"), blisp_list(lval_sexpr(), 2, lval_sym("values"), lval_int(INT64_C(-1)))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("sum-squares"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(64))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("sum-squares"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("n"), lval_sym("n")))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("sum-squares"), lval_int(INT64_C(0)), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("v0"), lval_sym("v63")), lval_sym("v62")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 13, lval_sym("many"), lval_sym("a"), lval_sym("b"), lval_sym("c"), lval_sym("d"), lval_sym("e"), lval_sym("f"), lval_sym("g"), lval_sym("h"), lval_sym("i"), lval_sym("j"), lval_sym("k"), lval_sym("l")), blisp_list(lval_qexpr(), 3, lval_sym("do"), blisp_list(lval_sexpr(), 3, lval_sym("="), blisp_list(lval_qexpr(), 1, lval_sym("k")), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("k"), lval_int(INT64_C(100)))), blisp_list(lval_sexpr(), 5, lval_sym("list"), lval_sym("a"), lval_sym("l"), lval_sym("k"), blisp_list(lval_sexpr(), 13, lval_sym("+"), lval_sym("a"), lval_sym("b"), lval_sym("c"), lval_sym("d"), lval_sym("e"), lval_sym("f"), lval_sym("g"), lval_sym("h"), lval_sym("i"), lval_sym("j"), lval_sym("k"), lval_sym("l"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("do"), lval_sym("x"), lval_sym("y")), blisp_list(lval_qexpr(), 1, lval_sym("y"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("k")), lval_str("global")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 13, lval_sym("many"), lval_int(INT64_C(1)), lval_int(INT64_C(2)), lval_int(INT64_C(3)), lval_int(INT64_C(4)), lval_int(INT64_C(5)), lval_int(INT64_C(6)), lval_int(INT64_C(7)), lval_int(INT64_C(8)), lval_int(INT64_C(9)), lval_int(INT64_C(10)), lval_int(INT64_C(11)), lval_int(INT64_C(12))), lval_sym("k")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_qexpr(), 2, lval_sym("alpha"), lval_sym("beta")), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_qexpr(), 1, lval_sym("alpha")), blisp_list(lval_qexpr(), 1, lval_sym("beta")))), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_qexpr(), 1, lval_sym("alpha")), blisp_list(lval_qexpr(), 1, lval_sym("alphabet"))), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 2, lval_sym("head"), blisp_list(lval_qexpr(), 1, lval_sym("v5"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("unbound")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 53, blisp_names_2, 4, blisp_code_2);
+    lvm_register(blisp_ops_3, 53, blisp_names_3, 5, blisp_code_3);
+    lvm_register(blisp_ops_4, 22, blisp_names_4, 4, blisp_code_4);
+    lvm_register(blisp_ops_5, 22, blisp_names_5, 5, blisp_code_5);
+    lvm_register(blisp_ops_6, 45, blisp_names_6, 5, blisp_code_6);
+    lvm_register(blisp_ops_7, 45, blisp_names_7, 5, blisp_code_7);
+    lvm_register(blisp_ops_8, 3, blisp_names_8, 0, blisp_code_8);
+    lvm_register(blisp_ops_9, 3, blisp_names_9, 0, blisp_code_9);
+    lvm_register(blisp_ops_10, 3, blisp_names_10, 1, blisp_code_10);
+    lvm_register(blisp_ops_11, 3, blisp_names_11, 1, blisp_code_11);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
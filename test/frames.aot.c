@@ -0,0 +1,877 @@
+// Generated by blisp --emit-c from test/frames.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {do a b}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[2]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 1, 2, 8 };
+static char* const blisp_names_2[] = { NULL };
+
+// \ {a b}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 1, 1, 8 };
+static char* const blisp_names_3[] = { NULL };
+
+// \ {add x y}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 3:
+        BLISP_DO(lvm_do_typed[0](env, code->names[0], 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 21, 1, 2, 9, 0, 1, 8 };
+static char* const blisp_names_4[] = { "+" };
+
+// \ {x y}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        BLISP_DO(lvm_do_typed[0](env, code->names[0], 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 21, 0, 1, 9, 0, 1, 8 };
+static char* const blisp_names_5[] = { "+" };
+
+// \ {rest a & r}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+    case 5:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 5);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 19, 0, 1, 1, 2, 7, 2, 8 };
+static char* const blisp_names_6[] = { "list" };
+
+// \ {a & r}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+    case 5:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 5);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 19, 0, 0, 1, 1, 7, 2, 8 };
+static char* const blisp_names_7[] = { "list" };
+
+// \ {loop n acc}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l35, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l47;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+        blisp_push(lval_copy(env->vals[2]));
+    case 28:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 31);
+    case 31:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 31);
+    case 33:
+        goto l47;
+    case 35:
+    l35:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 38:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 41);
+    case 41:
+        blisp_push(lval_copy(code->consts[1]));
+    case 43:
+        blisp_push(lval_copy(code->consts[2]));
+    case 45:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 45);
+    case 47:
+    l47:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 47);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 3, 0, 35, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 47, 21, 0, 1, 0, 3, 10, 2, 1, 19, 3, 2, 23, 1, 2, 7, 2, 5, 47, 22, 1, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_8[] = { "if", "==", "-", "add" };
+
+// \ {n acc}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l35, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l47;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+        blisp_push(lval_copy(env->vals[1]));
+    case 28:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 31);
+    case 31:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 31);
+    case 33:
+        goto l47;
+    case 35:
+    l35:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 38:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 41);
+    case 41:
+        blisp_push(lval_copy(code->consts[1]));
+    case 43:
+        blisp_push(lval_copy(code->consts[2]));
+    case 45:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 45);
+    case 47:
+    l47:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 47);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 3, 0, 35, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 47, 19, 2, 0, 0, 3, 10, 3, 1, 19, 4, 1, 23, 0, 2, 7, 2, 5, 47, 22, 0, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_9[] = { "if", "==", "loop", "-", "add" };
+
+// \ {acc}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        blisp_push(lval_copy(env->vals[0]));
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 20, 0, 1, 0, 0, 10, 2, 1, 19, 3, 0, 2, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_10[] = { "loop", "n", "-", "add" };
+
+// \ {}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 2, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_11[] = { "loop", "n", "-", "add", "acc" };
+
+// \ {show _}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 5);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 20, 0, 1, 2, 2, 7, 2, 8 };
+static char* const blisp_names_12[] = { "list", "depth", "name" };
+
+// \ {inner depth}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        blisp_push(lval_copy(code->consts[0]));
+    case 4:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 4);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 2, 0, 0, 0, 7, 1, 8 };
+static char* const blisp_names_13[] = { "show" };
+
+// \ {outer depth name}
+static int blisp_code_14(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 9);
+    case 9:
+        BLISP_DO(lvm_do_call(env, 1), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 1), 16);
+    case 16:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 16);
+    case 18:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 18);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_14[] = { 20, 0, 1, 22, 1, 0, 9, 2, 1, 6, 1, 2, 3, 24, 1, 1, 7, 2, 8 };
+static char* const blisp_names_14[] = { "list", "inner", "+", "show" };
+
+// \ {depth name}
+static int blisp_code_15(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 9);
+    case 9:
+        BLISP_DO(lvm_do_call(env, 1), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 1), 16);
+    case 16:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 16);
+    case 18:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 18);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_15[] = { 20, 0, 1, 22, 0, 0, 9, 2, 1, 6, 1, 2, 3, 24, 1, 1, 7, 2, 8 };
+static char* const blisp_names_15[] = { "list", "inner", "+", "show" };
+
+// \ {down n}
+static int blisp_code_16(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l37, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l49;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 23);
+    case 23:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        blisp_push(lval_copy(code->consts[4]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[4], 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_call(env, 1), 33);
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        goto l49;
+    case 37:
+    l37:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 40:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 43);
+    case 43:
+        blisp_push(lval_copy(code->consts[1]));
+    case 45:
+        blisp_push(lval_copy(code->consts[2]));
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+    l49:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 49);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_16[] = { 3, 0, 37, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 0, 3, 5, 49, 20, 2, 3, 23, 1, 1, 21, 0, 1, 0, 4, 10, 4, 1, 6, 1, 7, 2, 5, 49, 22, 1, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_16[] = { "if", "==", "join", "list", "-" };
+
+// \ {n}
+static int blisp_code_17(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l37, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l49;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 23);
+    case 23:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 26);
+        blisp_push(lval_copy(env->vals[0]));
+    case 26:
+        blisp_push(lval_copy(code->consts[4]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_call(env, 1), 33);
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        goto l49;
+    case 37:
+    l37:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 40:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 43);
+    case 43:
+        blisp_push(lval_copy(code->consts[1]));
+    case 45:
+        blisp_push(lval_copy(code->consts[2]));
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+    l49:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 49);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_17[] = { 3, 0, 37, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 0, 3, 5, 49, 20, 2, 3, 23, 0, 1, 19, 4, 0, 0, 4, 10, 5, 1, 6, 1, 7, 2, 5, 49, 22, 0, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_17[] = { "if", "==", "join", "list", "down", "-" };
+
+// \ {assign x}
+static int blisp_code_18(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 10);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 10);
+    case 12:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 12);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_18[] = { 20, 0, 1, 0, 0, 23, 1, 2, 2, 2, 7, 2, 8 };
+static char* const blisp_names_18[] = { "do", "=", "t" };
+
+// \ {x}
+static int blisp_code_19(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 10);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 10);
+    case 12:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 12);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_19[] = { 20, 0, 1, 0, 0, 23, 0, 2, 2, 2, 7, 2, 8 };
+static char* const blisp_names_19[] = { "do", "=", "t" };
+
+// \ {keeps t}
+static int blisp_code_20(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        blisp_push(lval_copy(env->vals[1]));
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_20[] = { 20, 0, 1, 24, 0, 1, 1, 1, 7, 2, 8 };
+static char* const blisp_names_20[] = { "list", "assign" };
+
+// \ {t}
+static int blisp_code_21(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        blisp_push(lval_copy(env->vals[0]));
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_21[] = { 20, 0, 1, 24, 0, 1, 1, 0, 7, 2, 8 };
+static char* const blisp_names_21[] = { "list", "assign" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("do"), lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 1, lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("add"), lval_sym("x"), lval_sym("y")), blisp_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("x"), lval_sym("y"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("plus")), lval_sym("add")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("add"), lval_int(INT64_C(1)), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("plus"), lval_int(INT64_C(3)), lval_int(INT64_C(4))), lval_sym("add"), lval_sym("plus")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("rest"), lval_sym("a"), lval_sym("&"), lval_sym("r")), blisp_list(lval_qexpr(), 3, lval_sym("list"), lval_sym("a"), lval_sym("r"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("rest"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 4, lval_sym("rest"), lval_int(INT64_C(1)), lval_int(INT64_C(2)), lval_int(INT64_C(3))), lval_sym("rest")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("add"), lval_int(INT64_C(1)), lval_int(INT64_C(2)), lval_int(INT64_C(3)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("add"), lval_int(INT64_C(1)), lval_int(INT64_C(2))), lval_sym("add")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("loop"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("loop"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("add"), lval_sym("acc"), lval_sym("n"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("loop"), lval_int(INT64_C(2000)), lval_int(INT64_C(0))), lval_sym("add"), lval_sym("loop")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("show"), lval_sym("_")), blisp_list(lval_qexpr(), 3, lval_sym("list"), lval_sym("depth"), lval_sym("name"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("inner"), lval_sym("depth")), blisp_list(lval_qexpr(), 2, lval_sym("show"), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("outer"), lval_sym("depth"), lval_sym("name")), blisp_list(lval_qexpr(), 3, lval_sym("list"), blisp_list(lval_sexpr(), 2, lval_sym("inner"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("depth"), lval_int(INT64_C(1)))), blisp_list(lval_sexpr(), 2, lval_sym("show"), lval_int(INT64_C(0))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("outer"), lval_int(INT64_C(1)), lval_str("outer"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("down"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_qexpr()), blisp_list(lval_qexpr(), 3, lval_sym("join"), blisp_list(lval_sexpr(), 2, lval_sym("list"), lval_sym("n")), blisp_list(lval_sexpr(), 2, lval_sym("down"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("down"), lval_int(INT64_C(5)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("assign"), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("do"), blisp_list(lval_sexpr(), 3, lval_sym("="), blisp_list(lval_qexpr(), 1, lval_sym("t")), lval_sym("x")), lval_sym("t"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("keeps"), lval_sym("t")), blisp_list(lval_qexpr(), 3, lval_sym("list"), blisp_list(lval_sexpr(), 2, lval_sym("assign"), lval_int(INT64_C(7))), lval_sym("t"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("assign"), lval_int(INT64_C(5))), blisp_list(lval_sexpr(), 2, lval_sym("keeps"), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("t")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fs")), blisp_list(lval_sexpr(), 3, lval_sym("list"), lval_sym("add"), lval_sym("rest"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("fs")), blisp_list(lval_qexpr(), 2, lval_int(INT64_C(5)), lval_int(INT64_C(6))))), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("fs")), blisp_list(lval_qexpr(), 2, lval_int(INT64_C(8)), lval_int(INT64_C(9))))), lval_sym("fs")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 3, blisp_names_2, 0, blisp_code_2);
+    lvm_register(blisp_ops_3, 3, blisp_names_3, 0, blisp_code_3);
+    lvm_register(blisp_ops_4, 7, blisp_names_4, 1, blisp_code_4);
+    lvm_register(blisp_ops_5, 7, blisp_names_5, 1, blisp_code_5);
+    lvm_register(blisp_ops_6, 8, blisp_names_6, 1, blisp_code_6);
+    lvm_register(blisp_ops_7, 8, blisp_names_7, 1, blisp_code_7);
+    lvm_register(blisp_ops_8, 48, blisp_names_8, 4, blisp_code_8);
+    lvm_register(blisp_ops_9, 48, blisp_names_9, 5, blisp_code_9);
+    lvm_register(blisp_ops_10, 18, blisp_names_10, 4, blisp_code_10);
+    lvm_register(blisp_ops_11, 18, blisp_names_11, 5, blisp_code_11);
+    lvm_register(blisp_ops_12, 8, blisp_names_12, 3, blisp_code_12);
+    lvm_register(blisp_ops_13, 7, blisp_names_13, 1, blisp_code_13);
+    lvm_register(blisp_ops_14, 19, blisp_names_14, 4, blisp_code_14);
+    lvm_register(blisp_ops_15, 19, blisp_names_15, 4, blisp_code_15);
+    lvm_register(blisp_ops_16, 50, blisp_names_16, 5, blisp_code_16);
+    lvm_register(blisp_ops_17, 50, blisp_names_17, 6, blisp_code_17);
+    lvm_register(blisp_ops_18, 13, blisp_names_18, 3, blisp_code_18);
+    lvm_register(blisp_ops_19, 13, blisp_names_19, 3, blisp_code_19);
+    lvm_register(blisp_ops_20, 11, blisp_names_20, 2, blisp_code_20);
+    lvm_register(blisp_ops_21, 11, blisp_names_21, 2, blisp_code_21);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
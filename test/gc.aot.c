@@ -0,0 +1,1641 @@
+// Generated by blisp --emit-c from test/gc.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {live _}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        blisp_push(lval_copy(code->consts[1]));
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 20, 0, 1, 24, 0, 1, 0, 1, 7, 2, 8 };
+static char* const blisp_names_2[] = { "nth", "gc" };
+
+// \ {build n}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l37, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l49;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 23);
+    case 23:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        blisp_push(lval_copy(code->consts[4]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[4], 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_call(env, 1), 33);
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        goto l49;
+    case 37:
+    l37:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 40:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 43);
+    case 43:
+        blisp_push(lval_copy(code->consts[1]));
+    case 45:
+        blisp_push(lval_copy(code->consts[2]));
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+    l49:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 49);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 37, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 0, 3, 5, 49, 20, 2, 3, 23, 1, 1, 21, 0, 1, 0, 4, 10, 4, 1, 6, 1, 7, 2, 5, 49, 22, 1, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "==", "join", "list", "-" };
+
+// \ {n}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l37, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l49;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 23);
+    case 23:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 26);
+        blisp_push(lval_copy(env->vals[0]));
+    case 26:
+        blisp_push(lval_copy(code->consts[4]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_call(env, 1), 33);
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        goto l49;
+    case 37:
+    l37:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 40:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 43);
+    case 43:
+        blisp_push(lval_copy(code->consts[1]));
+    case 45:
+        blisp_push(lval_copy(code->consts[2]));
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+    l49:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 49);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 3, 0, 37, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 0, 3, 5, 49, 20, 2, 3, 23, 0, 1, 19, 4, 0, 0, 4, 10, 5, 1, 6, 1, 7, 2, 5, 49, 22, 0, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_4[] = { "if", "==", "join", "list", "build", "-" };
+
+// \ {loop n acc}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l45, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l57;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+        blisp_push(lval_copy(env->vals[2]));
+    case 28:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 31);
+        blisp_push(lval_copy(env->vals[1]));
+    case 31:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 34:
+        BLISP_DO(lvm_do_typed[2](env, code->names[5], 1), 37);
+    case 37:
+        BLISP_DO(lvm_do_call(env, 2), 39);
+    case 39:
+        BLISP_DO(lvm_do_call(env, 2), 41);
+    case 41:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 41);
+    case 43:
+        goto l57;
+    case 45:
+    l45:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 48:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 51);
+    case 51:
+        blisp_push(lval_copy(code->consts[1]));
+    case 53:
+        blisp_push(lval_copy(code->consts[2]));
+    case 55:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 55);
+    case 57:
+    l57:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 57);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 3, 0, 45, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 57, 21, 0, 1, 0, 3, 10, 2, 1, 19, 3, 2, 19, 4, 1, 21, 1, 1, 11, 5, 1, 6, 2, 6, 2, 7, 2, 5, 57, 22, 1, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_5[] = { "if", "==", "-", "join", "list", "*" };
+
+// \ {n acc}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l45, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l57;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+        blisp_push(lval_copy(env->vals[1]));
+    case 28:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 31);
+        blisp_push(lval_copy(env->vals[0]));
+    case 31:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 34:
+        BLISP_DO(lvm_do_typed[2](env, code->names[6], 1), 37);
+    case 37:
+        BLISP_DO(lvm_do_call(env, 2), 39);
+    case 39:
+        BLISP_DO(lvm_do_call(env, 2), 41);
+    case 41:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 41);
+    case 43:
+        goto l57;
+    case 45:
+    l45:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 48:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 51);
+    case 51:
+        blisp_push(lval_copy(code->consts[1]));
+    case 53:
+        blisp_push(lval_copy(code->consts[2]));
+    case 55:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 55);
+    case 57:
+    l57:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 57);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 3, 0, 45, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 57, 19, 2, 0, 0, 3, 10, 3, 1, 19, 4, 1, 19, 5, 0, 21, 0, 0, 11, 6, 1, 6, 2, 6, 2, 7, 2, 5, 57, 22, 0, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_6[] = { "if", "==", "loop", "-", "join", "list", "*" };
+
+// \ {acc}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        blisp_push(lval_copy(env->vals[0]));
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 14);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 17);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 17);
+    case 17:
+        BLISP_DO(lvm_do_typed[2](env, code->names[5], 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 2), 22);
+    case 22:
+        BLISP_DO(lvm_do_call(env, 2), 24);
+    case 24:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 24);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 26);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 20, 0, 1, 0, 0, 10, 2, 1, 19, 3, 0, 20, 4, 1, 20, 1, 1, 11, 5, 1, 6, 2, 6, 2, 7, 2, 8 };
+static char* const blisp_names_7[] = { "loop", "n", "-", "join", "list", "*" };
+
+// \ {}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 14);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 17);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 17);
+    case 17:
+        BLISP_DO(lvm_do_typed[2](env, code->names[6], 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 2), 22);
+    case 22:
+        BLISP_DO(lvm_do_call(env, 2), 24);
+    case 24:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 24);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 26);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 20, 5, 1, 20, 1, 1, 11, 6, 1, 6, 2, 6, 2, 7, 2, 8 };
+static char* const blisp_names_8[] = { "loop", "n", "-", "join", "acc", "list", "*" };
+
+// \ {add a b c}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 19, 0, 1, 21, 2, 3, 7, 3, 8 };
+static char* const blisp_names_9[] = { "+" };
+
+// \ {a b c}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 19, 0, 0, 21, 1, 2, 7, 3, 8 };
+static char* const blisp_names_10[] = { "+" };
+
+// \ {curry-all ns acc}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l52, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[0]));
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[2]));
+    case 19:
+        goto l68;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[0]));
+    case 23:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 26);
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        BLISP_DO(lvm_do_call(env, 1), 28);
+    case 28:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 31);
+        blisp_push(lval_copy(env->vals[2]));
+    case 31:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 34);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 34);
+    case 34:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 37);
+        BLISP_DO(lvm_do_global(env, code->names[8]), 37);
+    case 37:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 40);
+    case 40:
+        BLISP_DO(lvm_do_call(env, 1), 42);
+    case 42:
+        BLISP_DO(lvm_do_call(env, 1), 44);
+    case 44:
+        BLISP_DO(lvm_do_call(env, 1), 46);
+    case 46:
+        BLISP_DO(lvm_do_call(env, 2), 48);
+    case 48:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 48);
+    case 50:
+        goto l68;
+    case 52:
+    l52:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 55);
+        blisp_push(lval_copy(env->vals[1]));
+    case 55:
+        BLISP_DO(lvm_do_call(env, 1), 57);
+    case 57:
+        blisp_push(lval_copy(code->consts[3]));
+    case 59:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 62);
+    case 62:
+        blisp_push(lval_copy(code->consts[1]));
+    case 64:
+        blisp_push(lval_copy(code->consts[2]));
+    case 66:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 66);
+    case 68:
+    l68:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 68);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 3, 0, 52, 19, 1, 1, 6, 1, 0, 0, 17, 2, 1, 4, 1, 2, 21, 1, 2, 5, 68, 1, 0, 19, 3, 1, 6, 1, 19, 4, 2, 20, 5, 6, 20, 7, 8, 23, 1, 1, 6, 1, 6, 1, 6, 1, 6, 2, 7, 2, 5, 68, 19, 1, 1, 6, 1, 0, 3, 17, 2, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_11[] = { "if", "len", "==", "tail", "join", "list", "add", "eval", "head" };
+
+// \ {ns acc}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l51, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[0]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[0]));
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[1]));
+    case 19:
+        goto l67;
+    case 21:
+    l21:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 24);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 24);
+    case 24:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 27);
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 30);
+        blisp_push(lval_copy(env->vals[1]));
+    case 30:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 33);
+        BLISP_DO(lvm_do_global(env, code->names[7]), 33);
+    case 33:
+        BLISP_DO(lvm_do_global(env, code->names[8]), 36);
+        BLISP_DO(lvm_do_global(env, code->names[9]), 36);
+    case 36:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 39);
+    case 39:
+        BLISP_DO(lvm_do_call(env, 1), 41);
+    case 41:
+        BLISP_DO(lvm_do_call(env, 1), 43);
+    case 43:
+        BLISP_DO(lvm_do_call(env, 1), 45);
+    case 45:
+        BLISP_DO(lvm_do_call(env, 2), 47);
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+        goto l67;
+    case 51:
+    l51:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 54);
+        blisp_push(lval_copy(env->vals[0]));
+    case 54:
+        BLISP_DO(lvm_do_call(env, 1), 56);
+    case 56:
+        blisp_push(lval_copy(code->consts[3]));
+    case 58:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 61);
+    case 61:
+        blisp_push(lval_copy(code->consts[1]));
+    case 63:
+        blisp_push(lval_copy(code->consts[2]));
+    case 65:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 65);
+    case 67:
+    l67:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 67);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 3, 0, 51, 19, 1, 0, 6, 1, 0, 0, 17, 2, 1, 4, 1, 2, 21, 1, 1, 5, 67, 20, 3, 4, 23, 0, 1, 19, 5, 1, 20, 6, 7, 20, 8, 9, 23, 0, 1, 6, 1, 6, 1, 6, 1, 6, 2, 7, 2, 5, 67, 19, 1, 0, 6, 1, 0, 3, 17, 2, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_12[] = { "if", "len", "==", "curry-all", "tail", "join", "list", "add", "eval", "head" };
+
+// \ {acc}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        blisp_push(lval_copy(env->vals[0]));
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[7]), 16);
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 1), 22);
+    case 22:
+        BLISP_DO(lvm_do_call(env, 1), 24);
+    case 24:
+        BLISP_DO(lvm_do_call(env, 1), 26);
+    case 26:
+        BLISP_DO(lvm_do_call(env, 2), 28);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 28);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 30);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 20, 0, 1, 2, 2, 6, 1, 19, 3, 0, 20, 4, 5, 20, 6, 7, 2, 2, 6, 1, 6, 1, 6, 1, 6, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_13[] = { "curry-all", "tail", "ns", "join", "list", "add", "eval", "head" };
+
+// \ {}
+static int blisp_code_14(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[8]), 16);
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 1), 22);
+    case 22:
+        BLISP_DO(lvm_do_call(env, 1), 24);
+    case 24:
+        BLISP_DO(lvm_do_call(env, 1), 26);
+    case 26:
+        BLISP_DO(lvm_do_call(env, 2), 28);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 28);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 30);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_14[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 20, 5, 6, 20, 7, 8, 2, 2, 6, 1, 6, 1, 6, 1, 6, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_14[] = { "curry-all", "tail", "ns", "join", "acc", "list", "add", "eval", "head" };
+
+// \ {sum-partials ps acc}
+static int blisp_code_15(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l50, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[0]));
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[2]));
+    case 19:
+        goto l66;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[0]));
+    case 23:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 26);
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        BLISP_DO(lvm_do_call(env, 1), 28);
+    case 28:
+        blisp_push(lval_copy(env->vals[2]));
+    case 30:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 33);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 33);
+    case 33:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 36);
+    case 36:
+        BLISP_DO(lvm_do_call(env, 1), 38);
+    case 38:
+        blisp_push(lval_copy(code->consts[3]));
+    case 40:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 2), 43);
+    case 43:
+        BLISP_DO(lvm_do_typed[0](env, code->names[6], 1), 46);
+    case 46:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 46);
+    case 48:
+        goto l66;
+    case 50:
+    l50:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 53);
+        blisp_push(lval_copy(env->vals[1]));
+    case 53:
+        BLISP_DO(lvm_do_call(env, 1), 55);
+    case 55:
+        blisp_push(lval_copy(code->consts[5]));
+    case 57:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 60);
+    case 60:
+        blisp_push(lval_copy(code->consts[1]));
+    case 62:
+        blisp_push(lval_copy(code->consts[2]));
+    case 64:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 64);
+    case 66:
+    l66:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 66);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_15[] = { 3, 0, 50, 19, 1, 1, 6, 1, 0, 0, 17, 2, 1, 4, 1, 2, 21, 1, 2, 5, 66, 1, 0, 19, 3, 1, 6, 1, 1, 2, 20, 4, 5, 23, 1, 1, 6, 1, 0, 3, 24, 4, 2, 9, 6, 1, 7, 2, 5, 66, 19, 1, 1, 6, 1, 0, 5, 17, 2, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_15[] = { "if", "len", "==", "tail", "eval", "head", "+" };
+
+// \ {ps acc}
+static int blisp_code_16(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l49, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[0]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[0]));
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[1]));
+    case 19:
+        goto l65;
+    case 21:
+    l21:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 24);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 24);
+    case 24:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 27);
+    case 27:
+        blisp_push(lval_copy(env->vals[1]));
+    case 29:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 32);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 32);
+    case 32:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 1), 37);
+    case 37:
+        blisp_push(lval_copy(code->consts[3]));
+    case 39:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 2), 42);
+    case 42:
+        BLISP_DO(lvm_do_typed[0](env, code->names[7], 1), 45);
+    case 45:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 45);
+    case 47:
+        goto l65;
+    case 49:
+    l49:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 52);
+        blisp_push(lval_copy(env->vals[0]));
+    case 52:
+        BLISP_DO(lvm_do_call(env, 1), 54);
+    case 54:
+        blisp_push(lval_copy(code->consts[5]));
+    case 56:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 59);
+    case 59:
+        blisp_push(lval_copy(code->consts[1]));
+    case 61:
+        blisp_push(lval_copy(code->consts[2]));
+    case 63:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 63);
+    case 65:
+    l65:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 65);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_16[] = { 3, 0, 49, 19, 1, 0, 6, 1, 0, 0, 17, 2, 1, 4, 1, 2, 21, 1, 1, 5, 65, 20, 3, 4, 23, 0, 1, 1, 1, 20, 5, 6, 23, 0, 1, 6, 1, 0, 3, 24, 4, 2, 9, 7, 1, 7, 2, 5, 65, 19, 1, 0, 6, 1, 0, 5, 17, 2, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_16[] = { "if", "len", "==", "sum-partials", "tail", "eval", "head", "+" };
+
+// \ {acc}
+static int blisp_code_17(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        blisp_push(lval_copy(env->vals[0]));
+    case 9:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 12);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 12);
+    case 12:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 14);
+    case 14:
+        BLISP_DO(lvm_do_call(env, 1), 16);
+    case 16:
+        BLISP_DO(lvm_do_call(env, 1), 18);
+    case 18:
+        blisp_push(lval_copy(code->consts[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 23);
+    case 23:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 26);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 26);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 28);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_17[] = { 20, 0, 1, 2, 2, 6, 1, 1, 0, 20, 3, 4, 2, 2, 6, 1, 6, 1, 0, 0, 24, 1, 2, 9, 5, 1, 7, 2, 8 };
+static char* const blisp_names_17[] = { "sum-partials", "tail", "ps", "eval", "head", "+" };
+
+// \ {}
+static int blisp_code_18(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[2]), 13);
+    case 13:
+        BLISP_DO(lvm_do_call(env, 1), 15);
+    case 15:
+        BLISP_DO(lvm_do_call(env, 1), 17);
+    case 17:
+        blisp_push(lval_copy(code->consts[0]));
+    case 19:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 22);
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[6], 1), 25);
+    case 25:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 25);
+    case 27:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 27);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_18[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 20, 5, 2, 6, 1, 6, 1, 0, 0, 24, 1, 2, 9, 6, 1, 7, 2, 8 };
+static char* const blisp_names_18[] = { "sum-partials", "tail", "ps", "acc", "eval", "head", "+" };
+
+// \ {fill m n}
+static int blisp_code_19(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l54, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l66;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 22);
+        blisp_push(lval_copy(env->vals[1]));
+    case 22:
+        blisp_push(lval_copy(env->vals[2]));
+    case 24:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 27);
+        blisp_push(lval_copy(env->vals[2]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 29);
+    case 29:
+        blisp_push(lval_copy(code->consts[3]));
+    case 31:
+        blisp_push(lval_copy(code->consts[4]));
+    case 33:
+        blisp_push(lval_copy(env->vals[2]));
+    case 35:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 38);
+    case 38:
+        BLISP_DO(lvm_do_call(env, 2), 40);
+    case 40:
+        BLISP_DO(lvm_do_call(env, 2), 42);
+    case 42:
+        BLISP_DO(lvm_do_call(env, 3), 44);
+    case 44:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 47:
+        BLISP_DO(lvm_do_typed[1](env, code->names[6], 1), 50);
+    case 50:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 50);
+    case 52:
+        goto l66;
+    case 54:
+    l54:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 57:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 60);
+    case 60:
+        blisp_push(lval_copy(code->consts[1]));
+    case 62:
+        blisp_push(lval_copy(code->consts[2]));
+    case 64:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 64);
+    case 66:
+    l66:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 66);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_19[] = { 3, 0, 54, 22, 2, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 66, 1, 0, 19, 2, 1, 1, 2, 19, 3, 2, 2, 4, 0, 3, 0, 4, 1, 2, 9, 5, 1, 6, 2, 6, 2, 6, 3, 22, 2, 5, 10, 6, 1, 7, 2, 5, 66, 22, 2, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_19[] = { "if", "==", "map-put", "list", "^", "+", "-" };
+
+// \ {m n}
+static int blisp_code_20(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l53, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[0]));
+    case 15:
+        goto l65;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 23:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 26);
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 28);
+    case 28:
+        blisp_push(lval_copy(code->consts[3]));
+    case 30:
+        blisp_push(lval_copy(code->consts[4]));
+    case 32:
+        blisp_push(lval_copy(env->vals[1]));
+    case 34:
+        BLISP_DO(lvm_do_typed[0](env, code->names[6], 1), 37);
+    case 37:
+        BLISP_DO(lvm_do_call(env, 2), 39);
+    case 39:
+        BLISP_DO(lvm_do_call(env, 2), 41);
+    case 41:
+        BLISP_DO(lvm_do_call(env, 3), 43);
+    case 43:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 46:
+        BLISP_DO(lvm_do_typed[1](env, code->names[7], 1), 49);
+    case 49:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 49);
+    case 51:
+        goto l65;
+    case 53:
+    l53:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 56:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 59);
+    case 59:
+        blisp_push(lval_copy(code->consts[1]));
+    case 61:
+        blisp_push(lval_copy(code->consts[2]));
+    case 63:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 63);
+    case 65:
+    l65:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 65);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_20[] = { 3, 0, 53, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 0, 5, 65, 20, 2, 3, 21, 0, 1, 19, 4, 1, 2, 5, 0, 3, 0, 4, 1, 1, 9, 6, 1, 6, 2, 6, 2, 6, 3, 22, 1, 5, 10, 7, 1, 7, 2, 5, 65, 22, 1, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_20[] = { "if", "==", "fill", "map-put", "list", "^", "+", "-" };
+
+// \ {m}
+static int blisp_code_21(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+    case 5:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 8);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        blisp_push(lval_copy(code->consts[0]));
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 17);
+    case 17:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 2), 22);
+    case 22:
+        BLISP_DO(lvm_do_call(env, 2), 24);
+    case 24:
+        BLISP_DO(lvm_do_call(env, 3), 26);
+    case 26:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 28);
+    case 28:
+        blisp_push(lval_copy(code->consts[2]));
+    case 30:
+        BLISP_DO(lvm_do_typed[1](env, code->names[6], 1), 33);
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 35);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_21[] = { 20, 0, 1, 1, 0, 20, 2, 3, 20, 2, 4, 0, 0, 0, 1, 2, 2, 9, 5, 1, 6, 2, 6, 2, 6, 3, 2, 2, 0, 2, 10, 6, 1, 7, 2, 8 };
+static char* const blisp_names_21[] = { "fill", "map-put", "n", "list", "^", "+", "-" };
+
+// \ {}
+static int blisp_code_22(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 6);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 11);
+    case 11:
+        blisp_push(lval_copy(code->consts[0]));
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 17);
+    case 17:
+        BLISP_DO(lvm_do_typed[0](env, code->names[6], 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 2), 22);
+    case 22:
+        BLISP_DO(lvm_do_call(env, 2), 24);
+    case 24:
+        BLISP_DO(lvm_do_call(env, 3), 26);
+    case 26:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+    case 28:
+        blisp_push(lval_copy(code->consts[2]));
+    case 30:
+        BLISP_DO(lvm_do_typed[1](env, code->names[7], 1), 33);
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 35);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_22[] = { 20, 0, 1, 20, 2, 3, 20, 4, 3, 2, 5, 0, 0, 0, 1, 2, 3, 9, 6, 1, 6, 2, 6, 2, 6, 3, 2, 3, 0, 2, 10, 7, 1, 7, 2, 8 };
+static char* const blisp_names_22[] = { "fill", "map-put", "m", "n", "list", "^", "+", "-" };
+
+// \ {powers n acc}
+static int blisp_code_23(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l47, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l59;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 29);
+    case 29:
+        blisp_push(lval_copy(code->consts[4]));
+    case 31:
+        blisp_push(lval_copy(code->consts[5]));
+    case 33:
+        blisp_push(lval_copy(env->vals[1]));
+    case 35:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 38);
+    case 38:
+        BLISP_DO(lvm_do_call(env, 2), 40);
+    case 40:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 43);
+    case 43:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 43);
+    case 45:
+        goto l59;
+    case 47:
+    l47:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 50:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 53);
+    case 53:
+        blisp_push(lval_copy(code->consts[1]));
+    case 55:
+        blisp_push(lval_copy(code->consts[2]));
+    case 57:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 57);
+    case 59:
+    l59:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 59);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_23[] = { 3, 0, 47, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 59, 21, 0, 1, 0, 3, 10, 2, 1, 1, 2, 2, 3, 0, 4, 0, 5, 1, 1, 9, 4, 1, 6, 2, 9, 4, 1, 7, 2, 5, 59, 22, 1, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_23[] = { "if", "==", "-", "^", "+" };
+
+// \ {n acc}
+static int blisp_code_24(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l47, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l59;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 29);
+    case 29:
+        blisp_push(lval_copy(code->consts[4]));
+    case 31:
+        blisp_push(lval_copy(code->consts[5]));
+    case 33:
+        blisp_push(lval_copy(env->vals[0]));
+    case 35:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 38);
+    case 38:
+        BLISP_DO(lvm_do_call(env, 2), 40);
+    case 40:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 43);
+    case 43:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 43);
+    case 45:
+        goto l59;
+    case 47:
+    l47:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 50:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 53);
+    case 53:
+        blisp_push(lval_copy(code->consts[1]));
+    case 55:
+        blisp_push(lval_copy(code->consts[2]));
+    case 57:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 57);
+    case 59:
+    l59:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 59);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_24[] = { 3, 0, 47, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 59, 19, 2, 0, 0, 3, 10, 3, 1, 1, 1, 2, 4, 0, 4, 0, 5, 1, 0, 9, 5, 1, 6, 2, 9, 5, 1, 7, 2, 5, 59, 22, 0, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_24[] = { "if", "==", "powers", "-", "^", "+" };
+
+// \ {acc}
+static int blisp_code_25(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 12);
+    case 12:
+        blisp_push(lval_copy(code->consts[1]));
+    case 14:
+        blisp_push(lval_copy(code->consts[2]));
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 18);
+    case 18:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 21);
+    case 21:
+        BLISP_DO(lvm_do_call(env, 2), 23);
+    case 23:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 26);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 26);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 28);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_25[] = { 20, 0, 1, 0, 0, 10, 2, 1, 1, 0, 2, 3, 0, 1, 0, 2, 2, 1, 9, 4, 1, 6, 2, 9, 4, 1, 7, 2, 8 };
+static char* const blisp_names_25[] = { "powers", "n", "-", "^", "+" };
+
+// \ {}
+static int blisp_code_26(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        blisp_push(lval_copy(code->consts[1]));
+    case 13:
+        blisp_push(lval_copy(code->consts[2]));
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 17);
+    case 17:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 2), 22);
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 25);
+    case 25:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 25);
+    case 27:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 27);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_26[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 0, 1, 0, 2, 2, 1, 9, 5, 1, 6, 2, 9, 5, 1, 7, 2, 8 };
+static char* const blisp_names_26[] = { "powers", "n", "-", "acc", "^", "+" };
+
+// \ {partials}
+static int blisp_code_27(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(code->consts[0]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_27[] = { 0, 0, 8 };
+static char* const blisp_names_27[] = { NULL };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("live"), lval_sym("_")), blisp_list(lval_qexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("gc"), lval_bool(true)), lval_int(INT64_C(13)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("before")), blisp_list(lval_sexpr(), 2, lval_sym("live"), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("build"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_qexpr()), blisp_list(lval_qexpr(), 3, lval_sym("join"), blisp_list(lval_sexpr(), 2, lval_sym("list"), lval_sym("n")), blisp_list(lval_sexpr(), 2, lval_sym("build"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("loop"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("loop"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("acc"), blisp_list(lval_sexpr(), 3, lval_sym("list"), lval_sym("n"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("n"), lval_sym("n"))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("len"), blisp_list(lval_sexpr(), 2, lval_sym("build"), lval_int(INT64_C(500)))), blisp_list(lval_sexpr(), 2, lval_sym("len"), blisp_list(lval_sexpr(), 3, lval_sym("loop"), lval_int(INT64_C(3000)), lval_qexpr())), blisp_list(lval_sexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 3, lval_sym("loop"), lval_int(INT64_C(3000)), lval_qexpr()), lval_int(INT64_C(4001)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("add"), lval_sym("a"), lval_sym("b"), lval_sym("c")), blisp_list(lval_qexpr(), 4, lval_sym("+"), lval_sym("a"), lval_sym("b"), lval_sym("c"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("curry-all"), lval_sym("ns"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("ns")), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("curry-all"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("ns")), blisp_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("acc"), blisp_list(lval_sexpr(), 2, lval_sym("list"), blisp_list(lval_sexpr(), 2, lval_sym("add"), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("ns"))))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("partials")), blisp_list(lval_sexpr(), 3, lval_sym("curry-all"), blisp_list(lval_sexpr(), 2, lval_sym("build"), lval_int(INT64_C(50))), lval_qexpr())));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("sum-partials"), lval_sym("ps"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("ps")), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("sum-partials"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("ps")), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 3, blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("ps"))), lval_int(INT64_C(1)), lval_int(INT64_C(2))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("sum-partials"), lval_sym("partials"), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("fill"), lval_sym("m"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("m")), blisp_list(lval_qexpr(), 3, lval_sym("fill"), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), lval_sym("m"), lval_sym("n"), blisp_list(lval_sexpr(), 3, lval_sym("list"), lval_sym("n"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_int(INT64_C(64)), lval_sym("n"))))), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1)))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("m")), blisp_list(lval_sexpr(), 3, lval_sym("fill"), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), lval_qexpr()), lval_int(INT64_C(200)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("m")), blisp_list(lval_sexpr(), 4, lval_sym("map-get"), lval_sym("m"), lval_int(INT64_C(7)), lval_qexpr()), blisp_list(lval_sexpr(), 2, lval_sym("len"), blisp_list(lval_sexpr(), 2, lval_sym("map-keys"), lval_sym("m")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("powers"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("powers"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(3)), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_int(INT64_C(40)), lval_sym("n"))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("powers"), lval_int(INT64_C(100)), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("partials")), lval_qexpr()));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("m")), lval_qexpr()));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<="), blisp_list(lval_sexpr(), 2, lval_sym("live"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("before"), lval_int(INT64_C(200))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 11, blisp_names_2, 2, blisp_code_2);
+    lvm_register(blisp_ops_3, 50, blisp_names_3, 5, blisp_code_3);
+    lvm_register(blisp_ops_4, 50, blisp_names_4, 6, blisp_code_4);
+    lvm_register(blisp_ops_5, 58, blisp_names_5, 6, blisp_code_5);
+    lvm_register(blisp_ops_6, 58, blisp_names_6, 7, blisp_code_6);
+    lvm_register(blisp_ops_7, 27, blisp_names_7, 6, blisp_code_7);
+    lvm_register(blisp_ops_8, 27, blisp_names_8, 7, blisp_code_8);
+    lvm_register(blisp_ops_9, 9, blisp_names_9, 1, blisp_code_9);
+    lvm_register(blisp_ops_10, 9, blisp_names_10, 1, blisp_code_10);
+    lvm_register(blisp_ops_11, 69, blisp_names_11, 9, blisp_code_11);
+    lvm_register(blisp_ops_12, 68, blisp_names_12, 10, blisp_code_12);
+    lvm_register(blisp_ops_13, 31, blisp_names_13, 8, blisp_code_13);
+    lvm_register(blisp_ops_14, 31, blisp_names_14, 9, blisp_code_14);
+    lvm_register(blisp_ops_15, 67, blisp_names_15, 7, blisp_code_15);
+    lvm_register(blisp_ops_16, 66, blisp_names_16, 8, blisp_code_16);
+    lvm_register(blisp_ops_17, 29, blisp_names_17, 6, blisp_code_17);
+    lvm_register(blisp_ops_18, 28, blisp_names_18, 7, blisp_code_18);
+    lvm_register(blisp_ops_19, 67, blisp_names_19, 7, blisp_code_19);
+    lvm_register(blisp_ops_20, 66, blisp_names_20, 8, blisp_code_20);
+    lvm_register(blisp_ops_21, 36, blisp_names_21, 7, blisp_code_21);
+    lvm_register(blisp_ops_22, 36, blisp_names_22, 8, blisp_code_22);
+    lvm_register(blisp_ops_23, 60, blisp_names_23, 5, blisp_code_23);
+    lvm_register(blisp_ops_24, 60, blisp_names_24, 6, blisp_code_24);
+    lvm_register(blisp_ops_25, 29, blisp_names_25, 5, blisp_code_25);
+    lvm_register(blisp_ops_26, 28, blisp_names_26, 6, blisp_code_26);
+    lvm_register(blisp_ops_27, 3, blisp_names_27, 0, blisp_code_27);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,733 @@
+// Generated by blisp --emit-c from test/global.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {scale x}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+    case 2:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 4);
+    case 4:
+        BLISP_DO(lvm_do_typed[2](env, code->names[1], 1), 7);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 1, 1, 2, 0, 11, 1, 1, 8 };
+static char* const blisp_names_2[] = { "rate", "*" };
+
+// \ {x}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+    case 2:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 4);
+    case 4:
+        BLISP_DO(lvm_do_typed[2](env, code->names[1], 1), 7);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 1, 0, 2, 0, 11, 1, 1, 8 };
+static char* const blisp_names_3[] = { "rate", "*" };
+
+// \ {repeat n acc}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l39, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l51;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 29);
+    case 29:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 1), 32);
+    case 32:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 35);
+    case 35:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 35);
+    case 37:
+        goto l51;
+    case 39:
+    l39:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 42:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 45);
+    case 45:
+        blisp_push(lval_copy(code->consts[1]));
+    case 47:
+        blisp_push(lval_copy(code->consts[2]));
+    case 49:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 49);
+    case 51:
+    l51:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 51);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 3, 0, 39, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 51, 21, 0, 1, 0, 3, 10, 2, 1, 1, 2, 2, 3, 24, 4, 1, 9, 4, 1, 7, 2, 5, 51, 22, 1, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_4[] = { "if", "==", "-", "scale", "+" };
+
+// \ {n acc}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l39, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l51;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 29);
+    case 29:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 1), 32);
+    case 32:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 35);
+    case 35:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 35);
+    case 37:
+        goto l51;
+    case 39:
+    l39:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 42:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 45);
+    case 45:
+        blisp_push(lval_copy(code->consts[1]));
+    case 47:
+        blisp_push(lval_copy(code->consts[2]));
+    case 49:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 49);
+    case 51:
+    l51:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 51);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 3, 0, 39, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 51, 19, 2, 0, 0, 3, 10, 3, 1, 1, 1, 2, 4, 24, 4, 1, 9, 5, 1, 7, 2, 5, 51, 22, 0, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_5[] = { "if", "==", "repeat", "-", "scale", "+" };
+
+// \ {acc}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 12);
+    case 12:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 1), 15);
+    case 15:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 18);
+    case 18:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 18);
+    case 20:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 20);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 20, 0, 1, 0, 0, 10, 2, 1, 1, 0, 2, 3, 24, 1, 1, 9, 4, 1, 7, 2, 8 };
+static char* const blisp_names_6[] = { "repeat", "n", "-", "scale", "+" };
+
+// \ {}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 24, 1, 1, 9, 5, 1, 7, 2, 8 };
+static char* const blisp_names_7[] = { "repeat", "n", "-", "acc", "scale", "+" };
+
+// \ {y}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 3);
+    case 5:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 5);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 19, 0, 0, 7, 1, 8 };
+static char* const blisp_names_8[] = { "scale" };
+
+// \ {}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 3);
+    case 5:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 5);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 20, 0, 1, 7, 1, 8 };
+static char* const blisp_names_9[] = { "scale", "y" };
+
+// \ {with-rate rate x}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[2]));
+    case 3:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 3);
+    case 5:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 5);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 19, 0, 2, 7, 1, 8 };
+static char* const blisp_names_10[] = { "scale" };
+
+// \ {rate x}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 3);
+    case 5:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 5);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 19, 0, 1, 7, 1, 8 };
+static char* const blisp_names_11[] = { "scale" };
+
+// \ {nested rate}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 10);
+    case 10:
+        blisp_push(lval_copy(code->consts[2]));
+        BLISP_DO(lvm_do_call(env, 1), 13);
+    case 13:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 13);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 15);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 20, 0, 1, 0, 0, 24, 1, 2, 2, 2, 24, 2, 1, 7, 2, 8 };
+static char* const blisp_names_12[] = { "list", "with-rate", "scale" };
+
+// \ {late _}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 2, 0, 8 };
+static char* const blisp_names_13[] = { "offset" };
+
+// \ {twice x}
+static int blisp_code_14(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_14[] = { 20, 0, 0, 23, 1, 1, 7, 1, 8 };
+static char* const blisp_names_14[] = { "scale" };
+
+// \ {x}
+static int blisp_code_15(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_15[] = { 20, 0, 0, 23, 0, 1, 7, 1, 8 };
+static char* const blisp_names_15[] = { "scale" };
+
+// \ {scale x}
+static int blisp_code_16(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+    case 2:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 4);
+    case 4:
+        BLISP_DO(lvm_do_typed[1](env, code->names[1], 1), 7);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_16[] = { 1, 1, 2, 0, 10, 1, 1, 8 };
+static char* const blisp_names_16[] = { "rate", "-" };
+
+// \ {x}
+static int blisp_code_17(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+    case 2:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 4);
+    case 4:
+        BLISP_DO(lvm_do_typed[1](env, code->names[1], 1), 7);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_17[] = { 1, 0, 2, 0, 10, 1, 1, 8 };
+static char* const blisp_names_17[] = { "rate", "-" };
+
+// \ {broken rate}
+static int blisp_code_18(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 3:
+        BLISP_DO(lvm_do_typed[0](env, code->names[0], 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_18[] = { 22, 1, 0, 9, 0, 1, 8 };
+static char* const blisp_names_18[] = { "+" };
+
+// \ {rate}
+static int blisp_code_19(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 3:
+        BLISP_DO(lvm_do_typed[0](env, code->names[0], 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_19[] = { 22, 0, 0, 9, 0, 1, 8 };
+static char* const blisp_names_19[] = { "+" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("rate")), lval_int(INT64_C(2))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("scale"), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("x"), lval_sym("rate"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("repeat"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("repeat"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(1))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(10))), blisp_list(lval_sexpr(), 3, lval_sym("repeat"), lval_int(INT64_C(2000)), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("rate")), lval_int(INT64_C(3))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(10))), blisp_list(lval_sexpr(), 3, lval_sym("repeat"), lval_int(INT64_C(2000)), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("="), blisp_list(lval_qexpr(), 1, lval_sym("rate")), lval_int(INT64_C(5))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(10))), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_qexpr(), 2, lval_sym("scale"), lval_int(INT64_C(10)))), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 1, lval_sym("y")), blisp_list(lval_qexpr(), 2, lval_sym("scale"), lval_sym("y"))), lval_int(INT64_C(10)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("with-rate"), lval_sym("rate"), lval_sym("x")), blisp_list(lval_qexpr(), 2, lval_sym("scale"), lval_sym("x"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("with-rate"), lval_int(INT64_C(7)), lval_int(INT64_C(10))), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(10)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("nested"), lval_sym("rate")), blisp_list(lval_qexpr(), 3, lval_sym("list"), blisp_list(lval_sexpr(), 3, lval_sym("with-rate"), lval_int(INT64_C(11)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(1))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("nested"), lval_int(INT64_C(13))), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("late"), lval_sym("_")), blisp_list(lval_qexpr(), 1, lval_sym("offset"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("late"), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("offset")), lval_int(INT64_C(100))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("late"), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("offset")), lval_int(INT64_C(200))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("late"), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("twice"), lval_sym("x")), blisp_list(lval_qexpr(), 2, lval_sym("scale"), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_sym("x")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("twice"), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("scale"), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("-"), lval_sym("x"), lval_sym("rate"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("twice"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("repeat"), lval_int(INT64_C(2000)), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("broken"), lval_sym("rate")), blisp_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("rate"), blisp_list(lval_qexpr(), 1, lval_sym("oops")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("broken"), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("scale"), lval_int(INT64_C(10))), lval_sym("rate")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 8, blisp_names_2, 2, blisp_code_2);
+    lvm_register(blisp_ops_3, 8, blisp_names_3, 2, blisp_code_3);
+    lvm_register(blisp_ops_4, 52, blisp_names_4, 5, blisp_code_4);
+    lvm_register(blisp_ops_5, 52, blisp_names_5, 6, blisp_code_5);
+    lvm_register(blisp_ops_6, 21, blisp_names_6, 5, blisp_code_6);
+    lvm_register(blisp_ops_7, 20, blisp_names_7, 6, blisp_code_7);
+    lvm_register(blisp_ops_8, 6, blisp_names_8, 1, blisp_code_8);
+    lvm_register(blisp_ops_9, 6, blisp_names_9, 2, blisp_code_9);
+    lvm_register(blisp_ops_10, 6, blisp_names_10, 1, blisp_code_10);
+    lvm_register(blisp_ops_11, 6, blisp_names_11, 1, blisp_code_11);
+    lvm_register(blisp_ops_12, 16, blisp_names_12, 3, blisp_code_12);
+    lvm_register(blisp_ops_13, 3, blisp_names_13, 1, blisp_code_13);
+    lvm_register(blisp_ops_14, 9, blisp_names_14, 1, blisp_code_14);
+    lvm_register(blisp_ops_15, 9, blisp_names_15, 1, blisp_code_15);
+    lvm_register(blisp_ops_16, 8, blisp_names_16, 2, blisp_code_16);
+    lvm_register(blisp_ops_17, 8, blisp_names_17, 2, blisp_code_17);
+    lvm_register(blisp_ops_18, 7, blisp_names_18, 1, blisp_code_18);
+    lvm_register(blisp_ops_19, 7, blisp_names_19, 1, blisp_code_19);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
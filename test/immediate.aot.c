@@ -0,0 +1,490 @@
+// Generated by blisp --emit-c from test/immediate.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {allocated _}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        blisp_push(lval_copy(code->consts[1]));
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 20, 0, 1, 24, 0, 1, 0, 1, 7, 2, 8 };
+static char* const blisp_names_2[] = { "nth", "gc" };
+
+// \ {count n acc}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l44, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l56;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 28:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 0), 31);
+    case 31:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 34:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 0), 37);
+    case 37:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 40);
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 40);
+    case 42:
+        goto l56;
+    case 44:
+    l44:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 47:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 50);
+    case 50:
+        blisp_push(lval_copy(code->consts[1]));
+    case 52:
+        blisp_push(lval_copy(code->consts[2]));
+    case 54:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 54);
+    case 56:
+    l56:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 56);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 44, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 56, 21, 0, 1, 0, 3, 10, 2, 1, 22, 2, 4, 9, 3, 0, 22, 1, 5, 11, 4, 0, 9, 3, 1, 7, 2, 5, 56, 22, 1, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "==", "-", "+", "*" };
+
+// \ {n acc}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l44, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l56;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 28:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 0), 31);
+    case 31:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 34:
+        BLISP_DO(lvm_do_typed[2](env, code->names[5], 0), 37);
+    case 37:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 40);
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 40);
+    case 42:
+        goto l56;
+    case 44:
+    l44:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 47:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 50);
+    case 50:
+        blisp_push(lval_copy(code->consts[1]));
+    case 52:
+        blisp_push(lval_copy(code->consts[2]));
+    case 54:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 54);
+    case 56:
+    l56:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 56);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 3, 0, 44, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 56, 19, 2, 0, 0, 3, 10, 3, 1, 22, 1, 4, 9, 4, 0, 22, 0, 5, 11, 5, 0, 9, 4, 1, 7, 2, 5, 56, 22, 0, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_4[] = { "if", "==", "count", "-", "+", "*" };
+
+// \ {acc}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[1]));
+    case 11:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 0), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        blisp_push(lval_copy(code->consts[2]));
+    case 18:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 0), 21);
+    case 21:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 24);
+    case 24:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 24);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 26);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 0, 0, 10, 2, 1, 22, 0, 1, 9, 3, 0, 2, 1, 0, 2, 11, 4, 0, 9, 3, 1, 7, 2, 8 };
+static char* const blisp_names_5[] = { "count", "n", "-", "+", "*" };
+
+// \ {}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+    case 10:
+        blisp_push(lval_copy(code->consts[1]));
+    case 12:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 0), 15);
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 17);
+    case 17:
+        blisp_push(lval_copy(code->consts[2]));
+    case 19:
+        BLISP_DO(lvm_do_typed[2](env, code->names[5], 0), 22);
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 25);
+    case 25:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 25);
+    case 27:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 27);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 20, 0, 1, 0, 0, 10, 2, 1, 2, 3, 0, 1, 9, 4, 0, 2, 1, 0, 2, 11, 5, 0, 9, 4, 1, 7, 2, 8 };
+static char* const blisp_names_6[] = { "count", "n", "-", "acc", "+", "*" };
+
+// \ {show-builtins x y}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 8);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 20, 0, 1, 21, 1, 2, 2, 2, 7, 4, 8 };
+static char* const blisp_names_7[] = { "list", "head", "+" };
+
+// \ {x y}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 8);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 20, 0, 1, 21, 0, 1, 2, 2, 7, 4, 8 };
+static char* const blisp_names_8[] = { "list", "head", "+" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("allocated"), lval_sym("_")), blisp_list(lval_qexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("gc"), lval_bool(false)), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("count"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("count"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), lval_num(0x1p-1)), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("n"), lval_int(INT64_C(3))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("count"), lval_int(INT64_C(10)), lval_int(INT64_C(0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("before")), blisp_list(lval_sexpr(), 2, lval_sym("allocated"), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("count"), lval_int(INT64_C(10000)), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("<"), blisp_list(lval_sexpr(), 3, lval_sym("-"), blisp_list(lval_sexpr(), 2, lval_sym("allocated"), lval_int(INT64_C(0))), lval_sym("before")), lval_int(INT64_C(100)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("top")), lval_int(INT64_C(140737488355327))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("bottom")), lval_int(INT64_C(-140737488355328))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), lval_sym("top"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("-"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1))), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("top"), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("/"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("top"), lval_int(INT64_C(2))), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), lval_sym("bottom"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("bottom"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("bottom"), lval_int(INT64_C(1))), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, lval_sym("-"), lval_sym("bottom")), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("bottom"), lval_int(INT64_C(-1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1))), lval_int(INT64_C(140737488355328))), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("top"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1)))), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_sym("bottom"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("bottom"), lval_int(INT64_C(1)))), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("top"), lval_num(0x1.fffffffffffcp+46))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("max"), lval_sym("top"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1)))), blisp_list(lval_sexpr(), 3, lval_sym("min"), lval_sym("bottom"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("bottom"), lval_int(INT64_C(1)))), blisp_list(lval_sexpr(), 3, lval_sym("%"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1))), lval_int(INT64_C(7))), blisp_list(lval_sexpr(), 4, lval_sym("pow-mod"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1))), lval_int(INT64_C(2)), lval_int(INT64_C(1000000007)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("inf")), blisp_list(lval_sexpr(), 3, lval_sym("*"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_num(0x1.4p+3), lval_int(INT64_C(308))), lval_int(INT64_C(10)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 9, lval_sym("print"), lval_num(0x0p+0), lval_num(-0x0p+0), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_num(0x0p+0), lval_num(-0x0p+0)), lval_sym("inf"), blisp_list(lval_sexpr(), 2, lval_sym("-"), lval_sym("inf")), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_num(0x1p-1), lval_int(INT64_C(1074))), blisp_list(lval_sexpr(), 2, lval_sym("-"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_num(0x1.4p+3), lval_int(INT64_C(308)))), blisp_list(lval_sexpr(), 3, lval_sym("+"), blisp_list(lval_sexpr(), 2, lval_sym("-"), lval_sym("inf")), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("nan")), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("inf"), lval_sym("inf"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), lval_sym("nan"), blisp_list(lval_sexpr(), 2, lval_sym("-"), lval_sym("nan")), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("nan"), lval_sym("nan")), blisp_list(lval_sexpr(), 3, lval_sym("!="), lval_sym("nan"), lval_sym("nan")), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_int(INT64_C(0)), lval_sym("nan")), lval_sym("nan")), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("nan"), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_sexpr(), 7, lval_sym("list"), lval_int(INT64_C(1)), lval_num(0x1.8p+0), lval_sym("top"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1))), lval_sym("bottom"), lval_num(-0x0p+0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), lval_sym("xs"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("xs")), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("xs"), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("xs"), blisp_list(lval_sexpr(), 7, lval_sym("list"), lval_int(INT64_C(1)), lval_num(0x1.8p+0), lval_sym("top"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1))), lval_sym("bottom"), lval_int(INT64_C(0))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("m")), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), blisp_list(lval_sexpr(), 9, lval_sym("list"), lval_int(INT64_C(1)), lval_str("one"), lval_sym("top"), lval_str("top"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1))), lval_str("past"), lval_num(0x1.4p+1), lval_str("half")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("m"), lval_num(0x1p+0)), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("m"), lval_num(0x1.fffffffffffcp+46)), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("m"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("top"), lval_int(INT64_C(1)))), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("m"), lval_num(0x1.4p+1)), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("m"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("show-builtins"), lval_sym("x"), lval_sym("y")), blisp_list(lval_qexpr(), 5, lval_sym("list"), lval_sym("head"), lval_sym("x"), lval_sym("y"), lval_sym("+"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("show-builtins"), lval_int(INT64_C(5)), lval_num(0x1.4p+1)), lval_sym("head")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 11, blisp_names_2, 2, blisp_code_2);
+    lvm_register(blisp_ops_3, 57, blisp_names_3, 5, blisp_code_3);
+    lvm_register(blisp_ops_4, 57, blisp_names_4, 6, blisp_code_4);
+    lvm_register(blisp_ops_5, 27, blisp_names_5, 5, blisp_code_5);
+    lvm_register(blisp_ops_6, 28, blisp_names_6, 6, blisp_code_6);
+    lvm_register(blisp_ops_7, 11, blisp_names_7, 3, blisp_code_7);
+    lvm_register(blisp_ops_8, 11, blisp_names_8, 3, blisp_code_8);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
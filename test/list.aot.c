@@ -0,0 +1,1225 @@
+// Generated by blisp --emit-c from test/list.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {range i n acc}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l41, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[3]));
+    case 15:
+        goto l53;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[2]));
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 30);
+        blisp_push(lval_copy(env->vals[3]));
+    case 30:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 33);
+        blisp_push(lval_copy(env->vals[1]));
+    case 33:
+        BLISP_DO(lvm_do_call(env, 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 37);
+    case 39:
+        goto l53;
+    case 41:
+    l41:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 44:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 47);
+    case 47:
+        blisp_push(lval_copy(code->consts[0]));
+    case 49:
+        blisp_push(lval_copy(code->consts[1]));
+    case 51:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 51);
+    case 53:
+    l53:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 53);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 3, 0, 41, 21, 1, 2, 17, 1, 1, 4, 0, 1, 17, 1, 3, 5, 53, 21, 0, 1, 0, 2, 9, 2, 1, 1, 2, 19, 3, 3, 19, 4, 1, 6, 1, 6, 2, 7, 3, 5, 53, 21, 1, 2, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_2[] = { "if", "==", "+", "join", "list" };
+
+// \ {i n acc}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l41, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l53;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[2]));
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 30);
+        blisp_push(lval_copy(env->vals[2]));
+    case 30:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 33);
+        blisp_push(lval_copy(env->vals[0]));
+    case 33:
+        BLISP_DO(lvm_do_call(env, 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 37);
+    case 39:
+        goto l53;
+    case 41:
+    l41:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 44:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 47);
+    case 47:
+        blisp_push(lval_copy(code->consts[0]));
+    case 49:
+        blisp_push(lval_copy(code->consts[1]));
+    case 51:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 51);
+    case 53:
+    l53:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 53);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 41, 21, 0, 1, 17, 1, 1, 4, 0, 1, 17, 1, 2, 5, 53, 19, 2, 0, 0, 2, 9, 3, 1, 1, 1, 19, 4, 2, 19, 5, 0, 6, 1, 6, 2, 7, 3, 5, 53, 21, 0, 1, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "==", "range", "+", "join", "list" };
+
+// \ {acc}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        blisp_push(lval_copy(env->vals[0]));
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        BLISP_DO(lvm_do_call(env, 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 20);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 22);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 20, 0, 1, 0, 0, 9, 2, 1, 20, 3, 4, 1, 0, 20, 5, 1, 6, 1, 6, 2, 7, 3, 8 };
+static char* const blisp_names_4[] = { "range", "i", "+", "n", "join", "list" };
+
+// \ {}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 14);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        BLISP_DO(lvm_do_call(env, 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 20);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 22);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 0, 0, 9, 2, 1, 20, 3, 4, 20, 5, 6, 2, 1, 6, 1, 6, 2, 7, 3, 8 };
+static char* const blisp_names_5[] = { "range", "i", "+", "n", "join", "acc", "list" };
+
+// \ {drop n xs}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l34, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l46;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+        blisp_push(lval_copy(env->vals[2]));
+    case 28:
+        BLISP_DO(lvm_do_call(env, 1), 30);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 30);
+    case 32:
+        goto l46;
+    case 34:
+    l34:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 37:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 40);
+    case 40:
+        blisp_push(lval_copy(code->consts[1]));
+    case 42:
+        blisp_push(lval_copy(code->consts[2]));
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 44);
+    case 46:
+    l46:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 46);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 3, 0, 34, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 46, 21, 0, 1, 0, 3, 10, 2, 1, 19, 3, 2, 6, 1, 7, 2, 5, 46, 22, 1, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_6[] = { "if", "==", "-", "tail" };
+
+// \ {n xs}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l34, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l46;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+        blisp_push(lval_copy(env->vals[1]));
+    case 28:
+        BLISP_DO(lvm_do_call(env, 1), 30);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 30);
+    case 32:
+        goto l46;
+    case 34:
+    l34:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 37:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 40);
+    case 40:
+        blisp_push(lval_copy(code->consts[1]));
+    case 42:
+        blisp_push(lval_copy(code->consts[2]));
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 44);
+    case 46:
+    l46:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 46);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 3, 0, 34, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 46, 19, 2, 0, 0, 3, 10, 3, 1, 19, 4, 1, 6, 1, 7, 2, 5, 46, 22, 0, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_7[] = { "if", "==", "drop", "-", "tail" };
+
+// \ {xs}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        blisp_push(lval_copy(env->vals[0]));
+    case 11:
+        BLISP_DO(lvm_do_call(env, 1), 13);
+    case 13:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 13);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 15);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 20, 0, 1, 0, 0, 10, 2, 1, 19, 3, 0, 6, 1, 7, 2, 8 };
+static char* const blisp_names_8[] = { "drop", "n", "-", "tail" };
+
+// \ {}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_call(env, 1), 13);
+    case 13:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 13);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 15);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 6, 1, 7, 2, 8 };
+static char* const blisp_names_9[] = { "drop", "n", "-", "tail", "xs" };
+
+// \ {drop-back n xs}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l34, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l46;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+        blisp_push(lval_copy(env->vals[2]));
+    case 28:
+        BLISP_DO(lvm_do_call(env, 1), 30);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 30);
+    case 32:
+        goto l46;
+    case 34:
+    l34:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 37:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 40);
+    case 40:
+        blisp_push(lval_copy(code->consts[1]));
+    case 42:
+        blisp_push(lval_copy(code->consts[2]));
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 44);
+    case 46:
+    l46:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 46);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 3, 0, 34, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 46, 21, 0, 1, 0, 3, 10, 2, 1, 19, 3, 2, 6, 1, 7, 2, 5, 46, 22, 1, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_10[] = { "if", "==", "-", "init" };
+
+// \ {n xs}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l34, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l46;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+        blisp_push(lval_copy(env->vals[1]));
+    case 28:
+        BLISP_DO(lvm_do_call(env, 1), 30);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 30);
+    case 32:
+        goto l46;
+    case 34:
+    l34:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 37:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 40);
+    case 40:
+        blisp_push(lval_copy(code->consts[1]));
+    case 42:
+        blisp_push(lval_copy(code->consts[2]));
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 44);
+    case 46:
+    l46:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 46);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 3, 0, 34, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 46, 19, 2, 0, 0, 3, 10, 3, 1, 19, 4, 1, 6, 1, 7, 2, 5, 46, 22, 0, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_11[] = { "if", "==", "drop-back", "-", "init" };
+
+// \ {xs}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        blisp_push(lval_copy(env->vals[0]));
+    case 11:
+        BLISP_DO(lvm_do_call(env, 1), 13);
+    case 13:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 13);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 15);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 20, 0, 1, 0, 0, 10, 2, 1, 19, 3, 0, 6, 1, 7, 2, 8 };
+static char* const blisp_names_12[] = { "drop-back", "n", "-", "init" };
+
+// \ {}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_call(env, 1), 13);
+    case 13:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 13);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 15);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 6, 1, 7, 2, 8 };
+static char* const blisp_names_13[] = { "drop-back", "n", "-", "init", "xs" };
+
+// \ {sum xs acc}
+static int blisp_code_14(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l45, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[0]));
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[2]));
+    case 19:
+        goto l61;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[0]));
+    case 23:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 26);
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        BLISP_DO(lvm_do_call(env, 1), 28);
+    case 28:
+        blisp_push(lval_copy(env->vals[2]));
+    case 30:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 33);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 33);
+    case 33:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 36);
+    case 36:
+        BLISP_DO(lvm_do_call(env, 1), 38);
+    case 38:
+        BLISP_DO(lvm_do_typed[0](env, code->names[6], 1), 41);
+    case 41:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 41);
+    case 43:
+        goto l61;
+    case 45:
+    l45:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 48);
+        blisp_push(lval_copy(env->vals[1]));
+    case 48:
+        BLISP_DO(lvm_do_call(env, 1), 50);
+    case 50:
+        blisp_push(lval_copy(code->consts[3]));
+    case 52:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 55);
+    case 55:
+        blisp_push(lval_copy(code->consts[1]));
+    case 57:
+        blisp_push(lval_copy(code->consts[2]));
+    case 59:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 59);
+    case 61:
+    l61:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 61);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_14[] = { 3, 0, 45, 19, 1, 1, 6, 1, 0, 0, 17, 2, 1, 4, 1, 2, 21, 1, 2, 5, 61, 1, 0, 19, 3, 1, 6, 1, 1, 2, 20, 4, 5, 23, 1, 1, 6, 1, 9, 6, 1, 7, 2, 5, 61, 19, 1, 1, 6, 1, 0, 3, 17, 2, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_14[] = { "if", "len", "==", "tail", "eval", "head", "+" };
+
+// \ {xs acc}
+static int blisp_code_15(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l44, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[0]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[0]));
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[1]));
+    case 19:
+        goto l60;
+    case 21:
+    l21:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 24);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 24);
+    case 24:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 27);
+    case 27:
+        blisp_push(lval_copy(env->vals[1]));
+    case 29:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 32);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 32);
+    case 32:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 1), 37);
+    case 37:
+        BLISP_DO(lvm_do_typed[0](env, code->names[7], 1), 40);
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 40);
+    case 42:
+        goto l60;
+    case 44:
+    l44:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 47);
+        blisp_push(lval_copy(env->vals[0]));
+    case 47:
+        BLISP_DO(lvm_do_call(env, 1), 49);
+    case 49:
+        blisp_push(lval_copy(code->consts[3]));
+    case 51:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 54);
+    case 54:
+        blisp_push(lval_copy(code->consts[1]));
+    case 56:
+        blisp_push(lval_copy(code->consts[2]));
+    case 58:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 58);
+    case 60:
+    l60:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 60);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_15[] = { 3, 0, 44, 19, 1, 0, 6, 1, 0, 0, 17, 2, 1, 4, 1, 2, 21, 1, 1, 5, 60, 20, 3, 4, 23, 0, 1, 1, 1, 20, 5, 6, 23, 0, 1, 6, 1, 9, 7, 1, 7, 2, 5, 60, 19, 1, 0, 6, 1, 0, 3, 17, 2, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_15[] = { "if", "len", "==", "sum", "tail", "eval", "head", "+" };
+
+// \ {acc}
+static int blisp_code_16(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        blisp_push(lval_copy(env->vals[0]));
+    case 9:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 12);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 12);
+    case 12:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 14);
+    case 14:
+        BLISP_DO(lvm_do_call(env, 1), 16);
+    case 16:
+        BLISP_DO(lvm_do_call(env, 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 21);
+    case 21:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 21);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 23);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_16[] = { 20, 0, 1, 2, 2, 6, 1, 1, 0, 20, 3, 4, 2, 2, 6, 1, 6, 1, 9, 5, 1, 7, 2, 8 };
+static char* const blisp_names_16[] = { "sum", "tail", "xs", "eval", "head", "+" };
+
+// \ {}
+static int blisp_code_17(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[2]), 13);
+    case 13:
+        BLISP_DO(lvm_do_call(env, 1), 15);
+    case 15:
+        BLISP_DO(lvm_do_call(env, 1), 17);
+    case 17:
+        BLISP_DO(lvm_do_typed[0](env, code->names[6], 1), 20);
+    case 20:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 20);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 22);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_17[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 20, 5, 2, 6, 1, 6, 1, 9, 6, 1, 7, 2, 8 };
+static char* const blisp_names_17[] = { "sum", "tail", "xs", "acc", "eval", "head", "+" };
+
+// \ {grow-back n xs}
+static int blisp_code_18(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l43, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l55;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+    case 28:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 34);
+        blisp_push(lval_copy(env->vals[1]));
+    case 34:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        BLISP_DO(lvm_do_call(env, 2), 39);
+    case 39:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 39);
+    case 41:
+        goto l55;
+    case 43:
+    l43:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 46:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 49);
+    case 49:
+        blisp_push(lval_copy(code->consts[1]));
+    case 51:
+        blisp_push(lval_copy(code->consts[2]));
+    case 53:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 53);
+    case 55:
+    l55:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 55);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_18[] = { 3, 0, 43, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 55, 21, 0, 1, 0, 3, 10, 2, 1, 20, 3, 4, 23, 2, 1, 19, 5, 1, 23, 1, 2, 6, 2, 7, 2, 5, 55, 22, 1, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_18[] = { "if", "==", "-", "join", "tail", "list" };
+
+// \ {n xs}
+static int blisp_code_19(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l43, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l55;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 28);
+    case 28:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 34);
+        blisp_push(lval_copy(env->vals[0]));
+    case 34:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        BLISP_DO(lvm_do_call(env, 2), 39);
+    case 39:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 39);
+    case 41:
+        goto l55;
+    case 43:
+    l43:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 46:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 49);
+    case 49:
+        blisp_push(lval_copy(code->consts[1]));
+    case 51:
+        blisp_push(lval_copy(code->consts[2]));
+    case 53:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 53);
+    case 55:
+    l55:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 55);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_19[] = { 3, 0, 43, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 55, 19, 2, 0, 0, 3, 10, 3, 1, 20, 4, 5, 23, 1, 1, 19, 6, 0, 23, 0, 2, 6, 2, 7, 2, 5, 55, 22, 0, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_19[] = { "if", "==", "grow-back", "-", "join", "tail", "list" };
+
+// \ {xs}
+static int blisp_code_20(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 17);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 17);
+    case 17:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 19);
+    case 19:
+        BLISP_DO(lvm_do_call(env, 2), 21);
+    case 21:
+        BLISP_DO(lvm_do_call(env, 2), 23);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 23);
+    case 25:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 25);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_20[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 23, 0, 1, 20, 5, 1, 2, 1, 6, 2, 6, 2, 7, 2, 8 };
+static char* const blisp_names_20[] = { "grow-back", "n", "-", "join", "tail", "list" };
+
+// \ {}
+static int blisp_code_21(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 13);
+    case 13:
+        BLISP_DO(lvm_do_call(env, 1), 15);
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 18);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 18);
+    case 18:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 2), 22);
+    case 22:
+        BLISP_DO(lvm_do_call(env, 2), 24);
+    case 24:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 24);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 26);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_21[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 2, 5, 6, 1, 20, 6, 1, 2, 1, 6, 2, 6, 2, 7, 2, 8 };
+static char* const blisp_names_21[] = { "grow-back", "n", "-", "join", "tail", "xs", "list" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("range"), lval_sym("i"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_sym("n")), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("range"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("i"), lval_int(INT64_C(1))), lval_sym("n"), blisp_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("acc"), blisp_list(lval_sexpr(), 2, lval_sym("list"), lval_sym("i")))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("drop"), lval_sym("n"), lval_sym("xs")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_qexpr(), 3, lval_sym("drop"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("xs"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("drop-back"), lval_sym("n"), lval_sym("xs")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_qexpr(), 3, lval_sym("drop-back"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, lval_sym("init"), lval_sym("xs"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("sum"), lval_sym("xs"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("xs")), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("sum"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("xs")), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("xs"))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_sexpr(), 4, lval_sym("range"), lval_int(INT64_C(0)), lval_int(INT64_C(100)), lval_qexpr())));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("sum"), lval_sym("xs"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 2, lval_sym("len"), blisp_list(lval_sexpr(), 3, lval_sym("drop"), lval_int(INT64_C(100)), lval_sym("xs"))), blisp_list(lval_sexpr(), 3, lval_sym("drop"), lval_int(INT64_C(97)), lval_sym("xs")), blisp_list(lval_sexpr(), 3, lval_sym("drop-back"), lval_int(INT64_C(97)), lval_sym("xs")), blisp_list(lval_sexpr(), 3, lval_sym("drop"), lval_int(INT64_C(48)), blisp_list(lval_sexpr(), 3, lval_sym("drop-back"), lval_int(INT64_C(48)), lval_sym("xs")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("ys")), blisp_list(lval_sexpr(), 3, lval_sym("drop"), lval_int(INT64_C(90)), lval_sym("xs"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("ys"), blisp_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b"))), blisp_list(lval_sexpr(), 3, lval_sym("cons"), lval_int(INT64_C(1)), lval_sym("ys")), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_sexpr(), 3, lval_sym("drop-back"), lval_int(INT64_C(8)), lval_sym("ys")), blisp_list(lval_sexpr(), 3, lval_sym("drop"), lval_int(INT64_C(8)), lval_sym("ys"))), lval_sym("ys")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("grow-back"), lval_sym("n"), lval_sym("xs")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_qexpr(), 3, lval_sym("grow-back"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("xs")), blisp_list(lval_sexpr(), 3, lval_sym("list"), lval_sym("n"), lval_sym("n")))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("zs")), blisp_list(lval_sexpr(), 3, lval_sym("grow-back"), lval_int(INT64_C(500)), blisp_list(lval_qexpr(), 1, lval_sym("start")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("zs")), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("zs")), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("zs"), lval_int(INT64_C(499))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("zs"), lval_int(INT64_C(500))), blisp_list(lval_sexpr(), 3, lval_sym("sum"), lval_sym("zs"), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("shared")), blisp_list(lval_sexpr(), 4, lval_sym("range"), lval_int(INT64_C(0)), lval_int(INT64_C(10)), lval_qexpr())));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("popped")), blisp_list(lval_sexpr(), 2, lval_sym("tail"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("shared")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), lval_sym("shared"), lval_sym("popped"), blisp_list(lval_sexpr(), 2, lval_sym("init"), lval_sym("popped")), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("shared")), blisp_list(lval_sexpr(), 2, lval_sym("head"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("popped")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_qexpr())));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("init"), lval_qexpr())));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 54, blisp_names_2, 5, blisp_code_2);
+    lvm_register(blisp_ops_3, 54, blisp_names_3, 6, blisp_code_3);
+    lvm_register(blisp_ops_4, 23, blisp_names_4, 6, blisp_code_4);
+    lvm_register(blisp_ops_5, 23, blisp_names_5, 7, blisp_code_5);
+    lvm_register(blisp_ops_6, 47, blisp_names_6, 4, blisp_code_6);
+    lvm_register(blisp_ops_7, 47, blisp_names_7, 5, blisp_code_7);
+    lvm_register(blisp_ops_8, 16, blisp_names_8, 4, blisp_code_8);
+    lvm_register(blisp_ops_9, 16, blisp_names_9, 5, blisp_code_9);
+    lvm_register(blisp_ops_10, 47, blisp_names_10, 4, blisp_code_10);
+    lvm_register(blisp_ops_11, 47, blisp_names_11, 5, blisp_code_11);
+    lvm_register(blisp_ops_12, 16, blisp_names_12, 4, blisp_code_12);
+    lvm_register(blisp_ops_13, 16, blisp_names_13, 5, blisp_code_13);
+    lvm_register(blisp_ops_14, 62, blisp_names_14, 7, blisp_code_14);
+    lvm_register(blisp_ops_15, 61, blisp_names_15, 8, blisp_code_15);
+    lvm_register(blisp_ops_16, 24, blisp_names_16, 6, blisp_code_16);
+    lvm_register(blisp_ops_17, 23, blisp_names_17, 7, blisp_code_17);
+    lvm_register(blisp_ops_18, 56, blisp_names_18, 6, blisp_code_18);
+    lvm_register(blisp_ops_19, 56, blisp_names_19, 7, blisp_code_19);
+    lvm_register(blisp_ops_20, 26, blisp_names_20, 6, blisp_code_20);
+    lvm_register(blisp_ops_21, 27, blisp_names_21, 7, blisp_code_21);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,866 @@
+// Generated by blisp --emit-c from test/map.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {fill m i n}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l44, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l56;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 22);
+        blisp_push(lval_copy(env->vals[1]));
+    case 22:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+    case 27:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 1), 30);
+    case 30:
+        BLISP_DO(lvm_do_call(env, 3), 32);
+    case 32:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 35:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 38);
+    case 38:
+        blisp_push(lval_copy(env->vals[3]));
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 40);
+    case 42:
+        goto l56;
+    case 44:
+    l44:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 47:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 50);
+    case 50:
+        blisp_push(lval_copy(code->consts[0]));
+    case 52:
+        blisp_push(lval_copy(code->consts[1]));
+    case 54:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 54);
+    case 56:
+    l56:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 56);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 3, 0, 44, 21, 2, 3, 17, 1, 1, 4, 0, 1, 17, 1, 1, 5, 56, 1, 0, 19, 2, 1, 21, 2, 2, 1, 2, 11, 3, 1, 6, 3, 22, 2, 2, 9, 4, 1, 1, 3, 7, 3, 5, 56, 21, 2, 3, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_2[] = { "if", "==", "map-put", "*", "+" };
+
+// \ {m i n}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l43, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[0]));
+    case 15:
+        goto l55;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 23:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 1), 29);
+    case 29:
+        BLISP_DO(lvm_do_call(env, 3), 31);
+    case 31:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 34:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 37);
+    case 37:
+        blisp_push(lval_copy(env->vals[2]));
+    case 39:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 39);
+    case 41:
+        goto l55;
+    case 43:
+    l43:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 46:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 49);
+    case 49:
+        blisp_push(lval_copy(code->consts[0]));
+    case 51:
+        blisp_push(lval_copy(code->consts[1]));
+    case 53:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 53);
+    case 55:
+    l55:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 55);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 43, 21, 1, 2, 17, 1, 1, 4, 0, 1, 17, 1, 0, 5, 55, 20, 2, 3, 21, 0, 1, 21, 1, 1, 11, 4, 1, 6, 3, 22, 1, 2, 9, 5, 1, 1, 2, 7, 3, 5, 55, 21, 1, 2, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "==", "fill", "map-put", "*", "+" };
+
+// \ {m}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+    case 5:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 8);
+        BLISP_DO(lvm_do_global(env, code->names[2]), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 10);
+    case 10:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 1), 13);
+    case 13:
+        BLISP_DO(lvm_do_call(env, 3), 15);
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 17);
+    case 17:
+        blisp_push(lval_copy(code->consts[0]));
+    case 19:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 22);
+    case 22:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 24);
+    case 24:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 24);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 26);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 20, 0, 1, 1, 0, 20, 2, 2, 2, 2, 11, 3, 1, 6, 3, 2, 2, 0, 0, 9, 4, 1, 2, 5, 7, 3, 8 };
+static char* const blisp_names_4[] = { "fill", "map-put", "i", "*", "+", "n" };
+
+// \ {}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 6);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 1), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 3), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 16);
+    case 16:
+        blisp_push(lval_copy(code->consts[0]));
+    case 18:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 21);
+    case 21:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 23);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 23);
+    case 25:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 25);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 20, 2, 3, 20, 3, 3, 11, 4, 1, 6, 3, 2, 3, 0, 0, 9, 5, 1, 2, 6, 7, 3, 8 };
+static char* const blisp_names_5[] = { "fill", "map-put", "m", "i", "*", "+", "n" };
+
+// \ {drop m i n}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l37, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 6:
+        BLISP_DO(lvm_do_typed[7](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l49;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 22);
+        blisp_push(lval_copy(env->vals[1]));
+    case 22:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 2), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 28:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 31);
+    case 31:
+        blisp_push(lval_copy(env->vals[3]));
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        goto l49;
+    case 37:
+    l37:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 40:
+        BLISP_DO(lvm_do_typed[7](env, code->names[1], 1), 43);
+    case 43:
+        blisp_push(lval_copy(code->consts[0]));
+    case 45:
+        blisp_push(lval_copy(code->consts[1]));
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+    l49:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 49);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 3, 0, 37, 21, 2, 3, 16, 1, 1, 4, 0, 1, 17, 1, 1, 5, 49, 1, 0, 19, 2, 1, 23, 2, 2, 22, 2, 2, 9, 3, 1, 1, 3, 7, 3, 5, 49, 21, 2, 3, 16, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_6[] = { "if", ">=", "map-del", "+" };
+
+// \ {m i n}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l37, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_typed[7](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[0]));
+    case 15:
+        goto l49;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 23:
+        BLISP_DO(lvm_do_call(env, 2), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 28:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 31);
+    case 31:
+        blisp_push(lval_copy(env->vals[2]));
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        goto l49;
+    case 37:
+    l37:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 40:
+        BLISP_DO(lvm_do_typed[7](env, code->names[1], 1), 43);
+    case 43:
+        blisp_push(lval_copy(code->consts[0]));
+    case 45:
+        blisp_push(lval_copy(code->consts[1]));
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+    l49:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 49);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 3, 0, 37, 21, 1, 2, 16, 1, 1, 4, 0, 1, 17, 1, 0, 5, 49, 20, 2, 3, 21, 0, 1, 6, 2, 22, 1, 2, 9, 4, 1, 1, 2, 7, 3, 5, 49, 21, 1, 2, 16, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_7[] = { "if", ">=", "drop", "map-del", "+" };
+
+// \ {m}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+    case 5:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 7);
+    case 7:
+        BLISP_DO(lvm_do_call(env, 2), 9);
+    case 9:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 11);
+    case 11:
+        blisp_push(lval_copy(code->consts[0]));
+    case 13:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 16);
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 18);
+    case 18:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 18);
+    case 20:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 20);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 20, 0, 1, 1, 0, 2, 2, 6, 2, 2, 2, 0, 0, 9, 3, 1, 2, 4, 7, 3, 8 };
+static char* const blisp_names_8[] = { "drop", "map-del", "i", "+", "n" };
+
+// \ {}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 6);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 6);
+    case 6:
+        BLISP_DO(lvm_do_call(env, 2), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+    case 10:
+        blisp_push(lval_copy(code->consts[0]));
+    case 12:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 15);
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 20, 0, 1, 20, 2, 3, 6, 2, 2, 3, 0, 0, 9, 4, 1, 2, 5, 7, 3, 8 };
+static char* const blisp_names_9[] = { "drop", "map-del", "m", "i", "+", "n" };
+
+// \ {sum m ks acc}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l51, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[0]));
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[3]));
+    case 19:
+        goto l67;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 24:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 27);
+        blisp_push(lval_copy(env->vals[2]));
+    case 27:
+        BLISP_DO(lvm_do_call(env, 1), 29);
+    case 29:
+        blisp_push(lval_copy(env->vals[3]));
+    case 31:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 34);
+        blisp_push(lval_copy(env->vals[1]));
+    case 34:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 37);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 37);
+    case 37:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 1), 40);
+    case 40:
+        BLISP_DO(lvm_do_call(env, 1), 42);
+    case 42:
+        BLISP_DO(lvm_do_call(env, 2), 44);
+    case 44:
+        BLISP_DO(lvm_do_typed[0](env, code->names[7], 1), 47);
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+        goto l67;
+    case 51:
+    l51:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 54);
+        blisp_push(lval_copy(env->vals[2]));
+    case 54:
+        BLISP_DO(lvm_do_call(env, 1), 56);
+    case 56:
+        blisp_push(lval_copy(code->consts[3]));
+    case 58:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 61);
+    case 61:
+        blisp_push(lval_copy(code->consts[1]));
+    case 63:
+        blisp_push(lval_copy(code->consts[2]));
+    case 65:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 65);
+    case 67:
+    l67:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 67);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 3, 0, 51, 19, 1, 2, 6, 1, 0, 0, 17, 2, 1, 4, 1, 2, 21, 1, 3, 5, 67, 21, 0, 1, 19, 3, 2, 6, 1, 1, 3, 19, 4, 1, 20, 5, 6, 23, 2, 1, 6, 1, 6, 2, 9, 7, 1, 7, 3, 5, 67, 19, 1, 2, 6, 1, 0, 3, 17, 2, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_10[] = { "if", "len", "==", "tail", "map-get", "eval", "head", "+" };
+
+// \ {m ks acc}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l51, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[0]));
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[2]));
+    case 19:
+        goto l67;
+    case 21:
+    l21:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 24);
+        blisp_push(lval_copy(env->vals[0]));
+    case 24:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 27);
+        blisp_push(lval_copy(env->vals[1]));
+    case 27:
+        BLISP_DO(lvm_do_call(env, 1), 29);
+    case 29:
+        blisp_push(lval_copy(env->vals[2]));
+    case 31:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 34);
+        blisp_push(lval_copy(env->vals[0]));
+    case 34:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 37);
+        BLISP_DO(lvm_do_global(env, code->names[7]), 37);
+    case 37:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 40);
+    case 40:
+        BLISP_DO(lvm_do_call(env, 1), 42);
+    case 42:
+        BLISP_DO(lvm_do_call(env, 2), 44);
+    case 44:
+        BLISP_DO(lvm_do_typed[0](env, code->names[8], 1), 47);
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+        goto l67;
+    case 51:
+    l51:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 54);
+        blisp_push(lval_copy(env->vals[1]));
+    case 54:
+        BLISP_DO(lvm_do_call(env, 1), 56);
+    case 56:
+        blisp_push(lval_copy(code->consts[3]));
+    case 58:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 61);
+    case 61:
+        blisp_push(lval_copy(code->consts[1]));
+    case 63:
+        blisp_push(lval_copy(code->consts[2]));
+    case 65:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 65);
+    case 67:
+    l67:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 67);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 3, 0, 51, 19, 1, 1, 6, 1, 0, 0, 17, 2, 1, 4, 1, 2, 21, 1, 2, 5, 67, 19, 3, 0, 19, 4, 1, 6, 1, 1, 2, 19, 5, 0, 20, 6, 7, 23, 1, 1, 6, 1, 6, 2, 9, 8, 1, 7, 3, 5, 67, 19, 1, 1, 6, 1, 0, 3, 17, 2, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_11[] = { "if", "len", "==", "sum", "tail", "map-get", "eval", "head", "+" };
+
+// \ {acc}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 6);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 6);
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 16);
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 1), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 1), 22);
+    case 22:
+        BLISP_DO(lvm_do_call(env, 2), 24);
+    case 24:
+        BLISP_DO(lvm_do_typed[0](env, code->names[7], 1), 27);
+    case 27:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 27);
+    case 29:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 29);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 20, 0, 1, 20, 2, 3, 6, 1, 1, 0, 20, 4, 1, 20, 5, 6, 2, 3, 6, 1, 6, 1, 6, 2, 9, 7, 1, 7, 3, 8 };
+static char* const blisp_names_12[] = { "sum", "m", "tail", "ks", "map-get", "eval", "head", "+" };
+
+// \ {}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 6);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 6);
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 14);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 17);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 17);
+    case 17:
+        BLISP_DO(lvm_do_call(env, 1), 19);
+    case 19:
+        BLISP_DO(lvm_do_call(env, 1), 21);
+    case 21:
+        BLISP_DO(lvm_do_call(env, 2), 23);
+    case 23:
+        BLISP_DO(lvm_do_typed[0](env, code->names[8], 1), 26);
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 26);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 28);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 20, 0, 1, 20, 2, 3, 6, 1, 20, 4, 5, 20, 1, 6, 20, 7, 3, 6, 1, 6, 1, 6, 2, 9, 8, 1, 7, 3, 8 };
+static char* const blisp_names_13[] = { "sum", "m", "tail", "ks", "acc", "map-get", "eval", "head", "+" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("fill"), lval_sym("m"), lval_sym("i"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_sym("n")), blisp_list(lval_qexpr(), 1, lval_sym("m")), blisp_list(lval_qexpr(), 4, lval_sym("fill"), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), lval_sym("m"), lval_sym("i"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("i"), lval_sym("i"))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("i"), lval_int(INT64_C(1))), lval_sym("n")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("drop"), lval_sym("m"), lval_sym("i"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_sym("i"), lval_sym("n")), blisp_list(lval_qexpr(), 1, lval_sym("m")), blisp_list(lval_qexpr(), 4, lval_sym("drop"), blisp_list(lval_sexpr(), 3, lval_sym("map-del"), lval_sym("m"), lval_sym("i")), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("i"), lval_int(INT64_C(2))), lval_sym("n")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("sum"), lval_sym("m"), lval_sym("ks"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("ks")), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("sum"), lval_sym("m"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("ks")), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("m"), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("ks")))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("m")), blisp_list(lval_sexpr(), 4, lval_sym("fill"), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), lval_qexpr()), lval_int(INT64_C(0)), lval_int(INT64_C(3000)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("m")), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("m"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("m"), lval_int(INT64_C(2999))), blisp_list(lval_sexpr(), 4, lval_sym("map-get"), lval_sym("m"), lval_int(INT64_C(3000)), blisp_list(lval_qexpr(), 1, lval_sym("none"))), blisp_list(lval_sexpr(), 4, lval_sym("map-get"), lval_sym("m"), lval_int(INT64_C(-1)), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("sum"), lval_sym("m"), blisp_list(lval_sexpr(), 2, lval_sym("map-keys"), lval_sym("m")), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 2, lval_sym("len"), blisp_list(lval_sexpr(), 2, lval_sym("map-keys"), lval_sym("m")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("r")), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), lval_sym("m"), lval_int(INT64_C(17)), blisp_list(lval_qexpr(), 1, lval_sym("seventeen")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("r")), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("r"), lval_int(INT64_C(17))), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("m"), lval_int(INT64_C(17)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("d")), blisp_list(lval_sexpr(), 4, lval_sym("drop"), lval_sym("m"), lval_int(INT64_C(0)), lval_int(INT64_C(3000)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("d")), blisp_list(lval_sexpr(), 4, lval_sym("map-get"), lval_sym("d"), lval_int(INT64_C(2)), blisp_list(lval_qexpr(), 1, lval_sym("gone"))), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("d"), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 4, lval_sym("sum"), lval_sym("d"), blisp_list(lval_sexpr(), 2, lval_sym("map-keys"), lval_sym("d")), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("m"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("e")), blisp_list(lval_sexpr(), 4, lval_sym("drop"), blisp_list(lval_sexpr(), 4, lval_sym("drop"), lval_sym("m"), lval_int(INT64_C(0)), lval_int(INT64_C(3000))), lval_int(INT64_C(1)), lval_int(INT64_C(3000)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("e")), blisp_list(lval_sexpr(), 2, lval_sym("map-keys"), lval_sym("e")), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("e"), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), lval_qexpr())), blisp_list(lval_sexpr(), 3, lval_sym("map-del"), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), lval_qexpr()), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("k")), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), blisp_list(lval_qexpr(), 10, lval_int(INT64_C(1)), lval_sym("one"), lval_num(0x1.8p+0), lval_sym("one-and-a-half"), lval_str("s"), lval_sym("string"), lval_sym("x"), lval_sym("symbol"), blisp_list(lval_qexpr(), 2, lval_int(INT64_C(1)), lval_int(INT64_C(2))), lval_sym("list")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("k")), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("k"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("k"), lval_num(0x1p+0)), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("k"), lval_num(0x1.8p+0)), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("k"), lval_str("s")), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("k"), blisp_list(lval_qexpr(), 2, lval_int(INT64_C(1)), lval_int(INT64_C(2))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), lval_sym("k"), lval_num(0x1p+0), blisp_list(lval_qexpr(), 1, lval_sym("uno"))), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), lval_sym("k"), lval_num(0x1p+0), blisp_list(lval_qexpr(), 1, lval_sym("uno")))), blisp_list(lval_sexpr(), 4, lval_sym("map-get"), lval_sym("k"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(70))), blisp_list(lval_qexpr(), 1, lval_sym("none")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("b")), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), lval_sym("k"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(70))), blisp_list(lval_qexpr(), 1, lval_sym("big")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("b"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(70)))), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("b"), lval_num(0x1p+70)), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), blisp_list(lval_sexpr(), 3, lval_sym("map-del"), lval_sym("b"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(70)))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), blisp_list(lval_qexpr(), 6, lval_int(INT64_C(1)), lval_str("a"), lval_int(INT64_C(2)), lval_str("b"), lval_int(INT64_C(3)), lval_str("c"))), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), lval_qexpr()), lval_int(INT64_C(3)), lval_str("c")), lval_int(INT64_C(1)), lval_str("a")), lval_int(INT64_C(2)), lval_str("b")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), blisp_list(lval_qexpr(), 4, lval_int(INT64_C(1)), lval_sym("a"), lval_int(INT64_C(2)), lval_sym("b"))), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), blisp_list(lval_qexpr(), 4, lval_int(INT64_C(1)), lval_sym("a"), lval_int(INT64_C(2)), lval_sym("c")))), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 4, lval_sym("drop"), lval_sym("m"), lval_int(INT64_C(0)), lval_int(INT64_C(3000))), lval_sym("d"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), blisp_list(lval_qexpr(), 2, lval_str("only"), lval_int(INT64_C(1))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 57, blisp_names_2, 5, blisp_code_2);
+    lvm_register(blisp_ops_3, 56, blisp_names_3, 6, blisp_code_3);
+    lvm_register(blisp_ops_4, 27, blisp_names_4, 6, blisp_code_4);
+    lvm_register(blisp_ops_5, 26, blisp_names_5, 7, blisp_code_5);
+    lvm_register(blisp_ops_6, 50, blisp_names_6, 4, blisp_code_6);
+    lvm_register(blisp_ops_7, 50, blisp_names_7, 5, blisp_code_7);
+    lvm_register(blisp_ops_8, 21, blisp_names_8, 5, blisp_code_8);
+    lvm_register(blisp_ops_9, 20, blisp_names_9, 6, blisp_code_9);
+    lvm_register(blisp_ops_10, 68, blisp_names_10, 8, blisp_code_10);
+    lvm_register(blisp_ops_11, 68, blisp_names_11, 9, blisp_code_11);
+    lvm_register(blisp_ops_12, 30, blisp_names_12, 8, blisp_code_12);
+    lvm_register(blisp_ops_13, 29, blisp_names_13, 9, blisp_code_13);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,865 @@
+// Generated by blisp --emit-c from test/mem.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {field n i}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        blisp_push(lval_copy(env->vals[2]));
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 20, 0, 1, 23, 1, 1, 1, 2, 7, 2, 8 };
+static char* const blisp_names_2[] = { "nth", "mem" };
+
+// \ {n i}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        blisp_push(lval_copy(env->vals[1]));
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 20, 0, 1, 23, 0, 1, 1, 1, 7, 2, 8 };
+static char* const blisp_names_3[] = { "nth", "mem" };
+
+// \ {agrees n}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 19, 0, 1, 19, 1, 1, 6, 1, 7, 2, 8 };
+static char* const blisp_names_4[] = { "check", "mem" };
+
+// \ {n}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[0]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 1), 8);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 19, 0, 0, 19, 1, 0, 6, 1, 7, 2, 8 };
+static char* const blisp_names_5[] = { "check", "mem" };
+
+// \ {check n s}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 9);
+    case 9:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 12);
+        blisp_push(lval_copy(env->vals[2]));
+    case 12:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 18);
+        blisp_push(lval_copy(env->vals[2]));
+    case 18:
+        blisp_push(lval_copy(code->consts[2]));
+        BLISP_DO(lvm_do_call(env, 2), 21);
+    case 21:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 0), 24);
+    case 24:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 27);
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 30);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 30);
+    case 30:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 33:
+        BLISP_DO(lvm_do_call(env, 2), 35);
+    case 35:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 2), 38);
+    case 38:
+        blisp_push(lval_copy(code->consts[5]));
+    case 40:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 43);
+    case 43:
+        BLISP_DO(lvm_do_call(env, 2), 45);
+    case 45:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 48);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 48);
+    case 48:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 51:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 54);
+    case 54:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 57);
+        blisp_push(lval_copy(env->vals[2]));
+    case 57:
+        blisp_push(lval_copy(code->consts[7]));
+        BLISP_DO(lvm_do_call(env, 2), 60);
+    case 60:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 63);
+        blisp_push(lval_copy(env->vals[2]));
+    case 63:
+        blisp_push(lval_copy(code->consts[8]));
+        BLISP_DO(lvm_do_call(env, 2), 66);
+    case 66:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 69);
+        blisp_push(lval_copy(env->vals[2]));
+    case 69:
+        blisp_push(lval_copy(code->consts[9]));
+        BLISP_DO(lvm_do_call(env, 2), 72);
+    case 72:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 75);
+        blisp_push(lval_copy(env->vals[2]));
+    case 75:
+        blisp_push(lval_copy(code->consts[10]));
+        BLISP_DO(lvm_do_call(env, 2), 78);
+    case 78:
+        BLISP_DO(lvm_do_typed[1](env, code->names[6], 0), 81);
+    case 81:
+        BLISP_DO(lvm_do_typed[2](env, code->names[7], 0), 84);
+    case 84:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 87);
+    case 87:
+        BLISP_DO(lvm_do_call(env, 2), 89);
+    case 89:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 92);
+        blisp_push(lval_copy(env->vals[2]));
+    case 92:
+        blisp_push(lval_copy(code->consts[11]));
+        BLISP_DO(lvm_do_call(env, 2), 95);
+    case 95:
+        BLISP_TEST(lvm_do_if(env, code->names[8]), l134, 98);
+    case 98:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 101);
+        blisp_push(lval_copy(env->vals[2]));
+    case 101:
+        blisp_push(lval_copy(code->consts[12]));
+        BLISP_DO(lvm_do_call(env, 2), 104);
+    case 104:
+        blisp_push(lval_copy(code->consts[13]));
+    case 106:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 109);
+    case 109:
+        BLISP_TEST(blisp_branch(env, &code->consts[14], &code->consts[15]), l117, 113);
+    case 113:
+        blisp_push(lval_copy(code->consts[16]));
+    case 115:
+        goto l150;
+    case 117:
+    l117:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 120);
+        blisp_push(lval_copy(env->vals[2]));
+    case 120:
+        blisp_push(lval_copy(code->consts[17]));
+        BLISP_DO(lvm_do_call(env, 2), 123);
+    case 123:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 126);
+        blisp_push(lval_copy(env->vals[2]));
+    case 126:
+        blisp_push(lval_copy(code->consts[18]));
+        BLISP_DO(lvm_do_call(env, 2), 129);
+    case 129:
+        BLISP_DO(lvm_do_typed[3](env, code->names[9], 0), 132);
+    case 132:
+        goto l150;
+    case 134:
+    l134:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 137);
+        blisp_push(lval_copy(env->vals[2]));
+    case 137:
+        blisp_push(lval_copy(code->consts[19]));
+        BLISP_DO(lvm_do_call(env, 2), 140);
+    case 140:
+        blisp_push(lval_copy(code->consts[20]));
+    case 142:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 145);
+    case 145:
+        blisp_push(lval_copy(code->consts[14]));
+    case 147:
+        blisp_push(lval_copy(code->consts[15]));
+        BLISP_DO(lvm_do_call(env, 3), 150);
+    case 150:
+    l150:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 153);
+    case 153:
+        BLISP_DO(lvm_do_call(env, 2), 155);
+    case 155:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 155);
+    case 157:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 157);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 20, 0, 0, 19, 1, 2, 24, 0, 2, 19, 1, 2, 24, 1, 2, 19, 1, 2, 24, 2, 2, 9, 2, 0, 17, 3, 1, 20, 4, 1, 22, 2, 3, 6, 2, 24, 4, 2, 0, 5, 17, 3, 1, 6, 2, 20, 0, 5, 22, 1, 6, 17, 3, 1, 19, 1, 2, 24, 7, 2, 19, 1, 2, 24, 8, 2, 19, 1, 2, 24, 9, 2, 19, 1, 2, 24, 10, 2, 10, 6, 0, 11, 7, 0, 17, 3, 1, 6, 2, 19, 1, 2, 24, 11, 2, 3, 8, 134, 19, 1, 2, 24, 12, 2, 0, 13, 17, 3, 1, 4, 14, 15, 117, 0, 16, 5, 150, 19, 1, 2, 24, 17, 2, 19, 1, 2, 24, 18, 2, 12, 9, 0, 5, 150, 19, 1, 2, 24, 19, 2, 0, 20, 17, 3, 1, 0, 14, 24, 15, 3, 17, 3, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_6[] = { "&&", "nth", "+", "==", "%", "||", "-", "*", "if", "/" };
+
+// \ {n s}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 9);
+    case 9:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 12);
+        blisp_push(lval_copy(env->vals[1]));
+    case 12:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 18);
+        blisp_push(lval_copy(env->vals[1]));
+    case 18:
+        blisp_push(lval_copy(code->consts[2]));
+        BLISP_DO(lvm_do_call(env, 2), 21);
+    case 21:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 0), 24);
+    case 24:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 27);
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 30);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 30);
+    case 30:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 33:
+        BLISP_DO(lvm_do_call(env, 2), 35);
+    case 35:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 2), 38);
+    case 38:
+        blisp_push(lval_copy(code->consts[5]));
+    case 40:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 43);
+    case 43:
+        BLISP_DO(lvm_do_call(env, 2), 45);
+    case 45:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 48);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 48);
+    case 48:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 51:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 54);
+    case 54:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 57);
+        blisp_push(lval_copy(env->vals[1]));
+    case 57:
+        blisp_push(lval_copy(code->consts[7]));
+        BLISP_DO(lvm_do_call(env, 2), 60);
+    case 60:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 63);
+        blisp_push(lval_copy(env->vals[1]));
+    case 63:
+        blisp_push(lval_copy(code->consts[8]));
+        BLISP_DO(lvm_do_call(env, 2), 66);
+    case 66:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 69);
+        blisp_push(lval_copy(env->vals[1]));
+    case 69:
+        blisp_push(lval_copy(code->consts[9]));
+        BLISP_DO(lvm_do_call(env, 2), 72);
+    case 72:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 75);
+        blisp_push(lval_copy(env->vals[1]));
+    case 75:
+        blisp_push(lval_copy(code->consts[10]));
+        BLISP_DO(lvm_do_call(env, 2), 78);
+    case 78:
+        BLISP_DO(lvm_do_typed[1](env, code->names[6], 0), 81);
+    case 81:
+        BLISP_DO(lvm_do_typed[2](env, code->names[7], 0), 84);
+    case 84:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 87);
+    case 87:
+        BLISP_DO(lvm_do_call(env, 2), 89);
+    case 89:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 92);
+        blisp_push(lval_copy(env->vals[1]));
+    case 92:
+        blisp_push(lval_copy(code->consts[11]));
+        BLISP_DO(lvm_do_call(env, 2), 95);
+    case 95:
+        BLISP_TEST(lvm_do_if(env, code->names[8]), l134, 98);
+    case 98:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 101);
+        blisp_push(lval_copy(env->vals[1]));
+    case 101:
+        blisp_push(lval_copy(code->consts[12]));
+        BLISP_DO(lvm_do_call(env, 2), 104);
+    case 104:
+        blisp_push(lval_copy(code->consts[13]));
+    case 106:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 109);
+    case 109:
+        BLISP_TEST(blisp_branch(env, &code->consts[14], &code->consts[15]), l117, 113);
+    case 113:
+        blisp_push(lval_copy(code->consts[16]));
+    case 115:
+        goto l150;
+    case 117:
+    l117:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 120);
+        blisp_push(lval_copy(env->vals[1]));
+    case 120:
+        blisp_push(lval_copy(code->consts[17]));
+        BLISP_DO(lvm_do_call(env, 2), 123);
+    case 123:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 126);
+        blisp_push(lval_copy(env->vals[1]));
+    case 126:
+        blisp_push(lval_copy(code->consts[18]));
+        BLISP_DO(lvm_do_call(env, 2), 129);
+    case 129:
+        BLISP_DO(lvm_do_typed[3](env, code->names[9], 0), 132);
+    case 132:
+        goto l150;
+    case 134:
+    l134:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 137);
+        blisp_push(lval_copy(env->vals[1]));
+    case 137:
+        blisp_push(lval_copy(code->consts[19]));
+        BLISP_DO(lvm_do_call(env, 2), 140);
+    case 140:
+        blisp_push(lval_copy(code->consts[20]));
+    case 142:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 145);
+    case 145:
+        blisp_push(lval_copy(code->consts[14]));
+    case 147:
+        blisp_push(lval_copy(code->consts[15]));
+        BLISP_DO(lvm_do_call(env, 3), 150);
+    case 150:
+    l150:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 153);
+    case 153:
+        BLISP_DO(lvm_do_call(env, 2), 155);
+    case 155:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 155);
+    case 157:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 157);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 20, 0, 0, 19, 1, 1, 24, 0, 2, 19, 1, 1, 24, 1, 2, 19, 1, 1, 24, 2, 2, 9, 2, 0, 17, 3, 1, 20, 4, 1, 22, 1, 3, 6, 2, 24, 4, 2, 0, 5, 17, 3, 1, 6, 2, 20, 0, 5, 22, 0, 6, 17, 3, 1, 19, 1, 1, 24, 7, 2, 19, 1, 1, 24, 8, 2, 19, 1, 1, 24, 9, 2, 19, 1, 1, 24, 10, 2, 10, 6, 0, 11, 7, 0, 17, 3, 1, 6, 2, 19, 1, 1, 24, 11, 2, 3, 8, 134, 19, 1, 1, 24, 12, 2, 0, 13, 17, 3, 1, 4, 14, 15, 117, 0, 16, 5, 150, 19, 1, 1, 24, 17, 2, 19, 1, 1, 24, 18, 2, 12, 9, 0, 5, 150, 19, 1, 1, 24, 19, 2, 0, 20, 17, 3, 1, 0, 14, 24, 15, 3, 17, 3, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_7[] = { "&&", "nth", "+", "==", "%", "||", "-", "*", "if", "/" };
+
+// \ {build n acc}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l44, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l56;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+        blisp_push(lval_copy(env->vals[2]));
+    case 28:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 31);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 31);
+    case 31:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 34:
+        BLISP_DO(lvm_do_call(env, 2), 36);
+    case 36:
+        BLISP_DO(lvm_do_call(env, 1), 38);
+    case 38:
+        BLISP_DO(lvm_do_call(env, 2), 40);
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 40);
+    case 42:
+        goto l56;
+    case 44:
+    l44:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 47:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 50);
+    case 50:
+        blisp_push(lval_copy(code->consts[1]));
+    case 52:
+        blisp_push(lval_copy(code->consts[2]));
+    case 54:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 54);
+    case 56:
+    l56:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 56);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 3, 0, 44, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 56, 21, 0, 1, 0, 3, 10, 2, 1, 19, 3, 2, 20, 4, 4, 22, 1, 4, 6, 2, 6, 1, 6, 2, 7, 2, 5, 56, 22, 1, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_8[] = { "if", "==", "-", "join", "list" };
+
+// \ {n acc}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l44, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l56;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+        blisp_push(lval_copy(env->vals[1]));
+    case 28:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 31);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 31);
+    case 31:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 34:
+        BLISP_DO(lvm_do_call(env, 2), 36);
+    case 36:
+        BLISP_DO(lvm_do_call(env, 1), 38);
+    case 38:
+        BLISP_DO(lvm_do_call(env, 2), 40);
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 40);
+    case 42:
+        goto l56;
+    case 44:
+    l44:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 47:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 50);
+    case 50:
+        blisp_push(lval_copy(code->consts[1]));
+    case 52:
+        blisp_push(lval_copy(code->consts[2]));
+    case 54:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 54);
+    case 56:
+    l56:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 56);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 3, 0, 44, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 56, 19, 2, 0, 0, 3, 10, 3, 1, 19, 4, 1, 20, 5, 5, 22, 0, 4, 6, 2, 6, 1, 6, 2, 7, 2, 5, 56, 22, 0, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_9[] = { "if", "==", "build", "-", "join", "list" };
+
+// \ {acc}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        blisp_push(lval_copy(env->vals[0]));
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 14);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 19);
+    case 19:
+        BLISP_DO(lvm_do_call(env, 1), 21);
+    case 21:
+        BLISP_DO(lvm_do_call(env, 2), 23);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 23);
+    case 25:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 25);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 20, 0, 1, 0, 0, 10, 2, 1, 19, 3, 0, 20, 4, 4, 2, 1, 24, 1, 2, 6, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_10[] = { "build", "n", "-", "join", "list" };
+
+// \ {}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 14);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 19);
+    case 19:
+        BLISP_DO(lvm_do_call(env, 1), 21);
+    case 21:
+        BLISP_DO(lvm_do_call(env, 2), 23);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 23);
+    case 25:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 25);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 20, 5, 5, 2, 1, 24, 1, 2, 6, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_11[] = { "build", "n", "-", "join", "acc", "list" };
+
+// \ {big}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(code->consts[0]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 0, 0, 8 };
+static char* const blisp_names_12[] = { NULL };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("field"), lval_sym("n"), lval_sym("i")), blisp_list(lval_qexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("mem"), lval_sym("n")), lval_sym("i"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 8, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(1)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(8)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(20)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(64)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(65)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(2048)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(2049)), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("mem"), lval_int(INT64_C(-1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("agrees"), lval_sym("n")), blisp_list(lval_qexpr(), 3, lval_sym("check"), lval_sym("n"), blisp_list(lval_sexpr(), 2, lval_sym("mem"), lval_sym("n")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("check"), lval_sym("n"), lval_sym("s")), blisp_list(lval_qexpr(), 3, lval_sym("&&"), blisp_list(lval_sexpr(), 3, lval_sym("&&"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 3, lval_sym("+"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(5))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(7))))), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("%"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(3))), lval_int(INT64_C(65536))), lval_int(INT64_C(0)))), blisp_list(lval_sexpr(), 3, lval_sym("&&"), blisp_list(lval_sexpr(), 3, lval_sym("||"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(5))), blisp_list(lval_sexpr(), 3, lval_sym("*"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("-"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(11))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(13))))))), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(9))), blisp_list(lval_sexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(3))), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 3, lval_sym("/"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(7))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(3))))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("build"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("build"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("acc"), blisp_list(lval_sexpr(), 2, lval_sym("list"), blisp_list(lval_sexpr(), 3, lval_sym("list"), lval_sym("n"), lval_str("cell"))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("big")), blisp_list(lval_sexpr(), 3, lval_sym("build"), lval_int(INT64_C(4000)), lval_qexpr())));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("gc"), lval_bool(true)));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("agrees"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 2, lval_sym("agrees"), lval_int(INT64_C(8))), blisp_list(lval_sexpr(), 2, lval_sym("agrees"), lval_int(INT64_C(24))), blisp_list(lval_sexpr(), 2, lval_sym("agrees"), lval_int(INT64_C(40))), blisp_list(lval_sexpr(), 2, lval_sym("agrees"), lval_int(INT64_C(128))), blisp_list(lval_sexpr(), 2, lval_sym("agrees"), lval_int(INT64_C(1024)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("held")), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(0)), lval_int(INT64_C(5)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("big")), lval_qexpr()));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("gc"), lval_bool(true)));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("<"), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(0)), lval_int(INT64_C(5))), lval_sym("held")), blisp_list(lval_sexpr(), 3, lval_sym(">"), blisp_list(lval_sexpr(), 3, lval_sym("field"), lval_int(INT64_C(0)), lval_int(INT64_C(13))), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 11, blisp_names_2, 2, blisp_code_2);
+    lvm_register(blisp_ops_3, 11, blisp_names_3, 2, blisp_code_3);
+    lvm_register(blisp_ops_4, 11, blisp_names_4, 2, blisp_code_4);
+    lvm_register(blisp_ops_5, 11, blisp_names_5, 2, blisp_code_5);
+    lvm_register(blisp_ops_6, 158, blisp_names_6, 10, blisp_code_6);
+    lvm_register(blisp_ops_7, 158, blisp_names_7, 10, blisp_code_7);
+    lvm_register(blisp_ops_8, 57, blisp_names_8, 5, blisp_code_8);
+    lvm_register(blisp_ops_9, 57, blisp_names_9, 6, blisp_code_9);
+    lvm_register(blisp_ops_10, 26, blisp_names_10, 5, blisp_code_10);
+    lvm_register(blisp_ops_11, 26, blisp_names_11, 6, blisp_code_11);
+    lvm_register(blisp_ops_12, 3, blisp_names_12, 0, blisp_code_12);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,742 @@
+// Generated by blisp --emit-c from test/numeric-refs.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {step x v n acc}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l61, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[4]));
+    case 15:
+        goto l73;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 23:
+        BLISP_DO(lvm_do_typed[2](env, code->names[2], 0), 26);
+    case 26:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 29);
+    case 29:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 32:
+        blisp_push(lval_copy(code->consts[4]));
+    case 34:
+        BLISP_DO(lvm_do_typed[2](env, code->names[2], 0), 37);
+    case 37:
+        BLISP_DO(lvm_do_typed[1](env, code->names[4], 1), 40);
+    case 40:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 43:
+        BLISP_DO(lvm_do_typed[1](env, code->names[4], 1), 46);
+    case 46:
+        blisp_push(lval_copy(env->vals[4]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 49:
+        blisp_push(lval_copy(env->vals[1]));
+    case 51:
+        BLISP_DO(lvm_do_typed[2](env, code->names[2], 0), 54);
+    case 54:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 57);
+    case 57:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 57);
+    case 59:
+        goto l73;
+    case 61:
+    l61:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 64:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 67);
+    case 67:
+        blisp_push(lval_copy(code->consts[1]));
+    case 69:
+        blisp_push(lval_copy(code->consts[2]));
+    case 71:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 71);
+    case 73:
+    l73:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 73);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 3, 0, 61, 22, 3, 0, 17, 1, 1, 4, 1, 2, 17, 1, 4, 5, 73, 21, 0, 1, 22, 2, 3, 11, 2, 0, 9, 3, 1, 21, 2, 1, 0, 4, 11, 2, 0, 10, 4, 1, 22, 3, 5, 10, 4, 1, 21, 4, 1, 1, 1, 11, 2, 0, 9, 3, 1, 7, 4, 5, 73, 22, 3, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_2[] = { "if", "==", "*", "+", "-" };
+
+// \ {x v n acc}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l61, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[3]));
+    case 15:
+        goto l73;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 23:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 26);
+    case 26:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 29);
+    case 29:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 32:
+        blisp_push(lval_copy(code->consts[4]));
+    case 34:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 37);
+    case 37:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 40);
+    case 40:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 43:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 46);
+    case 46:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 49:
+        blisp_push(lval_copy(env->vals[0]));
+    case 51:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 54);
+    case 54:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 57);
+    case 57:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 57);
+    case 59:
+        goto l73;
+    case 61:
+    l61:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 64:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 67);
+    case 67:
+        blisp_push(lval_copy(code->consts[1]));
+    case 69:
+        blisp_push(lval_copy(code->consts[2]));
+    case 71:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 71);
+    case 73:
+    l73:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 73);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 61, 22, 2, 0, 17, 1, 1, 4, 1, 2, 17, 1, 3, 5, 73, 19, 2, 0, 22, 1, 3, 11, 3, 0, 9, 4, 1, 21, 1, 0, 0, 4, 11, 3, 0, 10, 5, 1, 22, 2, 5, 10, 5, 1, 21, 3, 0, 1, 0, 11, 3, 0, 9, 4, 1, 7, 4, 5, 73, 22, 2, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "==", "step", "*", "+", "-" };
+
+// \ {acc}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        blisp_push(lval_copy(code->consts[0]));
+    case 7:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 10);
+    case 10:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        blisp_push(lval_copy(code->consts[1]));
+    case 18:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 21);
+    case 21:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 24);
+    case 24:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 26);
+    case 26:
+        blisp_push(lval_copy(code->consts[2]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 31);
+    case 31:
+        blisp_push(lval_copy(env->vals[0]));
+    case 33:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 36);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 36);
+    case 36:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 39);
+    case 39:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 42);
+    case 42:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 42);
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 44);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 20, 0, 1, 2, 2, 0, 0, 11, 3, 0, 9, 4, 1, 20, 2, 1, 0, 1, 11, 3, 0, 10, 5, 1, 2, 6, 0, 2, 10, 5, 1, 1, 0, 20, 1, 1, 11, 3, 0, 9, 4, 1, 7, 4, 8 };
+static char* const blisp_names_4[] = { "step", "x", "v", "*", "+", "-", "n" };
+
+// \ {}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        blisp_push(lval_copy(code->consts[0]));
+    case 7:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 10);
+    case 10:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        blisp_push(lval_copy(code->consts[1]));
+    case 18:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 21);
+    case 21:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 24);
+    case 24:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 26);
+    case 26:
+        blisp_push(lval_copy(code->consts[2]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 34);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 34);
+    case 34:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 36);
+    case 36:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 0), 39);
+    case 39:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 42);
+    case 42:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 42);
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 44);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 2, 2, 0, 0, 11, 3, 0, 9, 4, 1, 20, 2, 1, 0, 1, 11, 3, 0, 10, 5, 1, 2, 6, 0, 2, 10, 5, 1, 20, 7, 1, 2, 1, 11, 3, 0, 9, 4, 1, 7, 4, 8 };
+static char* const blisp_names_5[] = { "step", "x", "v", "*", "+", "-", "n", "acc" };
+
+// \ {fail x}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 3:
+        BLISP_DO(lvm_do_typed[2](env, code->names[0], 0), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 1), 11);
+    case 11:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 14);
+    case 14:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 14);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 22, 1, 0, 11, 0, 0, 2, 1, 24, 1, 1, 9, 2, 1, 8 };
+static char* const blisp_names_6[] = { "*", "error", "+" };
+
+// \ {x}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 3:
+        BLISP_DO(lvm_do_typed[2](env, code->names[0], 0), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 8);
+    case 8:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 1), 11);
+    case 11:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 14);
+    case 14:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 14);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 22, 0, 0, 11, 0, 0, 2, 1, 24, 1, 1, 9, 2, 1, 8 };
+static char* const blisp_names_7[] = { "*", "error", "+" };
+
+// \ {fails n}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l37, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l49;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+        BLISP_DO(lvm_do_call(env, 1), 23);
+    case 23:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        blisp_push(lval_copy(code->consts[4]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[4], 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_call(env, 1), 33);
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        goto l49;
+    case 37:
+    l37:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 40:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 43);
+    case 43:
+        blisp_push(lval_copy(code->consts[1]));
+    case 45:
+        blisp_push(lval_copy(code->consts[2]));
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+    l49:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 49);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 3, 0, 37, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 49, 20, 2, 3, 24, 3, 1, 21, 0, 1, 0, 4, 10, 4, 1, 6, 1, 7, 2, 5, 49, 22, 1, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_8[] = { "if", "==", "do", "fail", "-" };
+
+// \ {n}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l37, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[0]));
+    case 15:
+        goto l49;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+        BLISP_DO(lvm_do_call(env, 1), 23);
+    case 23:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 26);
+        blisp_push(lval_copy(env->vals[0]));
+    case 26:
+        blisp_push(lval_copy(code->consts[4]));
+    case 28:
+        BLISP_DO(lvm_do_typed[1](env, code->names[5], 1), 31);
+    case 31:
+        BLISP_DO(lvm_do_call(env, 1), 33);
+    case 33:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 33);
+    case 35:
+        goto l49;
+    case 37:
+    l37:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 40:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 43);
+    case 43:
+        blisp_push(lval_copy(code->consts[1]));
+    case 45:
+        blisp_push(lval_copy(code->consts[2]));
+    case 47:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 47);
+    case 49:
+    l49:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 49);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 3, 0, 37, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 0, 5, 49, 20, 2, 3, 24, 3, 1, 19, 4, 0, 0, 4, 10, 5, 1, 6, 1, 7, 2, 5, 49, 22, 0, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_9[] = { "if", "==", "do", "fail", "fails", "-" };
+
+// \ {n}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        blisp_push(lval_copy(env->vals[0]));
+    case 9:
+        blisp_push(lval_copy(code->consts[1]));
+    case 11:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 14);
+    case 14:
+        BLISP_DO(lvm_do_call(env, 1), 16);
+    case 16:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 16);
+    case 18:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 18);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 20, 0, 1, 24, 0, 1, 19, 2, 0, 0, 1, 10, 3, 1, 6, 1, 7, 2, 8 };
+static char* const blisp_names_10[] = { "do", "fail", "fails", "-" };
+
+// \ {}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(code->consts[1]));
+    case 11:
+        BLISP_DO(lvm_do_typed[1](env, code->names[4], 1), 14);
+    case 14:
+        BLISP_DO(lvm_do_call(env, 1), 16);
+    case 16:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 16);
+    case 18:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 18);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 20, 0, 1, 24, 0, 1, 20, 2, 3, 0, 1, 10, 4, 1, 6, 1, 7, 2, 8 };
+static char* const blisp_names_11[] = { "do", "fail", "fails", "n", "-" };
+
+// \ {do a b}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[2]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 1, 2, 8 };
+static char* const blisp_names_12[] = { NULL };
+
+// \ {a b}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 1, 1, 8 };
+static char* const blisp_names_13[] = { NULL };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 5, lval_sym("step"), lval_sym("x"), lval_sym("v"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 5, lval_sym("step"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("x"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("v"), lval_num(0x1.0624dd2f1a9fcp-10))), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("v"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("x"), lval_num(0x1.0624dd2f1a9fcp-10))), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("x"), lval_sym("x")))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 5, lval_sym("step"), lval_num(0x1p+0), lval_num(0x0p+0), lval_int(INT64_C(30000)), lval_num(0x0p+0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("fail"), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("+"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("x"), lval_num(0x1p+1)), blisp_list(lval_sexpr(), 2, lval_sym("error"), lval_str("failed")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("fails"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("n")), blisp_list(lval_qexpr(), 3, lval_sym("do"), blisp_list(lval_sexpr(), 2, lval_sym("fail"), lval_num(0x1.8p+0)), blisp_list(lval_sexpr(), 2, lval_sym("fails"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("do"), lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 1, lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("fails"), lval_int(INT64_C(3)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 74, blisp_names_2, 5, blisp_code_2);
+    lvm_register(blisp_ops_3, 74, blisp_names_3, 6, blisp_code_3);
+    lvm_register(blisp_ops_4, 45, blisp_names_4, 7, blisp_code_4);
+    lvm_register(blisp_ops_5, 45, blisp_names_5, 8, blisp_code_5);
+    lvm_register(blisp_ops_6, 15, blisp_names_6, 3, blisp_code_6);
+    lvm_register(blisp_ops_7, 15, blisp_names_7, 3, blisp_code_7);
+    lvm_register(blisp_ops_8, 50, blisp_names_8, 5, blisp_code_8);
+    lvm_register(blisp_ops_9, 50, blisp_names_9, 6, blisp_code_9);
+    lvm_register(blisp_ops_10, 19, blisp_names_10, 4, blisp_code_10);
+    lvm_register(blisp_ops_11, 19, blisp_names_11, 5, blisp_code_11);
+    lvm_register(blisp_ops_12, 3, blisp_names_12, 0, blisp_code_12);
+    lvm_register(blisp_ops_13, 3, blisp_names_13, 0, blisp_code_13);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
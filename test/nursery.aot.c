@@ -0,0 +1,1180 @@
+// Generated by blisp --emit-c from test/nursery.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {second a b}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[2]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 1, 2, 8 };
+static char* const blisp_names_2[] = { NULL };
+
+// \ {a b}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 1, 1, 8 };
+static char* const blisp_names_3[] = { NULL };
+
+// \ {stat name}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_TEST(lvm_do_if(env, code->names[2]), l27, 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[1]));
+    case 12:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 15);
+    case 15:
+        BLISP_TEST(blisp_branch(env, &code->consts[2], &code->consts[3]), l23, 19);
+    case 19:
+        blisp_push(lval_copy(code->consts[4]));
+    case 21:
+        goto l38;
+    case 23:
+    l23:
+        blisp_push(lval_copy(code->consts[5]));
+    case 25:
+        goto l38;
+    case 27:
+    l27:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 30:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 33);
+    case 33:
+        blisp_push(lval_copy(code->consts[2]));
+    case 35:
+        blisp_push(lval_copy(code->consts[3]));
+        BLISP_DO(lvm_do_call(env, 3), 38);
+    case 38:
+    l38:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 38);
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 40);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 20, 0, 1, 24, 0, 1, 3, 2, 27, 22, 1, 1, 17, 3, 1, 4, 2, 3, 23, 0, 4, 5, 38, 0, 5, 5, 38, 22, 1, 6, 17, 3, 1, 0, 2, 24, 3, 3, 7, 2, 8 };
+static char* const blisp_names_4[] = { "nth", "gc", "if", "==" };
+
+// \ {name}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_TEST(lvm_do_if(env, code->names[2]), l27, 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[1]));
+    case 12:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 15);
+    case 15:
+        BLISP_TEST(blisp_branch(env, &code->consts[2], &code->consts[3]), l23, 19);
+    case 19:
+        blisp_push(lval_copy(code->consts[4]));
+    case 21:
+        goto l38;
+    case 23:
+    l23:
+        blisp_push(lval_copy(code->consts[5]));
+    case 25:
+        goto l38;
+    case 27:
+    l27:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 30:
+        BLISP_DO(lvm_do_typed[8](env, code->names[3], 1), 33);
+    case 33:
+        blisp_push(lval_copy(code->consts[2]));
+    case 35:
+        blisp_push(lval_copy(code->consts[3]));
+        BLISP_DO(lvm_do_call(env, 3), 38);
+    case 38:
+    l38:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 38);
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 40);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 24, 0, 1, 3, 2, 27, 22, 0, 1, 17, 3, 1, 4, 2, 3, 23, 0, 4, 5, 38, 0, 5, 5, 38, 22, 0, 6, 17, 3, 1, 0, 2, 24, 3, 3, 7, 2, 8 };
+static char* const blisp_names_5[] = { "nth", "gc", "if", "==" };
+
+// \ {promote n acc}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l34, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 9);
+    case 9:
+        blisp_push(lval_copy(code->consts[1]));
+    case 11:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 14);
+    case 14:
+        BLISP_TEST(blisp_branch(env, &code->consts[2], &code->consts[3]), l30, 18);
+    case 18:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 21);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 21);
+    case 21:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 1), 24);
+    case 24:
+        blisp_push(lval_copy(env->vals[2]));
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 26);
+    case 28:
+        goto l51;
+    case 30:
+    l30:
+        blisp_push(lval_copy(env->vals[2]));
+    case 32:
+        goto l51;
+    case 34:
+    l34:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 37);
+        blisp_push(lval_copy(env->vals[1]));
+    case 37:
+        blisp_push(lval_copy(code->consts[5]));
+        BLISP_DO(lvm_do_call(env, 2), 40);
+    case 40:
+        blisp_push(lval_copy(code->consts[6]));
+    case 42:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 45);
+    case 45:
+        blisp_push(lval_copy(code->consts[2]));
+    case 47:
+        blisp_push(lval_copy(code->consts[3]));
+    case 49:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 49);
+    case 51:
+    l51:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 51);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 3, 0, 34, 19, 1, 1, 24, 0, 2, 0, 1, 17, 2, 1, 4, 2, 3, 30, 20, 3, 4, 24, 4, 1, 1, 2, 7, 2, 5, 51, 1, 2, 5, 51, 19, 1, 1, 24, 5, 2, 0, 6, 17, 2, 1, 0, 2, 0, 3, 7, 3, 8 };
+static char* const blisp_names_6[] = { "if", "%", "==", "second", "gc" };
+
+// \ {n acc}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l34, 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 6);
+        blisp_push(lval_copy(env->vals[0]));
+    case 6:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 9);
+    case 9:
+        blisp_push(lval_copy(code->consts[1]));
+    case 11:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 14);
+    case 14:
+        BLISP_TEST(blisp_branch(env, &code->consts[2], &code->consts[3]), l30, 18);
+    case 18:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 21);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 21);
+    case 21:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 1), 24);
+    case 24:
+        blisp_push(lval_copy(env->vals[1]));
+    case 26:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 26);
+    case 28:
+        goto l51;
+    case 30:
+    l30:
+        blisp_push(lval_copy(env->vals[1]));
+    case 32:
+        goto l51;
+    case 34:
+    l34:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 37);
+        blisp_push(lval_copy(env->vals[0]));
+    case 37:
+        blisp_push(lval_copy(code->consts[5]));
+        BLISP_DO(lvm_do_call(env, 2), 40);
+    case 40:
+        blisp_push(lval_copy(code->consts[6]));
+    case 42:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 45);
+    case 45:
+        blisp_push(lval_copy(code->consts[2]));
+    case 47:
+        blisp_push(lval_copy(code->consts[3]));
+    case 49:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 49);
+    case 51:
+    l51:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 51);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 3, 0, 34, 19, 1, 0, 24, 0, 2, 0, 1, 17, 2, 1, 4, 2, 3, 30, 20, 3, 4, 24, 4, 1, 1, 1, 7, 2, 5, 51, 1, 1, 5, 51, 19, 1, 0, 24, 5, 2, 0, 6, 17, 2, 1, 0, 2, 0, 3, 7, 3, 8 };
+static char* const blisp_names_7[] = { "if", "%", "==", "second", "gc" };
+
+// \ {grow n acc}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l49, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l61;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+    case 28:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 31:
+        BLISP_DO(lvm_do_call(env, 2), 33);
+    case 33:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 36);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 36);
+    case 36:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 39:
+        BLISP_DO(lvm_do_call(env, 2), 41);
+    case 41:
+        BLISP_DO(lvm_do_call(env, 1), 43);
+    case 43:
+        BLISP_DO(lvm_do_call(env, 2), 45);
+    case 45:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 45);
+    case 47:
+        goto l61;
+    case 49:
+    l49:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 52:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 55);
+    case 55:
+        blisp_push(lval_copy(code->consts[1]));
+    case 57:
+        blisp_push(lval_copy(code->consts[2]));
+    case 59:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 59);
+    case 61:
+    l61:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 61);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 3, 0, 49, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 61, 21, 0, 1, 0, 3, 10, 2, 1, 20, 3, 4, 21, 1, 2, 6, 2, 20, 5, 5, 22, 1, 4, 6, 2, 6, 1, 6, 2, 7, 2, 5, 61, 22, 1, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_8[] = { "if", "==", "-", "join", "promote", "list" };
+
+// \ {n acc}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l49, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l61;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 28);
+    case 28:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 31:
+        BLISP_DO(lvm_do_call(env, 2), 33);
+    case 33:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 36);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 36);
+    case 36:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 39:
+        BLISP_DO(lvm_do_call(env, 2), 41);
+    case 41:
+        BLISP_DO(lvm_do_call(env, 1), 43);
+    case 43:
+        BLISP_DO(lvm_do_call(env, 2), 45);
+    case 45:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 45);
+    case 47:
+        goto l61;
+    case 49:
+    l49:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 52:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 55);
+    case 55:
+        blisp_push(lval_copy(code->consts[1]));
+    case 57:
+        blisp_push(lval_copy(code->consts[2]));
+    case 59:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 59);
+    case 61:
+    l61:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 61);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 3, 0, 49, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 61, 19, 2, 0, 0, 3, 10, 3, 1, 20, 4, 5, 21, 0, 1, 6, 2, 20, 6, 6, 22, 0, 4, 6, 2, 6, 1, 6, 2, 7, 2, 5, 61, 22, 0, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_9[] = { "if", "==", "grow", "-", "join", "promote", "list" };
+
+// \ {acc}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 14);
+        blisp_push(lval_copy(env->vals[0]));
+    case 14:
+        BLISP_DO(lvm_do_call(env, 2), 16);
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 19);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 19);
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 21);
+    case 21:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 24);
+    case 24:
+        BLISP_DO(lvm_do_call(env, 1), 26);
+    case 26:
+        BLISP_DO(lvm_do_call(env, 2), 28);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 28);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 30);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 19, 1, 0, 6, 2, 20, 5, 5, 2, 1, 24, 1, 2, 6, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_10[] = { "grow", "n", "-", "join", "promote", "list" };
+
+// \ {}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 14);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 14);
+    case 14:
+        BLISP_DO(lvm_do_call(env, 2), 16);
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 19);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 19);
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 21);
+    case 21:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 24);
+    case 24:
+        BLISP_DO(lvm_do_call(env, 1), 26);
+    case 26:
+        BLISP_DO(lvm_do_call(env, 2), 28);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 28);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 30);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 20, 1, 5, 6, 2, 20, 6, 6, 2, 1, 24, 1, 2, 6, 1, 6, 2, 7, 2, 8 };
+static char* const blisp_names_11[] = { "grow", "n", "-", "join", "promote", "acc", "list" };
+
+// \ {check xs i sum}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l52, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+    case 5:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 8);
+        blisp_push(lval_copy(env->vals[1]));
+    case 8:
+        BLISP_DO(lvm_do_call(env, 1), 10);
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[3]));
+    case 19:
+        goto l68;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 24:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 27:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 30);
+    case 30:
+        blisp_push(lval_copy(env->vals[3]));
+    case 32:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 35);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 35);
+    case 35:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 38);
+        blisp_push(lval_copy(env->vals[1]));
+    case 38:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 2), 41);
+    case 41:
+        BLISP_DO(lvm_do_call(env, 1), 43);
+    case 43:
+        BLISP_DO(lvm_do_call(env, 1), 45);
+    case 45:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 48);
+    case 48:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 48);
+    case 50:
+        goto l68;
+    case 52:
+    l52:
+        blisp_push(lval_copy(env->vals[2]));
+    case 54:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 57);
+        blisp_push(lval_copy(env->vals[1]));
+    case 57:
+        BLISP_DO(lvm_do_call(env, 1), 59);
+    case 59:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 62);
+    case 62:
+        blisp_push(lval_copy(code->consts[0]));
+    case 64:
+        blisp_push(lval_copy(code->consts[1]));
+    case 66:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 66);
+    case 68:
+    l68:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 68);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 3, 0, 52, 1, 2, 19, 1, 1, 6, 1, 17, 2, 1, 4, 0, 1, 21, 1, 3, 5, 68, 21, 0, 1, 22, 2, 2, 9, 3, 1, 1, 3, 20, 4, 5, 19, 6, 1, 23, 2, 2, 6, 1, 6, 1, 9, 3, 1, 7, 3, 5, 68, 1, 2, 19, 1, 1, 6, 1, 17, 2, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_12[] = { "if", "len", "==", "+", "eval", "head", "nth" };
+
+// \ {xs i sum}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l52, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+    case 5:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 8);
+        blisp_push(lval_copy(env->vals[0]));
+    case 8:
+        BLISP_DO(lvm_do_call(env, 1), 10);
+    case 10:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 13);
+    case 13:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l21, 17);
+    case 17:
+        blisp_push(lval_copy(env->vals[2]));
+    case 19:
+        goto l68;
+    case 21:
+    l21:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 24);
+        blisp_push(lval_copy(env->vals[0]));
+    case 24:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 27:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 30);
+    case 30:
+        blisp_push(lval_copy(env->vals[2]));
+    case 32:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 35);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 35);
+    case 35:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 38);
+        blisp_push(lval_copy(env->vals[0]));
+    case 38:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 41);
+    case 41:
+        BLISP_DO(lvm_do_call(env, 1), 43);
+    case 43:
+        BLISP_DO(lvm_do_call(env, 1), 45);
+    case 45:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 48);
+    case 48:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 48);
+    case 50:
+        goto l68;
+    case 52:
+    l52:
+        blisp_push(lval_copy(env->vals[1]));
+    case 54:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 57);
+        blisp_push(lval_copy(env->vals[0]));
+    case 57:
+        BLISP_DO(lvm_do_call(env, 1), 59);
+    case 59:
+        BLISP_DO(lvm_do_typed[8](env, code->names[2], 1), 62);
+    case 62:
+        blisp_push(lval_copy(code->consts[0]));
+    case 64:
+        blisp_push(lval_copy(code->consts[1]));
+    case 66:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 66);
+    case 68:
+    l68:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 68);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 3, 0, 52, 1, 1, 19, 1, 0, 6, 1, 17, 2, 1, 4, 0, 1, 21, 1, 2, 5, 68, 19, 3, 0, 22, 1, 2, 9, 4, 1, 1, 2, 20, 5, 6, 19, 7, 0, 23, 1, 2, 6, 1, 6, 1, 9, 4, 1, 7, 3, 5, 68, 1, 1, 19, 1, 0, 6, 1, 17, 2, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_13[] = { "if", "len", "==", "check", "+", "eval", "head", "nth" };
+
+// \ {sum}
+static int blisp_code_14(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        blisp_push(lval_copy(code->consts[0]));
+    case 7:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 10);
+    case 10:
+        blisp_push(lval_copy(env->vals[0]));
+    case 12:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 15);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 15);
+    case 15:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 18);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 18);
+    case 18:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+    case 20:
+        BLISP_DO(lvm_do_call(env, 2), 22);
+    case 22:
+        BLISP_DO(lvm_do_call(env, 1), 24);
+    case 24:
+        BLISP_DO(lvm_do_call(env, 1), 26);
+    case 26:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 29);
+    case 29:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 29);
+    case 31:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 31);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_14[] = { 20, 0, 1, 2, 2, 0, 0, 9, 3, 1, 1, 0, 20, 4, 5, 20, 6, 1, 2, 2, 6, 2, 6, 1, 6, 1, 9, 3, 1, 7, 3, 8 };
+static char* const blisp_names_14[] = { "check", "xs", "i", "+", "eval", "head", "nth" };
+
+// \ {}
+static int blisp_code_15(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        blisp_push(lval_copy(code->consts[0]));
+    case 7:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[7]), 16);
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 19);
+        BLISP_DO(lvm_do_global(env, code->names[2]), 19);
+    case 19:
+        BLISP_DO(lvm_do_call(env, 2), 21);
+    case 21:
+        BLISP_DO(lvm_do_call(env, 1), 23);
+    case 23:
+        BLISP_DO(lvm_do_call(env, 1), 25);
+    case 25:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 28);
+    case 28:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 28);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 30);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_15[] = { 20, 0, 1, 2, 2, 0, 0, 9, 3, 1, 20, 4, 5, 20, 6, 7, 20, 1, 2, 6, 2, 6, 1, 6, 1, 9, 3, 1, 7, 3, 8 };
+static char* const blisp_names_15[] = { "check", "xs", "i", "+", "sum", "eval", "head", "nth" };
+
+// \ {rebind n}
+static int blisp_code_16(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l54, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 15);
+    case 15:
+        goto l66;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 22);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 22);
+    case 22:
+        blisp_push(lval_copy(code->consts[3]));
+    case 24:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 27);
+        blisp_push(lval_copy(env->vals[1]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 29);
+    case 29:
+        blisp_push(lval_copy(code->consts[4]));
+    case 31:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 34);
+        blisp_push(lval_copy(env->vals[1]));
+    case 34:
+        BLISP_DO(lvm_do_call(env, 1), 36);
+    case 36:
+        BLISP_DO(lvm_do_call(env, 2), 38);
+    case 38:
+        BLISP_DO(lvm_do_call(env, 2), 40);
+    case 40:
+        BLISP_DO(lvm_do_call(env, 2), 42);
+    case 42:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 45:
+        BLISP_DO(lvm_do_typed[1](env, code->names[7], 1), 48);
+    case 48:
+        BLISP_DO(lvm_do_call(env, 2), 50);
+    case 50:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 50);
+    case 52:
+        goto l66;
+    case 54:
+    l54:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 57:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 60);
+    case 60:
+        blisp_push(lval_copy(code->consts[1]));
+    case 62:
+        blisp_push(lval_copy(code->consts[2]));
+    case 64:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 64);
+    case 66:
+    l66:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 66);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_16[] = { 3, 0, 54, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 2, 2, 5, 66, 1, 0, 20, 3, 4, 0, 3, 19, 5, 1, 2, 6, 0, 4, 19, 5, 1, 6, 1, 6, 2, 6, 2, 6, 2, 22, 1, 5, 10, 7, 1, 6, 2, 7, 1, 5, 66, 22, 1, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_16[] = { "if", "==", "last", "second", "def", "list", "join", "-" };
+
+// \ {n}
+static int blisp_code_17(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l54, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 15);
+    case 15:
+        goto l66;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 20);
+    case 20:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 22);
+    case 22:
+        blisp_push(lval_copy(code->consts[3]));
+    case 24:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 27);
+        blisp_push(lval_copy(env->vals[0]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 29);
+    case 29:
+        blisp_push(lval_copy(code->consts[4]));
+    case 31:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 34);
+        blisp_push(lval_copy(env->vals[0]));
+    case 34:
+        BLISP_DO(lvm_do_call(env, 1), 36);
+    case 36:
+        BLISP_DO(lvm_do_call(env, 2), 38);
+    case 38:
+        BLISP_DO(lvm_do_call(env, 2), 40);
+    case 40:
+        BLISP_DO(lvm_do_call(env, 2), 42);
+    case 42:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 45:
+        BLISP_DO(lvm_do_typed[1](env, code->names[8], 1), 48);
+    case 48:
+        BLISP_DO(lvm_do_call(env, 2), 50);
+    case 50:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 50);
+    case 52:
+        goto l66;
+    case 54:
+    l54:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[6]));
+    case 57:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 60);
+    case 60:
+        blisp_push(lval_copy(code->consts[1]));
+    case 62:
+        blisp_push(lval_copy(code->consts[2]));
+    case 64:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 64);
+    case 66:
+    l66:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 66);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_17[] = { 3, 0, 54, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 2, 2, 5, 66, 20, 3, 4, 2, 5, 0, 3, 19, 6, 0, 2, 7, 0, 4, 19, 6, 0, 6, 1, 6, 2, 6, 2, 6, 2, 22, 0, 5, 10, 8, 1, 6, 2, 7, 1, 5, 66, 22, 0, 6, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_17[] = { "if", "==", "last", "rebind", "second", "def", "list", "join", "-" };
+
+// \ {last}
+static int blisp_code_18(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        blisp_push(lval_copy(code->consts[0]));
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 12);
+    case 12:
+        blisp_push(lval_copy(code->consts[1]));
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 17);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 17);
+    case 17:
+        BLISP_DO(lvm_do_call(env, 1), 19);
+    case 19:
+        BLISP_DO(lvm_do_call(env, 2), 21);
+    case 21:
+        BLISP_DO(lvm_do_call(env, 2), 23);
+    case 23:
+        BLISP_DO(lvm_do_call(env, 2), 25);
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 27);
+    case 27:
+        blisp_push(lval_copy(code->consts[2]));
+    case 29:
+        BLISP_DO(lvm_do_typed[1](env, code->names[6], 1), 32);
+    case 32:
+        BLISP_DO(lvm_do_call(env, 2), 34);
+    case 34:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 34);
+    case 36:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 36);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_18[] = { 20, 0, 1, 2, 2, 0, 0, 20, 3, 4, 2, 5, 0, 1, 20, 3, 4, 6, 1, 6, 2, 6, 2, 6, 2, 2, 4, 0, 2, 10, 6, 1, 6, 2, 7, 1, 8 };
+static char* const blisp_names_18[] = { "rebind", "second", "def", "list", "n", "join", "-" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("second"), lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 1, lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("stat"), lval_sym("name")), blisp_list(lval_qexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("gc"), lval_bool(false)), blisp_list(lval_sexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("name"), lval_str("minor")), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(9))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(11)))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("minor")), blisp_list(lval_sexpr(), 2, lval_sym("stat"), lval_str("minor"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("promoted")), blisp_list(lval_sexpr(), 2, lval_sym("stat"), lval_str("promoted"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("promote"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("%"), lval_sym("n"), lval_int(INT64_C(100))), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 3, lval_sym("second"), blisp_list(lval_sexpr(), 2, lval_sym("gc"), lval_bool(true)), lval_sym("acc")), blisp_list(lval_qexpr(), 1, lval_sym("acc")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("grow"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("grow"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_sexpr(), 3, lval_sym("promote"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_sexpr(), 2, lval_sym("list"), blisp_list(lval_sexpr(), 3, lval_sym("list"), lval_sym("n"), lval_str("young"))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("check"), lval_sym("xs"), lval_sym("i"), lval_sym("sum")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("xs"))), blisp_list(lval_qexpr(), 1, lval_sym("sum")), blisp_list(lval_qexpr(), 4, lval_sym("check"), lval_sym("xs"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("i"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("sum"), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 2, lval_sym("head"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("xs"), lval_sym("i")))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_sexpr(), 3, lval_sym("grow"), lval_int(INT64_C(1500)), lval_qexpr())));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("xs")), blisp_list(lval_sexpr(), 4, lval_sym("check"), lval_sym("xs"), lval_int(INT64_C(0)), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("xs"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("xs"), lval_int(INT64_C(1499)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("rebind"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("last")), blisp_list(lval_qexpr(), 2, lval_sym("rebind"), blisp_list(lval_sexpr(), 3, lval_sym("second"), blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("last")), blisp_list(lval_sexpr(), 3, lval_sym("list"), lval_sym("n"), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_qexpr(), 1, lval_sym("a")), blisp_list(lval_sexpr(), 2, lval_sym("list"), lval_sym("n"))))), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("rebind"), lval_int(INT64_C(5000))), lval_sym("last")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym(">"), blisp_list(lval_sexpr(), 2, lval_sym("stat"), lval_str("minor")), lval_sym("minor")), blisp_list(lval_sexpr(), 3, lval_sym(">"), blisp_list(lval_sexpr(), 2, lval_sym("stat"), lval_str("promoted")), lval_sym("promoted"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 3, blisp_names_2, 0, blisp_code_2);
+    lvm_register(blisp_ops_3, 3, blisp_names_3, 0, blisp_code_3);
+    lvm_register(blisp_ops_4, 41, blisp_names_4, 4, blisp_code_4);
+    lvm_register(blisp_ops_5, 41, blisp_names_5, 4, blisp_code_5);
+    lvm_register(blisp_ops_6, 52, blisp_names_6, 5, blisp_code_6);
+    lvm_register(blisp_ops_7, 52, blisp_names_7, 5, blisp_code_7);
+    lvm_register(blisp_ops_8, 62, blisp_names_8, 6, blisp_code_8);
+    lvm_register(blisp_ops_9, 62, blisp_names_9, 7, blisp_code_9);
+    lvm_register(blisp_ops_10, 31, blisp_names_10, 6, blisp_code_10);
+    lvm_register(blisp_ops_11, 31, blisp_names_11, 7, blisp_code_11);
+    lvm_register(blisp_ops_12, 69, blisp_names_12, 7, blisp_code_12);
+    lvm_register(blisp_ops_13, 69, blisp_names_13, 8, blisp_code_13);
+    lvm_register(blisp_ops_14, 32, blisp_names_14, 7, blisp_code_14);
+    lvm_register(blisp_ops_15, 31, blisp_names_15, 8, blisp_code_15);
+    lvm_register(blisp_ops_16, 67, blisp_names_16, 8, blisp_code_16);
+    lvm_register(blisp_ops_17, 67, blisp_names_17, 9, blisp_code_17);
+    lvm_register(blisp_ops_18, 37, blisp_names_18, 7, blisp_code_18);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
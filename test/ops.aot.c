@@ -0,0 +1,702 @@
+// Generated by blisp --emit-c from test/ops.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {arith x y}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[1], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 11:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 17:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 1), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 23:
+        BLISP_DO(lvm_do_typed[3](env, code->names[4], 1), 26);
+    case 26:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 29);
+        blisp_push(lval_copy(env->vals[1]));
+    case 29:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 2), 32);
+    case 32:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 35);
+        blisp_push(lval_copy(env->vals[1]));
+    case 35:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 38);
+    case 38:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 41);
+        blisp_push(lval_copy(env->vals[1]));
+    case 41:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 2), 44);
+    case 44:
+        BLISP_DO(lvm_do_global(env, code->names[8]), 47);
+        blisp_push(lval_copy(env->vals[1]));
+    case 47:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 2), 50);
+    case 50:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 53);
+        blisp_push(lval_copy(env->vals[1]));
+    case 53:
+        BLISP_DO(lvm_do_call(env, 1), 55);
+    case 55:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 55);
+    case 57:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 57);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 19, 0, 1, 1, 2, 9, 1, 1, 21, 1, 2, 10, 2, 1, 21, 1, 2, 11, 3, 1, 21, 1, 2, 12, 4, 1, 19, 5, 1, 23, 2, 2, 19, 6, 1, 24, 0, 2, 19, 7, 1, 23, 2, 2, 19, 8, 1, 23, 2, 2, 19, 2, 1, 6, 1, 7, 9, 8 };
+static char* const blisp_names_2[] = { "list", "+", "-", "*", "/", "%", "^", "min", "max" };
+
+// \ {x y}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[1], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 11:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 17:
+        BLISP_DO(lvm_do_typed[2](env, code->names[3], 1), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 23:
+        BLISP_DO(lvm_do_typed[3](env, code->names[4], 1), 26);
+    case 26:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 29);
+        blisp_push(lval_copy(env->vals[0]));
+    case 29:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 32);
+    case 32:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 35);
+        blisp_push(lval_copy(env->vals[0]));
+    case 35:
+        blisp_push(lval_copy(code->consts[0]));
+        BLISP_DO(lvm_do_call(env, 2), 38);
+    case 38:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 41);
+        blisp_push(lval_copy(env->vals[0]));
+    case 41:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 44);
+    case 44:
+        BLISP_DO(lvm_do_global(env, code->names[8]), 47);
+        blisp_push(lval_copy(env->vals[0]));
+    case 47:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 50);
+    case 50:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 53);
+        blisp_push(lval_copy(env->vals[0]));
+    case 53:
+        BLISP_DO(lvm_do_call(env, 1), 55);
+    case 55:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 55);
+    case 57:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 57);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 19, 0, 0, 1, 1, 9, 1, 1, 21, 0, 1, 10, 2, 1, 21, 0, 1, 11, 3, 1, 21, 0, 1, 12, 4, 1, 19, 5, 0, 23, 1, 2, 19, 6, 0, 24, 0, 2, 19, 7, 0, 23, 1, 2, 19, 8, 0, 23, 1, 2, 19, 2, 0, 6, 1, 7, 9, 8 };
+static char* const blisp_names_3[] = { "list", "+", "-", "*", "/", "%", "^", "min", "max" };
+
+// \ {order x y}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+    case 5:
+        BLISP_DO(lvm_do_typed[5](env, code->names[1], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 11:
+        BLISP_DO(lvm_do_typed[4](env, code->names[2], 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 17:
+        BLISP_DO(lvm_do_typed[7](env, code->names[3], 1), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 23:
+        BLISP_DO(lvm_do_typed[6](env, code->names[4], 1), 26);
+    case 26:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 29:
+        BLISP_DO(lvm_do_typed[8](env, code->names[5], 1), 32);
+    case 32:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 35:
+        BLISP_DO(lvm_do_typed[9](env, code->names[6], 1), 38);
+    case 38:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 38);
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 40);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 19, 0, 1, 1, 2, 14, 1, 1, 21, 1, 2, 13, 2, 1, 21, 1, 2, 16, 3, 1, 21, 1, 2, 15, 4, 1, 21, 1, 2, 17, 5, 1, 21, 1, 2, 18, 6, 1, 7, 6, 8 };
+static char* const blisp_names_4[] = { "list", ">", "<", ">=", "<=", "==", "!=" };
+
+// \ {x y}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+    case 5:
+        BLISP_DO(lvm_do_typed[5](env, code->names[1], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 11:
+        BLISP_DO(lvm_do_typed[4](env, code->names[2], 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 17:
+        BLISP_DO(lvm_do_typed[7](env, code->names[3], 1), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 23:
+        BLISP_DO(lvm_do_typed[6](env, code->names[4], 1), 26);
+    case 26:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 29:
+        BLISP_DO(lvm_do_typed[8](env, code->names[5], 1), 32);
+    case 32:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 35:
+        BLISP_DO(lvm_do_typed[9](env, code->names[6], 1), 38);
+    case 38:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 38);
+    case 40:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 40);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 19, 0, 0, 1, 1, 14, 1, 1, 21, 0, 1, 13, 2, 1, 21, 0, 1, 16, 3, 1, 21, 0, 1, 15, 4, 1, 21, 0, 1, 17, 5, 1, 21, 0, 1, 18, 6, 1, 7, 6, 8 };
+static char* const blisp_names_5[] = { "list", ">", "<", ">=", "<=", "==", "!=" };
+
+// \ {logic x y}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 2), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 11);
+        blisp_push(lval_copy(env->vals[1]));
+    case 11:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 2), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 17);
+        blisp_push(lval_copy(env->vals[1]));
+    case 17:
+        BLISP_DO(lvm_do_call(env, 1), 19);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 19);
+    case 21:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 21);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 20, 0, 1, 21, 1, 2, 6, 2, 19, 2, 1, 23, 2, 2, 19, 3, 1, 6, 1, 7, 3, 8 };
+static char* const blisp_names_6[] = { "list", "||", "&&", "!" };
+
+// \ {x y}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_call(env, 2), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 11);
+        blisp_push(lval_copy(env->vals[0]));
+    case 11:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 17);
+        blisp_push(lval_copy(env->vals[0]));
+    case 17:
+        BLISP_DO(lvm_do_call(env, 1), 19);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 19);
+    case 21:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 21);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 20, 0, 1, 21, 0, 1, 6, 2, 19, 2, 0, 23, 1, 2, 19, 3, 0, 6, 1, 7, 3, 8 };
+static char* const blisp_names_7[] = { "list", "||", "&&", "!" };
+
+// \ {sum-to n acc}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l35, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l47;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 28:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 31);
+    case 31:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 31);
+    case 33:
+        goto l47;
+    case 35:
+    l35:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 38:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 41);
+    case 41:
+        blisp_push(lval_copy(code->consts[1]));
+    case 43:
+        blisp_push(lval_copy(code->consts[2]));
+    case 45:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 45);
+    case 47:
+    l47:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 47);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 3, 0, 35, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 47, 21, 0, 1, 0, 3, 10, 2, 1, 21, 2, 1, 9, 3, 1, 7, 2, 5, 47, 22, 1, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_8[] = { "if", "==", "-", "+" };
+
+// \ {n acc}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l35, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l47;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 28:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 31);
+    case 31:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 31);
+    case 33:
+        goto l47;
+    case 35:
+    l35:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[4]));
+    case 38:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 41);
+    case 41:
+        blisp_push(lval_copy(code->consts[1]));
+    case 43:
+        blisp_push(lval_copy(code->consts[2]));
+    case 45:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 45);
+    case 47:
+    l47:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 47);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 3, 0, 35, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 47, 19, 2, 0, 0, 3, 10, 3, 1, 21, 1, 0, 9, 4, 1, 7, 2, 5, 47, 22, 0, 4, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_9[] = { "if", "==", "sum-to", "-", "+" };
+
+// \ {acc}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 12);
+    case 12:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 20, 0, 1, 0, 0, 10, 2, 1, 1, 0, 2, 1, 9, 3, 1, 7, 2, 8 };
+static char* const blisp_names_10[] = { "sum-to", "n", "-", "+" };
+
+// \ {}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 11);
+    case 11:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 14);
+    case 14:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 14);
+    case 16:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 16);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 1, 9, 4, 1, 7, 2, 8 };
+static char* const blisp_names_11[] = { "sum-to", "n", "-", "acc", "+" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 11, lval_sym("+"), lval_int(INT64_C(1)), lval_int(INT64_C(2)), lval_int(INT64_C(3)), lval_int(INT64_C(4)), lval_int(INT64_C(5)), lval_int(INT64_C(6)), lval_int(INT64_C(7)), lval_int(INT64_C(8)), lval_int(INT64_C(9)), lval_int(INT64_C(10))), blisp_list(lval_sexpr(), 5, lval_sym("-"), lval_int(INT64_C(100)), lval_int(INT64_C(1)), lval_int(INT64_C(2)), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 6, lval_sym("*"), lval_int(INT64_C(1)), lval_int(INT64_C(2)), lval_int(INT64_C(3)), lval_int(INT64_C(4)), lval_int(INT64_C(5))), blisp_list(lval_sexpr(), 4, lval_sym("/"), lval_int(INT64_C(120)), lval_int(INT64_C(2)), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 3, lval_sym("%"), lval_int(INT64_C(17)), lval_int(INT64_C(5))), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(10)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_int(INT64_C(1)), lval_num(0x1.4p+1)), blisp_list(lval_sexpr(), 4, lval_sym("-"), lval_int(INT64_C(10)), lval_num(0x1p-1), lval_num(0x1p-2)), blisp_list(lval_sexpr(), 4, lval_sym("*"), lval_int(INT64_C(2)), lval_num(0x1.8p+0), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("/"), lval_int(INT64_C(7)), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("/"), lval_num(0x1.cp+2), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("%"), lval_num(0x1.ep+2), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 6, lval_sym("min"), lval_int(INT64_C(5)), lval_int(INT64_C(3)), lval_int(INT64_C(9)), lval_int(INT64_C(-2)), lval_int(INT64_C(4))), blisp_list(lval_sexpr(), 6, lval_sym("max"), lval_int(INT64_C(5)), lval_int(INT64_C(3)), lval_int(INT64_C(9)), lval_int(INT64_C(-2)), lval_int(INT64_C(4))), blisp_list(lval_sexpr(), 3, lval_sym("min"), lval_int(INT64_C(1)), lval_num(0x1p-1)), blisp_list(lval_sexpr(), 3, lval_sym("max"), lval_int(INT64_C(1)), lval_num(0x1.8p+0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("-"), lval_int(INT64_C(5))), blisp_list(lval_sexpr(), 2, lval_sym("-"), lval_num(0x1.4p+1)), blisp_list(lval_sexpr(), 2, lval_sym("+"), lval_int(INT64_C(7))), blisp_list(lval_sexpr(), 2, lval_sym("*"), lval_int(INT64_C(7)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_int(INT64_C(2)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_int(INT64_C(2)), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_int(INT64_C(2)), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("<="), lval_int(INT64_C(3)), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_int(INT64_C(2)), lval_num(0x1p+1)), blisp_list(lval_sexpr(), 3, lval_sym("!="), lval_int(INT64_C(2)), lval_int(INT64_C(3)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_qexpr(), 2, lval_int(INT64_C(1)), lval_int(INT64_C(2))), blisp_list(lval_qexpr(), 2, lval_int(INT64_C(1)), lval_int(INT64_C(2)))), blisp_list(lval_sexpr(), 3, lval_sym("!="), lval_str("a"), lval_str("b")), blisp_list(lval_sexpr(), 3, lval_sym("||"), lval_bool(false), lval_bool(true)), blisp_list(lval_sexpr(), 3, lval_sym("&&"), lval_bool(true), lval_bool(false)), blisp_list(lval_sexpr(), 2, lval_sym("!"), lval_bool(false))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_int(INT64_C(1)), lval_str("a")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("%"), lval_int(INT64_C(1)), lval_int(INT64_C(0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("/"), lval_num(0x1p+0), lval_int(INT64_C(0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_int(INT64_C(1)), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("&&"), lval_bool(true), lval_int(INT64_C(1))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("!"), lval_int(INT64_C(1))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("arith"), lval_sym("x"), lval_sym("y")), blisp_list(lval_qexpr(), 10, lval_sym("list"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("/"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("%"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_sym("x"), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("min"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("max"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 2, lval_sym("-"), lval_sym("x")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("order"), lval_sym("x"), lval_sym("y")), blisp_list(lval_qexpr(), 7, lval_sym("list"), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym(">="), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("<="), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("!="), lval_sym("x"), lval_sym("y")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("logic"), lval_sym("x"), lval_sym("y")), blisp_list(lval_qexpr(), 4, lval_sym("list"), blisp_list(lval_sexpr(), 3, lval_sym("||"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 3, lval_sym("&&"), lval_sym("x"), lval_sym("y")), blisp_list(lval_sexpr(), 2, lval_sym("!"), lval_sym("x")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("arith"), lval_int(INT64_C(12)), lval_int(INT64_C(5)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("arith"), lval_num(0x1.9p+3), lval_int(INT64_C(5)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_int(INT64_C(3)), lval_int(INT64_C(4)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("order"), lval_num(0x1p+2), lval_int(INT64_C(4)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("logic"), lval_bool(true), lval_bool(false))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("logic"), lval_bool(false), lval_bool(false))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("sum-to"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("sum-to"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), lval_sym("n"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("sum-to"), lval_int(INT64_C(1000)), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 58, blisp_names_2, 9, blisp_code_2);
+    lvm_register(blisp_ops_3, 58, blisp_names_3, 9, blisp_code_3);
+    lvm_register(blisp_ops_4, 41, blisp_names_4, 7, blisp_code_4);
+    lvm_register(blisp_ops_5, 41, blisp_names_5, 7, blisp_code_5);
+    lvm_register(blisp_ops_6, 22, blisp_names_6, 4, blisp_code_6);
+    lvm_register(blisp_ops_7, 22, blisp_names_7, 4, blisp_code_7);
+    lvm_register(blisp_ops_8, 48, blisp_names_8, 4, blisp_code_8);
+    lvm_register(blisp_ops_9, 48, blisp_names_9, 5, blisp_code_9);
+    lvm_register(blisp_ops_10, 18, blisp_names_10, 4, blisp_code_10);
+    lvm_register(blisp_ops_11, 17, blisp_names_11, 5, blisp_code_11);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
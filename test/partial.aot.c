@@ -0,0 +1,541 @@
+// Generated by blisp --emit-c from test/partial.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {add3 a b c}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 3:
+        blisp_push(lval_copy(env->vals[3]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[0], 0), 8);
+    case 8:
+        BLISP_DO(lvm_do_typed[0](env, code->names[0], 1), 11);
+    case 11:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 11);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 21, 1, 2, 1, 3, 9, 0, 0, 9, 0, 1, 8 };
+static char* const blisp_names_2[] = { "+" };
+
+// \ {a b c}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[0], 0), 8);
+    case 8:
+        BLISP_DO(lvm_do_typed[0](env, code->names[0], 1), 11);
+    case 11:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 11);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 21, 0, 1, 1, 2, 9, 0, 0, 9, 0, 1, 8 };
+static char* const blisp_names_3[] = { "+" };
+
+// \ {rest a b & r}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 19, 0, 1, 21, 2, 3, 7, 3, 8 };
+static char* const blisp_names_4[] = { "list" };
+
+// \ {a b & r}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 19, 0, 0, 21, 1, 2, 7, 3, 8 };
+static char* const blisp_names_5[] = { "list" };
+
+// \ {sum n acc}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l40, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l52;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 30);
+        blisp_push(lval_copy(env->vals[1]));
+    case 30:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 2), 33);
+    case 33:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 36);
+    case 36:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 36);
+    case 38:
+        goto l52;
+    case 40:
+    l40:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 43:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 46);
+    case 46:
+        blisp_push(lval_copy(code->consts[1]));
+    case 48:
+        blisp_push(lval_copy(code->consts[2]));
+    case 50:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 50);
+    case 52:
+    l52:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 52);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 3, 0, 40, 22, 1, 0, 17, 1, 1, 4, 1, 2, 17, 1, 2, 5, 52, 21, 0, 1, 0, 3, 10, 2, 1, 1, 2, 19, 3, 1, 24, 4, 2, 9, 4, 1, 7, 2, 5, 52, 22, 1, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_6[] = { "if", "==", "-", "add10", "+" };
+
+// \ {n acc}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l40, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l52;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[3]));
+    case 22:
+        BLISP_DO(lvm_do_typed[1](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 30);
+        blisp_push(lval_copy(env->vals[0]));
+    case 30:
+        blisp_push(lval_copy(code->consts[4]));
+        BLISP_DO(lvm_do_call(env, 2), 33);
+    case 33:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 36);
+    case 36:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 36);
+    case 38:
+        goto l52;
+    case 40:
+    l40:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 43:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 46);
+    case 46:
+        blisp_push(lval_copy(code->consts[1]));
+    case 48:
+        blisp_push(lval_copy(code->consts[2]));
+    case 50:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 50);
+    case 52:
+    l52:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 52);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 3, 0, 40, 22, 0, 0, 17, 1, 1, 4, 1, 2, 17, 1, 1, 5, 52, 19, 2, 0, 0, 3, 10, 3, 1, 1, 1, 19, 4, 0, 24, 4, 2, 9, 5, 1, 7, 2, 5, 52, 22, 0, 5, 17, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_7[] = { "if", "==", "sum", "-", "add10", "+" };
+
+// \ {acc}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        blisp_push(lval_copy(env->vals[0]));
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 16);
+    case 16:
+        BLISP_DO(lvm_do_typed[0](env, code->names[4], 1), 19);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 19);
+    case 21:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 21);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 20, 0, 1, 0, 0, 10, 2, 1, 1, 0, 20, 3, 1, 24, 1, 2, 9, 4, 1, 7, 2, 8 };
+static char* const blisp_names_8[] = { "sum", "n", "-", "add10", "+" };
+
+// \ {}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[1](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[1]));
+        BLISP_DO(lvm_do_call(env, 2), 16);
+    case 16:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 19);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 19);
+    case 21:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 21);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 20, 0, 1, 0, 0, 10, 2, 1, 20, 3, 4, 2, 1, 24, 1, 2, 9, 5, 1, 7, 2, 8 };
+static char* const blisp_names_9[] = { "sum", "n", "-", "acc", "add10", "+" };
+
+// \ {a b}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        BLISP_DO(lvm_do_typed[1](env, code->names[0], 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 21, 0, 1, 10, 0, 1, 8 };
+static char* const blisp_names_10[] = { "-" };
+
+// \ {b}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        BLISP_DO(lvm_do_typed[1](env, code->names[1], 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 19, 0, 0, 10, 1, 1, 8 };
+static char* const blisp_names_11[] = { "a", "-" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("add3"), lval_sym("a"), lval_sym("b"), lval_sym("c")), blisp_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("a"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("b"), lval_sym("c")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("add3"), lval_int(INT64_C(1)), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), lval_int(INT64_C(2))), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 3, lval_sym("add3"), lval_int(INT64_C(1)), lval_int(INT64_C(2))), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 3, blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), lval_int(INT64_C(2)), lval_int(INT64_C(3)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), lval_int(INT64_C(2)), lval_int(INT64_C(3)), lval_int(INT64_C(4)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, blisp_list(lval_sexpr(), 3, lval_sym("add3"), lval_int(INT64_C(1)), lval_int(INT64_C(2))), lval_int(INT64_C(3)), lval_int(INT64_C(4)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), lval_int(INT64_C(2))), lval_int(INT64_C(3)), lval_int(INT64_C(4)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 5, lval_sym("rest"), lval_sym("a"), lval_sym("b"), lval_sym("&"), lval_sym("r")), blisp_list(lval_qexpr(), 4, lval_sym("list"), lval_sym("a"), lval_sym("b"), lval_sym("r"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("rest"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, lval_sym("rest"), lval_int(INT64_C(1))), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 4, blisp_list(lval_sexpr(), 2, lval_sym("rest"), lval_int(INT64_C(1))), lval_int(INT64_C(2)), lval_int(INT64_C(3)), lval_int(INT64_C(4))), blisp_list(lval_sexpr(), 3, lval_sym("rest"), lval_int(INT64_C(1)), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("add10")), blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(10)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("sum"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 3, lval_sym("sum"), blisp_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 3, lval_sym("add10"), lval_sym("n"), lval_int(INT64_C(0))))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("add10"), lval_int(INT64_C(1)), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("sum"), lval_int(INT64_C(2000)), lval_int(INT64_C(0))), lval_sym("add10")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1)))), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(2)))), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 3, lval_sym("add3"), lval_int(INT64_C(1)), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), lval_int(INT64_C(2))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("-"), lval_sym("a"), lval_sym("b"))), lval_int(INT64_C(10))), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("-"), lval_sym("a"), lval_sym("b"))), lval_int(INT64_C(10))), lval_int(INT64_C(4)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fs")), blisp_list(lval_sexpr(), 4, lval_sym("list"), blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("add3"), lval_int(INT64_C(1)), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 2, blisp_list(lval_sexpr(), 2, lval_sym("add3"), lval_int(INT64_C(1))), lval_int(INT64_C(2))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), lval_sym("fs"), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_sexpr(), 2, lval_sym("head"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("fs"))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(3)))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 12, blisp_names_2, 1, blisp_code_2);
+    lvm_register(blisp_ops_3, 12, blisp_names_3, 1, blisp_code_3);
+    lvm_register(blisp_ops_4, 9, blisp_names_4, 1, blisp_code_4);
+    lvm_register(blisp_ops_5, 9, blisp_names_5, 1, blisp_code_5);
+    lvm_register(blisp_ops_6, 53, blisp_names_6, 5, blisp_code_6);
+    lvm_register(blisp_ops_7, 53, blisp_names_7, 6, blisp_code_7);
+    lvm_register(blisp_ops_8, 22, blisp_names_8, 5, blisp_code_8);
+    lvm_register(blisp_ops_9, 22, blisp_names_9, 6, blisp_code_9);
+    lvm_register(blisp_ops_10, 7, blisp_names_10, 1, blisp_code_10);
+    lvm_register(blisp_ops_11, 7, blisp_names_11, 2, blisp_code_11);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,446 @@
+// Generated by blisp --emit-c from test/share.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {xs}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(code->consts[0]));
+    case 2:
+        blisp_push(lval_copy(code->consts[1]));
+    case 4:
+        blisp_push(lval_copy(code->consts[2]));
+    case 6:
+        blisp_push(lval_copy(code->consts[3]));
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 8);
+    case 10:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 10);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 0, 0, 0, 1, 0, 2, 0, 3, 7, 3, 8 };
+static char* const blisp_names_2[] = { NULL };
+
+// \ {e}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(code->consts[0]));
+    case 2:
+        blisp_push(lval_copy(code->consts[1]));
+    case 4:
+        BLISP_DO(lvm_do_typed[0](env, code->names[0], 1), 7);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 0, 0, 0, 1, 9, 0, 1, 8 };
+static char* const blisp_names_3[] = { "+" };
+
+// \ {twice f x}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 21, 1, 1, 23, 2, 1, 7, 1, 8 };
+static char* const blisp_names_4[] = { NULL };
+
+// \ {f x}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[0]));
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 21, 0, 0, 23, 1, 1, 7, 1, 8 };
+static char* const blisp_names_5[] = { NULL };
+
+// \ {push-front x}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        blisp_push(lval_copy(code->consts[0]));
+    case 4:
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 2, 0, 0, 0, 1, 1, 7, 2, 8 };
+static char* const blisp_names_6[] = { "cons" };
+
+// \ {x}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        blisp_push(lval_copy(code->consts[0]));
+    case 4:
+        blisp_push(lval_copy(env->vals[0]));
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 6);
+    case 8:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 8);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 2, 0, 0, 0, 1, 0, 7, 2, 8 };
+static char* const blisp_names_7[] = { "cons" };
+
+// \ {shadow xs}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 8);
+        blisp_push(lval_copy(env->vals[1]));
+    case 8:
+        BLISP_DO(lvm_do_call(env, 1), 10);
+    case 10:
+        BLISP_DO(lvm_do_call(env, 2), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+    case 14:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 14);
+    case 16:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 16);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 20, 0, 1, 0, 0, 19, 2, 1, 6, 1, 6, 2, 1, 1, 7, 2, 8 };
+static char* const blisp_names_8[] = { "do", "=", "tail" };
+
+// \ {xs}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 8);
+        blisp_push(lval_copy(env->vals[0]));
+    case 8:
+        BLISP_DO(lvm_do_call(env, 1), 10);
+    case 10:
+        BLISP_DO(lvm_do_call(env, 2), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[0]));
+    case 14:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 14);
+    case 16:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 16);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 20, 0, 1, 0, 0, 19, 2, 0, 6, 1, 6, 2, 1, 0, 7, 2, 8 };
+static char* const blisp_names_9[] = { "do", "=", "tail" };
+
+// \ {do a b}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[2]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 1, 2, 8 };
+static char* const blisp_names_10[] = { NULL };
+
+// \ {a b}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 1, 1, 8 };
+static char* const blisp_names_11[] = { NULL };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_qexpr(), 4, lval_int(INT64_C(1)), lval_int(INT64_C(2)), lval_int(INT64_C(3)), lval_int(INT64_C(4)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("ys")), lval_sym("xs")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("n")), lval_int(INT64_C(10))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("n"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("n"), lval_sym("n")), blisp_list(lval_sexpr(), 2, lval_sym("-"), lval_sym("n")), lval_sym("n")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("xs")), blisp_list(lval_sexpr(), 2, lval_sym("init"), lval_sym("xs")), blisp_list(lval_sexpr(), 3, lval_sym("cons"), lval_int(INT64_C(0)), lval_sym("xs")), blisp_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("xs"), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(5)))), blisp_list(lval_sexpr(), 4, lval_sym("update"), lval_sym("xs"), lval_int(INT64_C(0)), blisp_list(lval_qexpr(), 1, lval_sym("one"))), blisp_list(lval_sexpr(), 2, lval_sym("eval"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("xs")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), lval_sym("xs"), lval_sym("ys"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("xs"), lval_sym("ys"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("e")), blisp_list(lval_qexpr(), 3, lval_sym("+"), lval_int(INT64_C(1)), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("eval"), lval_sym("e")), blisp_list(lval_sexpr(), 2, lval_sym("eval"), lval_sym("e")), lval_sym("e")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("twice"), lval_sym("f"), lval_sym("x")), blisp_list(lval_qexpr(), 2, lval_sym("f"), blisp_list(lval_sexpr(), 2, lval_sym("f"), lval_sym("x")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("push-front"), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("cons"), lval_int(INT64_C(0)), lval_sym("x"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("twice"), lval_sym("push-front"), lval_sym("xs")), lval_sym("xs"), blisp_list(lval_sexpr(), 3, lval_sym("twice"), lval_sym("tail"), lval_sym("xs"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("zs")), lval_sym("xs")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_sexpr(), 4, lval_sym("update"), lval_sym("xs"), lval_int(INT64_C(3)), lval_int(INT64_C(9)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), lval_sym("xs"), lval_sym("ys"), lval_sym("zs")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("shadow"), lval_sym("xs")), blisp_list(lval_qexpr(), 3, lval_sym("do"), blisp_list(lval_sexpr(), 3, lval_sym("="), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("xs"))), lval_sym("xs"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("do"), lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 1, lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("shadow"), lval_sym("ys")), lval_sym("ys")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("m")), blisp_list(lval_sexpr(), 2, lval_sym("map-new"), blisp_list(lval_qexpr(), 2, lval_int(INT64_C(1)), lval_sym("a")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("m2")), blisp_list(lval_sexpr(), 4, lval_sym("map-put"), lval_sym("m"), lval_int(INT64_C(2)), blisp_list(lval_qexpr(), 1, lval_sym("b")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("m")), blisp_list(lval_sexpr(), 2, lval_sym("map-len"), lval_sym("m2")), blisp_list(lval_sexpr(), 4, lval_sym("map-get"), blisp_list(lval_sexpr(), 3, lval_sym("map-del"), lval_sym("m2"), lval_int(INT64_C(1))), lval_int(INT64_C(1)), blisp_list(lval_qexpr(), 1, lval_sym("gone"))), blisp_list(lval_sexpr(), 3, lval_sym("map-get"), lval_sym("m2"), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 11, blisp_names_2, 0, blisp_code_2);
+    lvm_register(blisp_ops_3, 8, blisp_names_3, 1, blisp_code_3);
+    lvm_register(blisp_ops_4, 9, blisp_names_4, 0, blisp_code_4);
+    lvm_register(blisp_ops_5, 9, blisp_names_5, 0, blisp_code_5);
+    lvm_register(blisp_ops_6, 9, blisp_names_6, 1, blisp_code_6);
+    lvm_register(blisp_ops_7, 9, blisp_names_7, 1, blisp_code_7);
+    lvm_register(blisp_ops_8, 17, blisp_names_8, 3, blisp_code_8);
+    lvm_register(blisp_ops_9, 17, blisp_names_9, 3, blisp_code_9);
+    lvm_register(blisp_ops_10, 3, blisp_names_10, 0, blisp_code_10);
+    lvm_register(blisp_ops_11, 3, blisp_names_11, 0, blisp_code_11);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
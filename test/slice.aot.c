@@ -0,0 +1,485 @@
+// Generated by blisp --emit-c from test/slice.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {range i n acc}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l41, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[3]));
+    case 15:
+        goto l53;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[2]));
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 30);
+        blisp_push(lval_copy(env->vals[3]));
+    case 30:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 33);
+        blisp_push(lval_copy(env->vals[1]));
+    case 33:
+        BLISP_DO(lvm_do_call(env, 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 37);
+    case 39:
+        goto l53;
+    case 41:
+    l41:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 44:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 47);
+    case 47:
+        blisp_push(lval_copy(code->consts[0]));
+    case 49:
+        blisp_push(lval_copy(code->consts[1]));
+    case 51:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 51);
+    case 53:
+    l53:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 53);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 3, 0, 41, 21, 1, 2, 17, 1, 1, 4, 0, 1, 17, 1, 3, 5, 53, 21, 0, 1, 0, 2, 9, 2, 1, 1, 2, 19, 3, 3, 19, 4, 1, 6, 1, 6, 2, 7, 3, 5, 53, 21, 1, 2, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_2[] = { "if", "==", "+", "join", "list" };
+
+// \ {i n acc}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l41, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l53;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[2]));
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 30);
+        blisp_push(lval_copy(env->vals[2]));
+    case 30:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 33);
+        blisp_push(lval_copy(env->vals[0]));
+    case 33:
+        BLISP_DO(lvm_do_call(env, 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 37);
+    case 39:
+        goto l53;
+    case 41:
+    l41:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 44:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 47);
+    case 47:
+        blisp_push(lval_copy(code->consts[0]));
+    case 49:
+        blisp_push(lval_copy(code->consts[1]));
+    case 51:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 51);
+    case 53:
+    l53:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 53);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 41, 21, 0, 1, 17, 1, 1, 4, 0, 1, 17, 1, 2, 5, 53, 19, 2, 0, 0, 2, 9, 3, 1, 1, 1, 19, 4, 2, 19, 5, 0, 6, 1, 6, 2, 7, 3, 5, 53, 21, 0, 1, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "==", "range", "+", "join", "list" };
+
+// \ {acc}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        blisp_push(lval_copy(env->vals[0]));
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        BLISP_DO(lvm_do_call(env, 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 20);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 22);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 20, 0, 1, 0, 0, 9, 2, 1, 20, 3, 4, 1, 0, 20, 5, 1, 6, 1, 6, 2, 7, 3, 8 };
+static char* const blisp_names_4[] = { "range", "i", "+", "n", "join", "list" };
+
+// \ {}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 14);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        BLISP_DO(lvm_do_call(env, 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 20);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 22);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 0, 0, 9, 2, 1, 20, 3, 4, 20, 5, 6, 2, 1, 6, 1, 6, 2, 7, 3, 8 };
+static char* const blisp_names_5[] = { "range", "i", "+", "n", "join", "acc", "list" };
+
+// \ {middle n}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[1]));
+    case 8:
+        BLISP_DO(lvm_do_call(env, 3), 10);
+    case 10:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 13:
+        BLISP_DO(lvm_do_typed[3](env, code->names[2], 1), 16);
+    case 16:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 19:
+        BLISP_DO(lvm_do_typed[3](env, code->names[2], 1), 22);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 22);
+    case 24:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 24);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 20, 0, 1, 0, 0, 22, 1, 1, 6, 3, 22, 1, 2, 12, 2, 1, 22, 1, 3, 12, 2, 1, 7, 3, 8 };
+static char* const blisp_names_6[] = { "slice", "range", "/" };
+
+// \ {n}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[1]));
+    case 8:
+        BLISP_DO(lvm_do_call(env, 3), 10);
+    case 10:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 13:
+        BLISP_DO(lvm_do_typed[3](env, code->names[2], 1), 16);
+    case 16:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 19:
+        BLISP_DO(lvm_do_typed[3](env, code->names[2], 1), 22);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 22);
+    case 24:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 24);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 20, 0, 1, 0, 0, 22, 0, 1, 6, 3, 22, 0, 2, 12, 2, 1, 22, 0, 3, 12, 2, 1, 7, 3, 8 };
+static char* const blisp_names_7[] = { "slice", "range", "/" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("range"), lval_sym("i"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_sym("n")), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("range"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("i"), lval_int(INT64_C(1))), lval_sym("n"), blisp_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("acc"), blisp_list(lval_sexpr(), 2, lval_sym("list"), lval_sym("i")))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_sexpr(), 4, lval_sym("range"), lval_int(INT64_C(0)), lval_int(INT64_C(20)), lval_qexpr())));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("s")), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(5)), lval_int(INT64_C(10)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("t")), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("xs"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("i")), blisp_list(lval_sexpr(), 2, lval_sym("init"), lval_sym("xs"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), lval_sym("s"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("s")), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("t")), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("i"), lval_int(INT64_C(18))), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("s"), lval_int(INT64_C(2)), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 4, lval_sym("slice"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("s"), lval_int(INT64_C(2)), lval_int(INT64_C(6))), lval_int(INT64_C(1)), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("update"), lval_sym("s"), lval_int(INT64_C(0)), blisp_list(lval_qexpr(), 1, lval_sym("five"))), blisp_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("s"), blisp_list(lval_qexpr(), 1, lval_sym("x"))), blisp_list(lval_sexpr(), 3, lval_sym("cons"), lval_int(INT64_C(1)), lval_sym("s")), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("s")), blisp_list(lval_sexpr(), 2, lval_sym("init"), lval_sym("s"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("xs")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("xs")), blisp_list(lval_sexpr(), 4, lval_sym("update"), lval_sym("xs"), lval_int(INT64_C(7)), blisp_list(lval_qexpr(), 1, lval_sym("seven")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), lval_sym("s"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("xs"), lval_int(INT64_C(7))), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(6)), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("t"), lval_int(INT64_C(6)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("middle"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("slice"), blisp_list(lval_sexpr(), 4, lval_sym("range"), lval_int(INT64_C(0)), lval_sym("n"), lval_qexpr()), blisp_list(lval_sexpr(), 3, lval_sym("/"), lval_sym("n"), lval_int(INT64_C(4))), blisp_list(lval_sexpr(), 3, lval_sym("/"), lval_sym("n"), lval_int(INT64_C(2))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("m")), blisp_list(lval_sexpr(), 2, lval_sym("middle"), lval_int(INT64_C(400)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("gc"), lval_bool(true)));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("m")), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("m")), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("m"), lval_int(INT64_C(199))), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(0)), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(20)), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(0)), lval_int(INT64_C(20))), lval_sym("xs"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(15)), lval_int(INT64_C(6)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(-1)), lval_int(INT64_C(2)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(1)), lval_int(INT64_C(2147483647)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(2147483647)), lval_int(INT64_C(2147483647)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(4294967296)), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(0)), lval_int(INT64_C(-4294967296)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(100))), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_num(0x1p-1), lval_num(0x1.7333333333333p+1))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("xs"), lval_int(INT64_C(1)), lval_num(0x1p+1))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 54, blisp_names_2, 5, blisp_code_2);
+    lvm_register(blisp_ops_3, 54, blisp_names_3, 6, blisp_code_3);
+    lvm_register(blisp_ops_4, 23, blisp_names_4, 6, blisp_code_4);
+    lvm_register(blisp_ops_5, 23, blisp_names_5, 7, blisp_code_5);
+    lvm_register(blisp_ops_6, 25, blisp_names_6, 3, blisp_code_6);
+    lvm_register(blisp_ops_7, 25, blisp_names_7, 3, blisp_code_7);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
@@ -0,0 +1,622 @@
+// Generated by blisp --emit-c from test/special.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {pick c a b}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        blisp_push(lval_copy(code->consts[0]));
+    case 4:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 7:
+        blisp_push(lval_copy(env->vals[3]));
+    case 9:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 9);
+    case 11:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 11);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 2, 0, 0, 0, 21, 1, 2, 1, 3, 7, 4, 8 };
+static char* const blisp_names_2[] = { "list" };
+
+// \ {c a b}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        blisp_push(lval_copy(code->consts[0]));
+    case 4:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 7:
+        blisp_push(lval_copy(env->vals[2]));
+    case 9:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 9);
+    case 11:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 11);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 2, 0, 0, 0, 21, 0, 1, 1, 2, 7, 4, 8 };
+static char* const blisp_names_3[] = { "list" };
+
+// \ {pair a b}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        blisp_push(lval_copy(code->consts[0]));
+    case 4:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 7);
+    case 9:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 9);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 2, 0, 0, 0, 21, 1, 2, 7, 3, 8 };
+static char* const blisp_names_4[] = { "list" };
+
+// \ {a b}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        blisp_push(lval_copy(code->consts[0]));
+    case 4:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 7);
+    case 9:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 9);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 2, 0, 0, 0, 21, 0, 1, 7, 3, 8 };
+static char* const blisp_names_5[] = { "list" };
+
+// \ {with-if if x}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l21, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[5](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l33;
+    case 17:
+    l17:
+        blisp_push(lval_copy(code->consts[4]));
+    case 19:
+        goto l33;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 24:
+        BLISP_DO(lvm_do_typed[5](env, code->names[1], 1), 27);
+    case 27:
+        blisp_push(lval_copy(code->consts[1]));
+    case 29:
+        blisp_push(lval_copy(code->consts[2]));
+    case 31:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 31);
+    case 33:
+    l33:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 33);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 3, 0, 21, 22, 2, 0, 14, 1, 1, 4, 1, 2, 17, 0, 3, 5, 33, 0, 4, 5, 33, 22, 2, 5, 14, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_6[] = { "if", ">" };
+
+// \ {if x}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l21, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[5](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l33;
+    case 17:
+    l17:
+        blisp_push(lval_copy(code->consts[4]));
+    case 19:
+        goto l33;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 24:
+        BLISP_DO(lvm_do_typed[5](env, code->names[1], 1), 27);
+    case 27:
+        blisp_push(lval_copy(code->consts[1]));
+    case 29:
+        blisp_push(lval_copy(code->consts[2]));
+    case 31:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 31);
+    case 33:
+    l33:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 33);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 3, 0, 21, 22, 1, 0, 14, 1, 1, 4, 1, 2, 17, 0, 3, 5, 33, 0, 4, 5, 33, 22, 1, 5, 14, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_7[] = { "if", ">" };
+
+// \ {with-lambda \ x}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+    case 5:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 5);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 22, 1, 0, 1, 2, 7, 2, 8 };
+static char* const blisp_names_8[] = { NULL };
+
+// \ {\ x}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+    case 5:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 5);
+    case 7:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 7);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 22, 0, 0, 1, 1, 7, 2, 8 };
+static char* const blisp_names_9[] = { NULL };
+
+// \ {x}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l21, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 6:
+        BLISP_DO(lvm_do_typed[5](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[1], &code->consts[2]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l33;
+    case 17:
+    l17:
+        blisp_push(lval_copy(code->consts[4]));
+    case 19:
+        goto l33;
+    case 21:
+    l21:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[5]));
+    case 24:
+        BLISP_DO(lvm_do_typed[5](env, code->names[1], 1), 27);
+    case 27:
+        blisp_push(lval_copy(code->consts[1]));
+    case 29:
+        blisp_push(lval_copy(code->consts[2]));
+    case 31:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 31);
+    case 33:
+    l33:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 33);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 3, 0, 21, 22, 0, 0, 14, 1, 1, 4, 1, 2, 17, 0, 3, 5, 33, 0, 4, 5, 33, 22, 0, 5, 14, 1, 1, 0, 1, 0, 2, 7, 3, 8 };
+static char* const blisp_names_10[] = { "if", ">" };
+
+// \ {caller if}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 2);
+    case 2:
+        blisp_push(lval_copy(code->consts[0]));
+    case 4:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 4);
+    case 6:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 6);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 2, 0, 0, 0, 7, 1, 8 };
+static char* const blisp_names_11[] = { "callee" };
+
+// \ {after x}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l17, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+    case 5:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l13, 9);
+    case 9:
+        blisp_push(lval_copy(code->consts[2]));
+    case 11:
+        goto l24;
+    case 13:
+    l13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l24;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[1]));
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 22);
+    case 24:
+    l24:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 24);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 3, 0, 17, 1, 1, 4, 0, 1, 13, 0, 2, 5, 24, 0, 3, 5, 24, 22, 1, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_12[] = { "if" };
+
+// \ {x}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l17, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+    case 5:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l13, 9);
+    case 9:
+        blisp_push(lval_copy(code->consts[2]));
+    case 11:
+        goto l24;
+    case 13:
+    l13:
+        blisp_push(lval_copy(code->consts[3]));
+    case 15:
+        goto l24;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(code->consts[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[1]));
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 22);
+    case 24:
+    l24:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 24);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 3, 0, 17, 1, 0, 4, 0, 1, 13, 0, 2, 5, 24, 0, 3, 5, 24, 22, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_13[] = { "if" };
+
+// \ {yes}
+static int blisp_code_14(lcode* code, int pc, lenv* env) {
+
+    switch(pc) {
+    case 0:
+        blisp_push(lval_copy(code->consts[0]));
+    case 2:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 2);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_14[] = { 0, 0, 8 };
+static char* const blisp_names_14[] = { NULL };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("pick"), lval_sym("c"), lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 5, lval_sym("list"), lval_str("pick"), lval_sym("c"), lval_sym("a"), lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("pair"), lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 4, lval_sym("list"), lval_str("pair"), lval_sym("a"), lval_sym("b"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("with-if"), lval_sym("if"), lval_sym("x")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_sym("x"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_str("pos")), blisp_list(lval_qexpr(), 1, lval_str("neg")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("with-if"), lval_sym("pick"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 3, lval_sym("with-if"), lval_sym("pick"), lval_int(INT64_C(-1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("with-lambda"), lval_sym("\\"), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 1, lval_sym("a")), lval_sym("x"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("with-def"), lval_sym("def"), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("unset")), lval_sym("x"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 3, lval_sym("with-set"), lval_sym("="), lval_sym("x")), blisp_list(lval_qexpr(), 3, lval_sym("="), blisp_list(lval_qexpr(), 1, lval_sym("unset")), lval_sym("x"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("with-lambda"), lval_sym("pair"), lval_int(INT64_C(5))), blisp_list(lval_sexpr(), 3, lval_sym("with-def"), lval_sym("pair"), lval_int(INT64_C(6))), blisp_list(lval_sexpr(), 3, lval_sym("with-set"), lval_sym("pair"), lval_int(INT64_C(7)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("unset")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("callee"), lval_sym("x")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym(">"), lval_sym("x"), lval_int(INT64_C(0))), blisp_list(lval_qexpr(), 1, lval_str("then")), blisp_list(lval_qexpr(), 1, lval_str("else")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("caller"), lval_sym("if")), blisp_list(lval_qexpr(), 2, lval_sym("callee"), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("caller"), lval_sym("pick")), blisp_list(lval_sexpr(), 2, lval_sym("callee"), lval_int(INT64_C(1)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("when")), lval_sym("if")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("when"), lval_bool(true), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(1))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(2)))), blisp_list(lval_sexpr(), 4, lval_sym("when"), lval_bool(false), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(1))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(2))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("builtin-if")), lval_sym("if")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("if")), lval_sym("pick")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 2, lval_sym("after"), lval_sym("x")), blisp_list(lval_qexpr(), 4, lval_sym("if"), lval_sym("x"), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(1))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(2))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("if"), lval_bool(true), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(1))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(2)))), blisp_list(lval_sexpr(), 2, lval_sym("callee"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, lval_sym("after"), lval_bool(true))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("if")), lval_sym("builtin-if")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("if"), lval_bool(true), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(1))), blisp_list(lval_qexpr(), 1, lval_int(INT64_C(2)))), blisp_list(lval_sexpr(), 2, lval_sym("callee"), lval_int(INT64_C(1))), blisp_list(lval_sexpr(), 2, lval_sym("after"), lval_bool(true))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("yes")), blisp_list(lval_qexpr(), 1, lval_str("yes"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("no")), blisp_list(lval_qexpr(), 1, lval_str("no"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("if"), lval_bool(true), lval_sym("yes"), lval_sym("no")), blisp_list(lval_sexpr(), 4, lval_sym("if"), lval_bool(false), lval_sym("yes"), lval_sym("no"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 12, blisp_names_2, 1, blisp_code_2);
+    lvm_register(blisp_ops_3, 12, blisp_names_3, 1, blisp_code_3);
+    lvm_register(blisp_ops_4, 10, blisp_names_4, 1, blisp_code_4);
+    lvm_register(blisp_ops_5, 10, blisp_names_5, 1, blisp_code_5);
+    lvm_register(blisp_ops_6, 34, blisp_names_6, 2, blisp_code_6);
+    lvm_register(blisp_ops_7, 34, blisp_names_7, 2, blisp_code_7);
+    lvm_register(blisp_ops_8, 8, blisp_names_8, 0, blisp_code_8);
+    lvm_register(blisp_ops_9, 8, blisp_names_9, 0, blisp_code_9);
+    lvm_register(blisp_ops_10, 34, blisp_names_10, 2, blisp_code_10);
+    lvm_register(blisp_ops_11, 7, blisp_names_11, 1, blisp_code_11);
+    lvm_register(blisp_ops_12, 25, blisp_names_12, 1, blisp_code_12);
+    lvm_register(blisp_ops_13, 25, blisp_names_13, 1, blisp_code_13);
+    lvm_register(blisp_ops_14, 3, blisp_names_14, 0, blisp_code_14);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}
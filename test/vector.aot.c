@@ -0,0 +1,870 @@
+// Generated by blisp --emit-c from test/vector.blisp.
+#include "ljit.h"
+#include "lval.h"
+
+// Leave to the instruction loop with status at pc.
+#define BLISP_EXIT(status, pc) ((pc) << LVM_EXIT_BITS | (status))
+
+// Do an instruction by calling the VM, leaving to carry on at next if it
+// says to.
+#define BLISP_DO(call, next) \
+    if((status = (call))) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// The same for one that may jump to label instead.
+#define BLISP_TEST(call, label, next) \
+    if((status = (call)) < 0) { \
+        goto label; \
+    } else if(status) { \
+        return BLISP_EXIT(status, next); \
+    }
+
+// Push x onto the stack of the VM.
+static inline void blisp_push(lval* x) {
+
+    (*lvm_stack)[(*lvm_height)++] = x;
+
+}
+
+// BRANCH, testing a Boolean here.
+static inline int blisp_branch(lenv* env, lval** then, lval** otherwise) {
+
+    lval* cond = (*lvm_stack)[*lvm_height - 1];
+
+    if(lval_type(cond) != LVAL_BOOL) {
+        return lvm_do_branch(env, then, otherwise);
+    }
+
+    bool val = cond->val;
+    (*lvm_height)--;
+    lval_del(cond);
+    return val ? LVM_EXIT_NONE : -1;
+
+}
+
+// Add the n values after n to list x.
+static lval* blisp_list(lval* x, int n, ...) {
+
+    va_list values;
+    va_start(values, n);
+    while(n--) {
+        x = lval_add(x, va_arg(values, lval*));
+    }
+    va_end(values);
+
+    return x;
+
+}
+
+// \ {f b}
+static int blisp_code_0(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 6);
+    case 6:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 9);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 9);
+    case 9:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 1), 12);
+    case 12:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 15);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 17);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_0[] = { 20, 0, 1, 23, 0, 1, 20, 2, 3, 23, 0, 1, 23, 1, 2, 7, 2, 8 };
+static char* const blisp_names_0[] = { "def", "head", "\\", "tail" };
+
+// \ {b}
+static int blisp_code_1(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        BLISP_DO(lvm_do_call(env, 1), 7);
+    case 7:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 10);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 12);
+    case 12:
+        BLISP_DO(lvm_do_call(env, 1), 14);
+    case 14:
+        blisp_push(lval_copy(env->vals[0]));
+        BLISP_DO(lvm_do_call(env, 2), 17);
+    case 17:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 17);
+    case 19:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 19);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_1[] = { 20, 0, 1, 2, 2, 6, 1, 20, 3, 4, 2, 2, 6, 1, 23, 0, 2, 7, 2, 8 };
+static char* const blisp_names_1[] = { "def", "head", "f", "\\", "tail" };
+
+// \ {range a b acc}
+static int blisp_code_2(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l41, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[3]));
+    case 15:
+        goto l53;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(code->consts[2]));
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[2]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 30);
+        blisp_push(lval_copy(env->vals[3]));
+    case 30:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 33);
+        blisp_push(lval_copy(env->vals[1]));
+    case 33:
+        BLISP_DO(lvm_do_call(env, 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 37);
+    case 39:
+        goto l53;
+    case 41:
+    l41:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 44:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 47);
+    case 47:
+        blisp_push(lval_copy(code->consts[0]));
+    case 49:
+        blisp_push(lval_copy(code->consts[1]));
+    case 51:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 51);
+    case 53:
+    l53:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 53);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_2[] = { 3, 0, 41, 21, 1, 2, 17, 1, 1, 4, 0, 1, 17, 1, 3, 5, 53, 21, 0, 1, 0, 2, 9, 2, 1, 1, 2, 19, 3, 3, 19, 4, 1, 6, 1, 6, 2, 7, 3, 5, 53, 21, 1, 2, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_2[] = { "if", "==", "+", "join", "list" };
+
+// \ {a b acc}
+static int blisp_code_3(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l41, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[2]));
+    case 15:
+        goto l53;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(code->consts[2]));
+    case 22:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 25);
+    case 25:
+        blisp_push(lval_copy(env->vals[1]));
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 30);
+        blisp_push(lval_copy(env->vals[2]));
+    case 30:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 33);
+        blisp_push(lval_copy(env->vals[0]));
+    case 33:
+        BLISP_DO(lvm_do_call(env, 1), 35);
+    case 35:
+        BLISP_DO(lvm_do_call(env, 2), 37);
+    case 37:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 37);
+    case 39:
+        goto l53;
+    case 41:
+    l41:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 44:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 47);
+    case 47:
+        blisp_push(lval_copy(code->consts[0]));
+    case 49:
+        blisp_push(lval_copy(code->consts[1]));
+    case 51:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 51);
+    case 53:
+    l53:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 53);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_3[] = { 3, 0, 41, 21, 0, 1, 17, 1, 1, 4, 0, 1, 17, 1, 2, 5, 53, 19, 2, 0, 0, 2, 9, 3, 1, 1, 1, 19, 4, 2, 19, 5, 0, 6, 1, 6, 2, 7, 3, 5, 53, 21, 0, 1, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_3[] = { "if", "==", "range", "+", "join", "list" };
+
+// \ {acc}
+static int blisp_code_4(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        blisp_push(lval_copy(env->vals[0]));
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        BLISP_DO(lvm_do_call(env, 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 20);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 22);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_4[] = { 20, 0, 1, 0, 0, 9, 2, 1, 20, 3, 4, 1, 0, 20, 5, 1, 6, 1, 6, 2, 7, 3, 8 };
+static char* const blisp_names_4[] = { "range", "a", "+", "b", "join", "list" };
+
+// \ {}
+static int blisp_code_5(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(code->consts[0]));
+    case 5:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 8);
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 14);
+        BLISP_DO(lvm_do_global(env, code->names[6]), 14);
+    case 14:
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        BLISP_DO(lvm_do_call(env, 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 20);
+    case 22:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 22);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_5[] = { 20, 0, 1, 0, 0, 9, 2, 1, 20, 3, 4, 20, 5, 6, 2, 1, 6, 1, 6, 2, 7, 3, 8 };
+static char* const blisp_names_5[] = { "range", "a", "+", "b", "join", "acc", "list" };
+
+// \ {sum l i n acc}
+static int blisp_code_6(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l42, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[4]));
+    case 15:
+        goto l54;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 20:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 23:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 26);
+    case 26:
+        blisp_push(lval_copy(env->vals[3]));
+        blisp_push(lval_copy(env->vals[4]));
+    case 29:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 32);
+        blisp_push(lval_copy(env->vals[1]));
+    case 32:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 2), 35);
+    case 35:
+        BLISP_DO(lvm_do_typed[0](env, code->names[2], 1), 38);
+    case 38:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 38);
+    case 40:
+        goto l54;
+    case 42:
+    l42:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 45:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 48);
+    case 48:
+        blisp_push(lval_copy(code->consts[0]));
+    case 50:
+        blisp_push(lval_copy(code->consts[1]));
+    case 52:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 52);
+    case 54:
+    l54:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 54);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_6[] = { 3, 0, 42, 21, 2, 3, 17, 1, 1, 4, 0, 1, 17, 1, 4, 5, 54, 21, 0, 1, 22, 2, 2, 9, 2, 1, 21, 3, 4, 19, 3, 1, 23, 2, 2, 9, 2, 1, 7, 4, 5, 54, 21, 2, 3, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_6[] = { "if", "==", "+", "nth" };
+
+// \ {l i n acc}
+static int blisp_code_7(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l42, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[3]));
+    case 15:
+        goto l54;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        blisp_push(lval_copy(env->vals[0]));
+    case 20:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 23:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 26);
+    case 26:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 29:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 32);
+        blisp_push(lval_copy(env->vals[0]));
+    case 32:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 35);
+    case 35:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 38);
+    case 38:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 38);
+    case 40:
+        goto l54;
+    case 42:
+    l42:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 45:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 48);
+    case 48:
+        blisp_push(lval_copy(code->consts[0]));
+    case 50:
+        blisp_push(lval_copy(code->consts[1]));
+    case 52:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 52);
+    case 54:
+    l54:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 54);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_7[] = { 3, 0, 42, 21, 1, 2, 17, 1, 1, 4, 0, 1, 17, 1, 3, 5, 54, 19, 2, 0, 22, 1, 2, 9, 3, 1, 21, 2, 3, 19, 4, 0, 23, 1, 2, 9, 3, 1, 7, 4, 5, 54, 21, 1, 2, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_7[] = { "if", "==", "sum", "+", "nth" };
+
+// \ {acc}
+static int blisp_code_8(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        blisp_push(lval_copy(code->consts[0]));
+    case 7:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 13);
+        blisp_push(lval_copy(env->vals[0]));
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[5]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 23);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 23);
+    case 25:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 25);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_8[] = { 20, 0, 1, 2, 2, 0, 0, 9, 3, 1, 19, 4, 0, 20, 5, 1, 2, 2, 6, 2, 9, 3, 1, 7, 4, 8 };
+static char* const blisp_names_8[] = { "sum", "l", "i", "+", "n", "nth" };
+
+// \ {}
+static int blisp_code_9(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 5);
+    case 5:
+        blisp_push(lval_copy(code->consts[0]));
+    case 7:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 10);
+    case 10:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 13);
+        BLISP_DO(lvm_do_global(env, code->names[5]), 13);
+    case 13:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 16);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 16);
+    case 16:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 2), 20);
+    case 20:
+        BLISP_DO(lvm_do_typed[0](env, code->names[3], 1), 23);
+    case 23:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 23);
+    case 25:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 25);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_9[] = { 20, 0, 1, 2, 2, 0, 0, 9, 3, 1, 20, 4, 5, 20, 6, 1, 2, 2, 6, 2, 9, 3, 1, 7, 4, 8 };
+static char* const blisp_names_9[] = { "sum", "l", "i", "+", "n", "acc", "nth" };
+
+// \ {bump l i n}
+static int blisp_code_10(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l48, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[1]));
+    case 15:
+        goto l60;
+    case 17:
+    l17:
+        blisp_push(lval_copy(env->vals[0]));
+    case 19:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 22);
+        blisp_push(lval_copy(env->vals[1]));
+    case 22:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[2]));
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 28);
+        blisp_push(lval_copy(env->vals[1]));
+    case 28:
+        blisp_push(lval_copy(env->vals[2]));
+        BLISP_DO(lvm_do_call(env, 2), 31);
+    case 31:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 1), 34);
+    case 34:
+        BLISP_DO(lvm_do_call(env, 3), 36);
+    case 36:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 39:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 42);
+    case 42:
+        blisp_push(lval_copy(env->vals[3]));
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 44);
+    case 46:
+        goto l60;
+    case 48:
+    l48:
+        blisp_push(lval_copy(env->vals[2]));
+        blisp_push(lval_copy(env->vals[3]));
+    case 51:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 54);
+    case 54:
+        blisp_push(lval_copy(code->consts[0]));
+    case 56:
+        blisp_push(lval_copy(code->consts[1]));
+    case 58:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 58);
+    case 60:
+    l60:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 60);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_10[] = { 3, 0, 48, 21, 2, 3, 17, 1, 1, 4, 0, 1, 17, 1, 1, 5, 60, 1, 0, 19, 2, 1, 22, 2, 2, 19, 3, 1, 23, 2, 2, 11, 4, 1, 6, 3, 22, 2, 3, 9, 5, 1, 1, 3, 7, 3, 5, 60, 21, 2, 3, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_10[] = { "if", "==", "update", "nth", "*", "+" };
+
+// \ {l i n}
+static int blisp_code_11(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_TEST(lvm_do_if(env, code->names[0]), l48, 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 6:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 9);
+    case 9:
+        BLISP_TEST(blisp_branch(env, &code->consts[0], &code->consts[1]), l17, 13);
+    case 13:
+        blisp_push(lval_copy(env->vals[0]));
+    case 15:
+        goto l60;
+    case 17:
+    l17:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 20);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 20);
+    case 20:
+        blisp_push(lval_copy(env->vals[0]));
+        blisp_push(lval_copy(env->vals[1]));
+    case 23:
+        blisp_push(lval_copy(code->consts[2]));
+    case 25:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 28);
+        blisp_push(lval_copy(env->vals[0]));
+    case 28:
+        blisp_push(lval_copy(env->vals[1]));
+        BLISP_DO(lvm_do_call(env, 2), 31);
+    case 31:
+        BLISP_DO(lvm_do_typed[2](env, code->names[5], 1), 34);
+    case 34:
+        BLISP_DO(lvm_do_call(env, 3), 36);
+    case 36:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(code->consts[3]));
+    case 39:
+        BLISP_DO(lvm_do_typed[0](env, code->names[6], 1), 42);
+    case 42:
+        blisp_push(lval_copy(env->vals[2]));
+    case 44:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 44);
+    case 46:
+        goto l60;
+    case 48:
+    l48:
+        blisp_push(lval_copy(env->vals[1]));
+        blisp_push(lval_copy(env->vals[2]));
+    case 51:
+        BLISP_DO(lvm_do_typed[8](env, code->names[1], 1), 54);
+    case 54:
+        blisp_push(lval_copy(code->consts[0]));
+    case 56:
+        blisp_push(lval_copy(code->consts[1]));
+    case 58:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 58);
+    case 60:
+    l60:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 60);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_11[] = { 3, 0, 48, 21, 1, 2, 17, 1, 1, 4, 0, 1, 17, 1, 0, 5, 60, 20, 2, 3, 21, 0, 1, 0, 2, 19, 4, 0, 23, 1, 2, 11, 5, 1, 6, 3, 22, 1, 3, 9, 6, 1, 1, 2, 7, 3, 5, 60, 21, 1, 2, 17, 1, 1, 0, 0, 0, 1, 7, 3, 8 };
+static char* const blisp_names_11[] = { "if", "==", "bump", "update", "nth", "*", "+" };
+
+// \ {l}
+static int blisp_code_12(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        blisp_push(lval_copy(env->vals[0]));
+    case 5:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 7);
+    case 7:
+        blisp_push(lval_copy(code->consts[0]));
+    case 9:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 12);
+        blisp_push(lval_copy(env->vals[0]));
+    case 12:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 14);
+    case 14:
+        BLISP_DO(lvm_do_call(env, 2), 16);
+    case 16:
+        BLISP_DO(lvm_do_typed[2](env, code->names[4], 1), 19);
+    case 19:
+        BLISP_DO(lvm_do_call(env, 3), 21);
+    case 21:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 23);
+    case 23:
+        blisp_push(lval_copy(code->consts[1]));
+    case 25:
+        BLISP_DO(lvm_do_typed[0](env, code->names[5], 1), 28);
+    case 28:
+        BLISP_DO(lvm_do_global(env, code->names[6]), 30);
+    case 30:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 30);
+    case 32:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 32);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_12[] = { 20, 0, 1, 1, 0, 2, 2, 0, 0, 19, 3, 0, 2, 2, 6, 2, 11, 4, 1, 6, 3, 2, 2, 0, 1, 9, 5, 1, 2, 6, 7, 3, 8 };
+static char* const blisp_names_12[] = { "bump", "update", "i", "nth", "*", "+", "n" };
+
+// \ {}
+static int blisp_code_13(lcode* code, int pc, lenv* env) {
+
+    int status;
+
+    switch(pc) {
+    case 0:
+        BLISP_DO(lvm_do_global(env, code->names[0]), 3);
+        BLISP_DO(lvm_do_global(env, code->names[1]), 3);
+    case 3:
+        BLISP_DO(lvm_do_global(env, code->names[2]), 6);
+        BLISP_DO(lvm_do_global(env, code->names[3]), 6);
+    case 6:
+        blisp_push(lval_copy(code->consts[0]));
+    case 8:
+        BLISP_DO(lvm_do_global(env, code->names[4]), 11);
+        BLISP_DO(lvm_do_global(env, code->names[2]), 11);
+    case 11:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 13);
+    case 13:
+        BLISP_DO(lvm_do_call(env, 2), 15);
+    case 15:
+        BLISP_DO(lvm_do_typed[2](env, code->names[5], 1), 18);
+    case 18:
+        BLISP_DO(lvm_do_call(env, 3), 20);
+    case 20:
+        BLISP_DO(lvm_do_global(env, code->names[3]), 22);
+    case 22:
+        blisp_push(lval_copy(code->consts[1]));
+    case 24:
+        BLISP_DO(lvm_do_typed[0](env, code->names[6], 1), 27);
+    case 27:
+        BLISP_DO(lvm_do_global(env, code->names[7]), 29);
+    case 29:
+        return BLISP_EXIT(LVM_EXIT_TAILCALL, 29);
+    case 31:
+        return BLISP_EXIT(LVM_EXIT_RETURN, 31);
+    }
+
+    abort();
+
+}
+
+static const int blisp_ops_13[] = { 20, 0, 1, 20, 2, 3, 0, 0, 20, 4, 2, 2, 3, 6, 2, 11, 5, 1, 6, 3, 2, 3, 0, 1, 9, 6, 1, 2, 7, 7, 3, 8 };
+static char* const blisp_names_13[] = { "bump", "update", "l", "i", "nth", "*", "+", "n" };
+
+// The program's expressions.
+static lval* blisp_program(void) {
+
+    lval* x = lval_sexpr();
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("fun")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("b")), blisp_list(lval_qexpr(), 3, lval_sym("def"), blisp_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("f")), blisp_list(lval_sexpr(), 3, lval_sym("\\"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("f")), lval_sym("b"))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("range"), lval_sym("a"), lval_sym("b"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("a"), lval_sym("b")), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("range"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("a"), lval_int(INT64_C(1))), lval_sym("b"), blisp_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("acc"), blisp_list(lval_sexpr(), 2, lval_sym("list"), lval_sym("a")))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 5, lval_sym("sum"), lval_sym("l"), lval_sym("i"), lval_sym("n"), lval_sym("acc")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_sym("n")), blisp_list(lval_qexpr(), 1, lval_sym("acc")), blisp_list(lval_qexpr(), 5, lval_sym("sum"), lval_sym("l"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("i"), lval_int(INT64_C(1))), lval_sym("n"), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("l"), lval_sym("i")))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("v")), blisp_list(lval_sexpr(), 4, lval_sym("range"), lval_int(INT64_C(0)), lval_int(INT64_C(5000)), lval_qexpr())));
+    x = lval_add(x, blisp_list(lval_sexpr(), 8, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("v")), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(31))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(32))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(1023))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(1024))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(4999)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 5, lval_sym("sum"), lval_sym("v"), lval_int(INT64_C(0)), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("v")), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("s")), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("v"), lval_int(INT64_C(1000)), lval_int(INT64_C(3000)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("s")), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("s"), lval_int(INT64_C(2999))), blisp_list(lval_sexpr(), 5, lval_sym("sum"), lval_sym("s"), lval_int(INT64_C(0)), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("s")), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("t")), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("s"), lval_int(INT64_C(1234)), lval_int(INT64_C(55)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("t")), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("t"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("t"), lval_int(INT64_C(54))), lval_sym("t")));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("v"), lval_int(INT64_C(4990)), lval_int(INT64_C(10))), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("s"), lval_int(INT64_C(0)), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 2, lval_sym("len"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("v"))), blisp_list(lval_sexpr(), 2, lval_sym("len"), blisp_list(lval_sexpr(), 2, lval_sym("init"), lval_sym("v"))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("v")), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 2, lval_sym("init"), lval_sym("v")), lval_int(INT64_C(4998)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("u")), blisp_list(lval_sexpr(), 4, lval_sym("update"), blisp_list(lval_sexpr(), 4, lval_sym("update"), blisp_list(lval_sexpr(), 4, lval_sym("update"), lval_sym("v"), lval_int(INT64_C(0)), blisp_list(lval_qexpr(), 1, lval_sym("a"))), lval_int(INT64_C(1024)), blisp_list(lval_qexpr(), 1, lval_sym("b"))), lval_int(INT64_C(4999)), blisp_list(lval_qexpr(), 1, lval_sym("c")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 7, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("u"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("u"), lval_int(INT64_C(1024))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("u"), lval_int(INT64_C(4999))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(1024))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(4999)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("fun"), blisp_list(lval_qexpr(), 4, lval_sym("bump"), lval_sym("l"), lval_sym("i"), lval_sym("n")), blisp_list(lval_qexpr(), 4, lval_sym("if"), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_sym("n")), blisp_list(lval_qexpr(), 1, lval_sym("l")), blisp_list(lval_qexpr(), 4, lval_sym("bump"), blisp_list(lval_sexpr(), 4, lval_sym("update"), lval_sym("l"), lval_sym("i"), blisp_list(lval_sexpr(), 3, lval_sym("*"), lval_int(INT64_C(2)), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("l"), lval_sym("i")))), blisp_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("i"), lval_int(INT64_C(1))), lval_sym("n")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("w")), blisp_list(lval_sexpr(), 4, lval_sym("bump"), lval_sym("v"), lval_int(INT64_C(2000)), lval_int(INT64_C(2100)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 5, lval_sym("print"), blisp_list(lval_sexpr(), 5, lval_sym("sum"), lval_sym("w"), lval_int(INT64_C(0)), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("w")), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 5, lval_sym("sum"), lval_sym("v"), lval_int(INT64_C(0)), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("v")), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("w"), lval_int(INT64_C(2099))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("w"), lval_int(INT64_C(2100)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("j")), blisp_list(lval_sexpr(), 4, lval_sym("join"), lval_sym("s"), lval_sym("v"), lval_sym("t"))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("j")), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("j"), lval_int(INT64_C(2999))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("j"), lval_int(INT64_C(3000))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("j"), lval_int(INT64_C(8000))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("j"), lval_int(INT64_C(8054)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 5, lval_sym("sum"), lval_sym("j"), lval_int(INT64_C(0)), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("j")), lval_int(INT64_C(0)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("def"), blisp_list(lval_qexpr(), 1, lval_sym("c")), blisp_list(lval_sexpr(), 3, lval_sym("cons"), lval_int(INT64_C(-1)), blisp_list(lval_sexpr(), 3, lval_sym("join"), blisp_list(lval_qexpr(), 2, lval_int(INT64_C(-3)), lval_int(INT64_C(-2))), lval_sym("v")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 6, lval_sym("print"), blisp_list(lval_sexpr(), 2, lval_sym("len"), lval_sym("c")), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("c"), lval_int(INT64_C(0))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("c"), lval_int(INT64_C(2))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("c"), lval_int(INT64_C(3))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("c"), lval_int(INT64_C(5002)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 4, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("j"), lval_int(INT64_C(3000)), lval_int(INT64_C(5000))), lval_sym("v")), blisp_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("v"), lval_sym("w")), blisp_list(lval_sexpr(), 3, lval_sym("=="), blisp_list(lval_sexpr(), 4, lval_sym("range"), lval_int(INT64_C(0)), lval_int(INT64_C(200)), lval_qexpr()), blisp_list(lval_sexpr(), 4, lval_sym("slice"), lval_sym("v"), lval_int(INT64_C(0)), lval_int(INT64_C(200))))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(4294967296)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(-4294967297)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("update"), lval_sym("v"), blisp_list(lval_sexpr(), 3, lval_sym("^"), lval_int(INT64_C(2)), lval_int(INT64_C(100))), blisp_list(lval_qexpr(), 1, lval_sym("x")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), blisp_list(lval_qexpr(), 3, lval_int(INT64_C(1)), lval_int(INT64_C(2)), lval_int(INT64_C(3))), lval_num(0x1.e666666666666p+0))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("print"), blisp_list(lval_sexpr(), 4, lval_sym("update"), blisp_list(lval_qexpr(), 3, lval_int(INT64_C(1)), lval_int(INT64_C(2)), lval_int(INT64_C(3))), lval_num(0x1p+0), blisp_list(lval_qexpr(), 1, lval_sym("x")))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 3, lval_sym("print"), blisp_list(lval_sexpr(), 3, lval_sym("nth"), lval_sym("v"), lval_int(INT64_C(4999))), blisp_list(lval_sexpr(), 3, lval_sym("nth"), blisp_list(lval_sexpr(), 4, lval_sym("update"), lval_sym("v"), lval_int(INT64_C(4999)), blisp_list(lval_qexpr(), 1, lval_sym("x"))), lval_int(INT64_C(4999)))));
+    x = lval_add(x, blisp_list(lval_sexpr(), 2, lval_sym("exit"), lval_int(INT64_C(0))));
+    return x;
+
+}
+
+int main(void) {
+
+    lval_read_init();
+    lenv* e = lenv_new();
+    lenv_add_builtins(e);
+    lgc_set_global(e);
+    lvm_init(e);
+
+    if(getenv("BLISP_GC_STRESS")) {
+        lgc_set_stress(true);
+    }
+    if(getenv("BLISP_STACK_MB")) {
+        lvm_set_limit((size_t)atol(getenv("BLISP_STACK_MB")) << 20);
+    }
+    if(getenv("BLISP_JIT")) {
+        lvm_set_jit(true);
+    }
+    if(getenv("BLISP_PERF_MAP")) {
+        ljit_set_perf_map(true);
+    }
+
+    lvm_register(blisp_ops_0, 18, blisp_names_0, 4, blisp_code_0);
+    lvm_register(blisp_ops_1, 20, blisp_names_1, 5, blisp_code_1);
+    lvm_register(blisp_ops_2, 54, blisp_names_2, 5, blisp_code_2);
+    lvm_register(blisp_ops_3, 54, blisp_names_3, 6, blisp_code_3);
+    lvm_register(blisp_ops_4, 23, blisp_names_4, 6, blisp_code_4);
+    lvm_register(blisp_ops_5, 23, blisp_names_5, 7, blisp_code_5);
+    lvm_register(blisp_ops_6, 55, blisp_names_6, 4, blisp_code_6);
+    lvm_register(blisp_ops_7, 55, blisp_names_7, 5, blisp_code_7);
+    lvm_register(blisp_ops_8, 26, blisp_names_8, 6, blisp_code_8);
+    lvm_register(blisp_ops_9, 26, blisp_names_9, 7, blisp_code_9);
+    lvm_register(blisp_ops_10, 61, blisp_names_10, 6, blisp_code_10);
+    lvm_register(blisp_ops_11, 61, blisp_names_11, 7, blisp_code_11);
+    lvm_register(blisp_ops_12, 33, blisp_names_12, 7, blisp_code_12);
+    lvm_register(blisp_ops_13, 32, blisp_names_13, 8, blisp_code_13);
+
+    lval_eval_all(e, blisp_program());
+    lenv_del(e);
+    return 0;
+
+}